@@ -0,0 +1,82 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdint>
+
+// Google benchmark
+#include "benchmark/benchmark.h"
+
+// VCL
+#include <vcl/util/perfcounters.h>
+
+/*!
+ *	Reports hardware events per processed item as custom counters of a
+ *	google-benchmark run. Create it directly before the benchmark loop
+ *	and report directly after it. Unavailable events are not reported.
+ */
+class BenchmarkCounters
+{
+public:
+	explicit BenchmarkCounters(int64_t items_per_iteration)
+	: _itemsPerIteration(items_per_iteration)
+	{
+		_counters.start();
+	}
+
+	void report(benchmark::State& state)
+	{
+		using Vcl::Util::PerfCounters;
+
+		_counters.stop();
+
+		const double nr_items = double(state.iterations()) * double(_itemsPerIteration);
+		if (nr_items <= 0)
+			return;
+
+		// Per thread values are averaged over the threads of the run
+		for (size_t e = 0; e < PerfCounters::NrEvents; e++)
+		{
+			const auto event = static_cast<PerfCounters::Event>(e);
+			if (_counters.isAvailable(event))
+				state.counters[PerfCounters::name(event)] = benchmark::Counter(double(_counters.value(event)) / nr_items, benchmark::Counter::kAvgThreads);
+		}
+
+		const uint64_t cycles = _counters.value(PerfCounters::Event::Cycles);
+		if (cycles > 0 && _counters.isAvailable(PerfCounters::Event::Instructions))
+			state.counters["IPC"] = benchmark::Counter(double(_counters.value(PerfCounters::Event::Instructions)) / double(cycles), benchmark::Counter::kAvgThreads);
+	}
+
+private:
+	//! Counters of the benchmark thread
+	Vcl::Util::PerfCounters _counters;
+
+	//! Number of items processed in a single benchmark iteration
+	int64_t _itemsPerIteration;
+};
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// VCL
+#include <vcl/core/container/bitvector.h>
+#include <vcl/core/container/concurrentbitvector.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google benchmark
+#include "benchmark/benchmark.h"
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	// Size of the shared flag vector, in the order of the vertices of a large mesh
+	const size_t NrFlags = 1 << 22;
+
+	// Number of flags visited per iteration
+	const size_t BatchSize = 1024;
+
+	std::vector<size_t> visitOrder(size_t seed)
+	{
+		std::mt19937_64 rnd{ seed };
+		std::uniform_int_distribution<size_t> dist{ 0, NrFlags - 1 };
+
+		std::vector<size_t> indices(BatchSize * 64);
+		for (auto& idx : indices)
+			idx = dist(rnd);
+		return indices;
+	}
+
+	size_t threadSeed()
+	{
+		return std::hash<std::thread::id>{}(std::this_thread::get_id());
+	}
+}
+
+// Flags shared by all benchmark threads
+Vcl::Core::ConcurrentBitVector ConcurrentFlags{ NrFlags };
+Vcl::Core::BitVector<> LockedFlags(NrFlags);
+std::mutex LockedFlagsMutex;
+
+void BM_ConcurrentBitVectorTestAndSet(benchmark::State& state)
+{
+	const auto indices = visitOrder(threadSeed());
+
+	size_t claimed = 0;
+	size_t offset = 0;
+	while (state.KeepRunning())
+	{
+		// Clear the flags of the batch, such that every iteration claims them again.
+		// Each thread only touches its own batch, the other threads keep running.
+		state.PauseTiming();
+		for (size_t i = 0; i < BatchSize; i++)
+			ConcurrentFlags.reset(indices[offset + i]);
+		state.ResumeTiming();
+
+		for (size_t i = 0; i < BatchSize; i++)
+			claimed += ConcurrentFlags.testAndSet(indices[offset + i]) ? 0 : 1;
+
+		offset = (offset + BatchSize) % indices.size();
+	}
+	benchmark::DoNotOptimize(claimed);
+
+	state.SetItemsProcessed(state.iterations() * BatchSize);
+}
+
+void BM_ConcurrentBitVectorTest(benchmark::State& state)
+{
+	const auto indices = visitOrder(threadSeed());
+
+	size_t found = 0;
+	size_t offset = 0;
+	while (state.KeepRunning())
+	{
+		for (size_t i = 0; i < BatchSize; i++)
+			found += ConcurrentFlags.test(indices[offset + i]) ? 1 : 0;
+
+		offset = (offset + BatchSize) % indices.size();
+	}
+	benchmark::DoNotOptimize(found);
+
+	state.SetItemsProcessed(state.iterations() * BatchSize);
+}
+
+// Baseline: the non-concurrent flag vector protected by a lock
+void BM_LockedBitVectorTestAndSet(benchmark::State& state)
+{
+	const auto indices = visitOrder(threadSeed());
+
+	size_t claimed = 0;
+	size_t offset = 0;
+	while (state.KeepRunning())
+	{
+		state.PauseTiming();
+		{
+			std::lock_guard<std::mutex> guard{ LockedFlagsMutex };
+			for (size_t i = 0; i < BatchSize; i++)
+				LockedFlags.setBit(indices[offset + i], false);
+		}
+		state.ResumeTiming();
+
+		for (size_t i = 0; i < BatchSize; i++)
+		{
+			const size_t idx = indices[offset + i];
+			std::lock_guard<std::mutex> guard{ LockedFlagsMutex };
+			if (!LockedFlags[idx])
+			{
+				LockedFlags.setBit(idx, true);
+				claimed++;
+			}
+		}
+
+		offset = (offset + BatchSize) % indices.size();
+	}
+	benchmark::DoNotOptimize(claimed);
+
+	state.SetItemsProcessed(state.iterations() * BatchSize);
+}
+
+BENCHMARK(BM_ConcurrentBitVectorTestAndSet)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_ConcurrentBitVectorTest)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_LockedBitVectorTestAndSet)->ThreadRange(1, 64)->UseRealTime();
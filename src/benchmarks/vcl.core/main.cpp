@@ -42,6 +42,8 @@ VCL_END_EXTERNAL_HEADERS
 
 // VCL
 #include <vcl/core/memory/allocator.h>
+#include <vcl/core/memory/arena.h>
+#include <vcl/core/memory/pool.h>
 
 template<class T>
 using StdTempAllocator = memory::std_allocator<T, memory::temporary_allocator>;
@@ -168,6 +170,81 @@ void BM_NoInitCustomAllocator(benchmark::State& state)
 	}
 }
 
+void BM_PodArenaAllocator(benchmark::State& state)
+{
+	using namespace Vcl::Core;
+
+	while (state.KeepRunning())
+	{
+		ArenaScope scope;
+		std::vector<int, Allocator<int, ArenaAllocPolicy<int>, ObjectTraits<int>>> vec;
+		vec.resize(kMemorySize);
+		benchmark::DoNotOptimize(vec.size());
+	}
+}
+
+void BM_InitArenaAllocator(benchmark::State& state)
+{
+	using namespace Vcl::Core;
+
+	while (state.KeepRunning())
+	{
+		ArenaScope scope;
+		std::vector<OpaqueObject, Allocator<OpaqueObject, ArenaAllocPolicy<OpaqueObject>, ObjectTraits<OpaqueObject>>> vec;
+		vec.resize(kMemorySize);
+		benchmark::DoNotOptimize(vec.size());
+	}
+}
+
+void BM_PodNoInitArenaAllocator(benchmark::State& state)
+{
+	using namespace Vcl::Core;
+
+	while (state.KeepRunning())
+	{
+		ArenaScope scope;
+		std::vector<int, Allocator<int, ArenaAllocPolicy<int>, NoInitObjectTraits<int>>> vec;
+		vec.resize(kMemorySize);
+		benchmark::DoNotOptimize(vec.size());
+	}
+}
+
+void BM_PodPoolAllocator(benchmark::State& state)
+{
+	using namespace Vcl::Core;
+
+	while (state.KeepRunning())
+	{
+		std::vector<int, Allocator<int, PoolAllocPolicy<int, kMemorySize * sizeof(int)>, ObjectTraits<int>>> vec;
+		vec.resize(kMemorySize);
+		benchmark::DoNotOptimize(vec.size());
+	}
+}
+
+void BM_InitPoolAllocator(benchmark::State& state)
+{
+	using namespace Vcl::Core;
+
+	while (state.KeepRunning())
+	{
+		std::vector<OpaqueObject, Allocator<OpaqueObject, PoolAllocPolicy<OpaqueObject, kMemorySize * sizeof(OpaqueObject)>, ObjectTraits<OpaqueObject>>> vec;
+		vec.resize(kMemorySize);
+		benchmark::DoNotOptimize(vec.size());
+	}
+}
+
+void BM_PodNoInitPoolAllocator(benchmark::State& state)
+{
+	using namespace Vcl::Core;
+
+	while (state.KeepRunning())
+	{
+		std::vector<int, Allocator<int, PoolAllocPolicy<int, kMemorySize * sizeof(int)>, NoInitObjectTraits<int>>> vec;
+		vec.resize(kMemorySize);
+		benchmark::DoNotOptimize(vec.size());
+	}
+}
+
 // Register the function as a benchmark
 BENCHMARK(BM_InitTempThread);
 BENCHMARK(BM_PodTempThread);
@@ -182,4 +259,12 @@ BENCHMARK(BM_InitCustomAllocator);
 BENCHMARK(BM_PodNoInitCustomAllocator);
 BENCHMARK(BM_NoInitCustomAllocator);
 
+BENCHMARK(BM_PodArenaAllocator);
+BENCHMARK(BM_InitArenaAllocator);
+BENCHMARK(BM_PodNoInitArenaAllocator);
+
+BENCHMARK(BM_PodPoolAllocator);
+BENCHMARK(BM_InitPoolAllocator);
+BENCHMARK(BM_PodNoInitPoolAllocator);
+
 BENCHMARK_MAIN();
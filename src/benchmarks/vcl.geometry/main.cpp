@@ -44,6 +44,8 @@ VCL_END_EXTERNAL_HEADERS
 #include <vcl/geometry/intersect.h>
 #include <vcl/math/math.h>
 
+#include "../benchmarkcounters.h"
+
 // Tests the distance functions.
 static gte::Vector3<float> cast(const Eigen::Vector3f& vec)
 {
@@ -83,6 +85,7 @@ static void BM_Dist_TriTriEberly(benchmark::State& state)
 	// Compute the reference solution
 	gte::DCPQuery<float, gte::Triangle3<float>, gte::Triangle3<float>> gteQuery;
 
+	BenchmarkCounters counters{ static_cast<int64_t>(problem_size) };
 	while (state.KeepRunning())
 	{
 		for (size_t i = 0; i < problem_size; i++)
@@ -102,6 +105,7 @@ static void BM_Dist_TriTriEberly(benchmark::State& state)
 	}
 
 	state.SetItemsProcessed(problem_size * state.iterations());
+	counters.report(state);
 }
 
 template<typename Real, typename Int>
@@ -136,6 +140,7 @@ void BM_Dist_TriTri(benchmark::State& state)
 		points_C.at<float>(i) = Eigen::Vector3f::Random();
 	}
 
+	BenchmarkCounters counters{ static_cast<int64_t>(problem_size) };
 	while (state.KeepRunning())
 	{
 		for (size_t i = 0; i < problem_size / width; i++)
@@ -153,6 +158,7 @@ void BM_Dist_TriTri(benchmark::State& state)
 	}
 
 	state.SetItemsProcessed(problem_size * state.iterations());
+	counters.report(state);
 }
 
 // Register the function as a benchmark
@@ -184,6 +190,7 @@ void BM_Int_RayBoxEberly(benchmark::State& state)
 	// Compute the reference solution
 	gte::TIQuery<float, gte::Ray3<float>, gte::AlignedBox3<float>> gteQuery;
 
+	BenchmarkCounters counters{ static_cast<int64_t>(problem_size) };
 	while (state.KeepRunning())
 	{
 		for (int i = 0; i < problem_size; i++)
@@ -200,6 +207,7 @@ void BM_Int_RayBoxEberly(benchmark::State& state)
 	}
 
 	state.SetItemsProcessed(problem_size * state.iterations());
+	counters.report(state);
 }
 
 template<typename Real>
@@ -229,6 +237,7 @@ void BM_Int_RayBox(benchmark::State& state)
 		ray_dir.at<float>(i) = (box_min.at<float>(i) + box_max.at<float>(i)).normalized();
 	}
 
+	BenchmarkCounters counters{ static_cast<int64_t>(problem_size) };
 	while (state.KeepRunning())
 	{
 		for (size_t i = 0; i < problem_size / width; i++)
@@ -243,6 +252,7 @@ void BM_Int_RayBox(benchmark::State& state)
 	}
 
 	state.SetItemsProcessed(problem_size * state.iterations());
+	counters.report(state);
 }
 
 template<typename Real>
@@ -272,6 +282,7 @@ void BM_Int_RayBox_MaxMult(benchmark::State& state)
 		ray_dir.at<float>(i) = (box_min.at<float>(i) + box_max.at<float>(i)).normalized();
 	}
 
+	BenchmarkCounters counters{ static_cast<int64_t>(problem_size) };
 	while (state.KeepRunning())
 	{
 		for (size_t i = 0; i < problem_size / width; i++)
@@ -286,6 +297,7 @@ void BM_Int_RayBox_MaxMult(benchmark::State& state)
 	}
 
 	state.SetItemsProcessed(problem_size * state.iterations());
+	counters.report(state);
 }
 
 // Register the function as a benchmark
@@ -43,6 +43,7 @@
 #include <vcl/math/jacobieigen33_selfadjoint_quat.h>
 #include <vcl/util/precisetimer.h>
 
+#include "../benchmarkcounters.h"
 #include "problems.h"
 
 // Global data store for one time problem setup
@@ -56,6 +57,7 @@ void perfEigenIterative(benchmark::State& state)
 	Vcl::Core::InterleavedArray<float, 3, 3, -1> resU(state.range(0));
 	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(state.range(0));
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (int i = 0; i < state.range(0); ++i)
@@ -75,6 +77,7 @@ void perfEigenIterative(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 void perfEigenDirect(benchmark::State& state)
@@ -82,6 +85,7 @@ void perfEigenDirect(benchmark::State& state)
 	Vcl::Core::InterleavedArray<float, 3, 3, -1> resU(state.range(0));
 	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(state.range(0));
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (int i = 0; i < state.range(0); ++i)
@@ -101,6 +105,7 @@ void perfEigenDirect(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -115,6 +120,7 @@ void perfJacobi(benchmark::State& state)
 	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(state.range(0));
 
 	int avg_nr_iter = 0;
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		avg_nr_iter = 0;
@@ -135,6 +141,7 @@ void perfJacobi(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -149,6 +156,7 @@ void perfJacobiQuat(benchmark::State& state)
 	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(state.range(0));
 
 	int avg_nr_iter = 0;
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		avg_nr_iter = 0;
@@ -169,6 +177,7 @@ void perfJacobiQuat(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 using Vcl::float16;
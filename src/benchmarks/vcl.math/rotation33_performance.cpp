@@ -36,6 +36,7 @@
 #include <vcl/math/polardecomposition.h>
 #include <vcl/math/rotation33_torque.h>
 
+#include "../benchmarkcounters.h"
 #include "problems.h"
 
 // Global data store for one time problem setup
@@ -47,6 +48,7 @@ void perfEigenSVD(benchmark::State& state)
 {
 	Vcl::Core::InterleavedArray<float, 3, 3, -1> resR(state.range(0));
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (int i = 0; i < state.range(0); ++i)
@@ -66,6 +68,7 @@ void perfEigenSVD(benchmark::State& state)
 	benchmark::DoNotOptimize(resR);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -78,6 +81,7 @@ void perfPolarDecomposition(benchmark::State& state)
 
 	size_t width = sizeof(real_t) / sizeof(float);
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (size_t i = 0; i < state.range(0) / width; i++)
@@ -99,6 +103,7 @@ void perfPolarDecomposition(benchmark::State& state)
 	benchmark::DoNotOptimize(resR);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -111,6 +116,7 @@ void perfRotationTorque(benchmark::State& state)
 
 	size_t width = sizeof(real_t) / sizeof(float);
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (size_t i = 0; i < state.range(0) / width; i++)
@@ -132,6 +138,7 @@ void perfRotationTorque(benchmark::State& state)
 	benchmark::DoNotOptimize(resR);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -144,6 +151,7 @@ void perfRotationAPD(benchmark::State& state)
 
 	size_t width = sizeof(real_t) / sizeof(float);
 
+	BenchmarkCounters counters{ state.range(0) };
 	while (state.KeepRunning())
 	{
 		for (size_t i = 0; i < state.range(0) / width; i++)
@@ -165,6 +173,7 @@ void perfRotationAPD(benchmark::State& state)
 	benchmark::DoNotOptimize(resR);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 using Vcl::float16;
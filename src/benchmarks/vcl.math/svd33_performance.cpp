@@ -55,6 +55,7 @@
 #	include <vcl/math/opencl/jacobisvd33_mcadams.h>
 #endif
 
+#include "../benchmarkcounters.h"
 #include "problems.h"
 
 #ifdef VCL_CUDA_SUPPORT
@@ -198,6 +199,7 @@ void perfEigenSVD(benchmark::State& state)
 	Vcl::Core::InterleavedArray<float, 3, 3, -1> resV(state.range(0));
 	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(state.range(0));
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (int i = 0; i < state.range(0); ++i)
@@ -223,6 +225,7 @@ void perfEigenSVD(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -237,6 +240,7 @@ void perfTwoSidedSVD(benchmark::State& state)
 
 	size_t width = sizeof(real_t) / sizeof(float);
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (size_t i = 0; i < state.range(0) / width; i++)
@@ -265,6 +269,7 @@ void perfTwoSidedSVD(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar>
@@ -279,6 +284,7 @@ void perfJacobiSVDQR(benchmark::State& state)
 
 	size_t width = sizeof(real_t) / sizeof(float);
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (size_t i = 0; i < state.range(0) / width; i++)
@@ -307,6 +313,7 @@ void perfJacobiSVDQR(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 template<typename WideScalar, int Iters>
@@ -321,6 +328,7 @@ void perfMcAdamsSVD(benchmark::State& state)
 
 	size_t width = sizeof(real_t) / sizeof(float);
 
+	BenchmarkCounters counters{ state.range(0) };
 	for (auto _ : state)
 	{
 		for (size_t i = 0; i < state.range(0) / width; i++)
@@ -349,6 +357,7 @@ void perfMcAdamsSVD(benchmark::State& state)
 	benchmark::DoNotOptimize(resS);
 
 	state.SetItemsProcessed(state.iterations() * state.range(0));
+	counters.report(state);
 }
 
 using Vcl::float16;
@@ -81,10 +81,19 @@ elseif(VCL_VECTORIZE STREQUAL "NEON")
 endif()
 message(STATUS "Compiling for ${VCL_VECTORIZE}")
 
+# Set whether selected entry points are compiled for multiple instruction sets
+# and dispatched at runtime based on the executing processor
+option(VCL_VECTORIZE_DISPATCH "Enable runtime dispatch of vectorized entry points" OFF)
+message(STATUS "Using runtime dispatch ${VCL_VECTORIZE_DISPATCH}")
+
 # Set whether contracts should be used
 set(VCL_USE_CONTRACTS CACHE BOOL "Enable contracts")
 message(STATUS "Using contracts ${VCL_USE_CONTRACTS}")
 
+# Set whether profiling zones record timings
+option(VCL_ENABLE_PROFILING "Enable profiling zones" OFF)
+message(STATUS "Using profiling zones ${VCL_ENABLE_PROFILING}")
+
 # Set whether contracts should be used
 option(VCL_ENABLE_COMPILETIME_TRACING "Enable compilation time tracing" OFF)
 mark_as_advanced(VCL_ENABLE_COMPILETIME_TRACING)
@@ -93,6 +102,34 @@ message(STATUS "Using compilation time tracing ${VCL_ENABLE_COMPILETIME_TRACING}
 # Enable Visual Studio solution folders
 set_property(GLOBAL PROPERTY USE_FOLDERS ON)
 
+# Compile source files for a specific instruction set when runtime dispatch is enabled
+# Supported extensions: SSE, AVX, AVX512
+function(vcl_simd_dispatch_sources ext)
+	if(NOT VCL_VECTORIZE_DISPATCH)
+		return()
+	endif()
+
+	if(VCL_COMPILER_MSVC)
+		if(ext STREQUAL "AVX512")
+			set(flags "/arch:AVX512")
+		elseif(ext STREQUAL "AVX")
+			set(flags "/arch:AVX")
+		endif()
+	elseif(VCL_COMPILER_GNU OR VCL_COMPILER_CLANG OR VCL_COMPILER_ICC)
+		if(ext STREQUAL "AVX512")
+			set(flags "-mavx512f" "-mavx512vl" "-mavx512dq" "-mfma" "-mf16c" "-mbmi2")
+		elseif(ext STREQUAL "AVX")
+			set(flags "-mavx")
+		elseif(ext STREQUAL "SSE")
+			set(flags "-msse2")
+		endif()
+	endif()
+
+	if(flags)
+		set_source_files_properties(${ARGN} PROPERTIES COMPILE_OPTIONS "${flags}")
+	endif()
+endfunction()
+
 # Configure the compiler options for a VCL target
 function(vcl_configure tgt)
 
@@ -160,9 +197,9 @@ function(vcl_configure tgt)
 		endif()
 
 		if(VCL_VECTORIZE_AVX512)
-			target_compile_options(${tgt} PUBLIC "-mavx512f" "-mavx512vl" "-mavx512dq")
+			target_compile_options(${tgt} PUBLIC "-mavx512f" "-mavx512vl" "-mavx512dq" "-mfma" "-mf16c" "-mbmi2")
 		elseif(VCL_VECTORIZE_AVX2)
-			target_compile_options(${tgt} PUBLIC "-mavx2")
+			target_compile_options(${tgt} PUBLIC "-mavx2" "-mfma" "-mf16c" "-mbmi2")
 		elseif(VCL_VECTORIZE_AVX)
 			target_compile_options(${tgt} PUBLIC "-mavx")
 		elseif(VCL_VECTORIZE_SSE4_2)
@@ -28,6 +28,7 @@
 #include <vcl/config/eigen.h>
 
 // C++ standard library
+#include <algorithm>
 #include <iostream>
 
 // OpenMP
@@ -304,7 +305,9 @@ void computeNormalsSIMD(
 {
 	using Vcl::gather;
 	using Vcl::load;
+	using Vcl::load_n;
 	using Vcl::store;
+	using Vcl::store_n;
 
 	using wint_t = Vcl::VectorScalar<int, Width>;
 	using wfloat_t = Vcl::VectorScalar<float, Width>;
@@ -328,23 +331,17 @@ void computeNormalsSIMD(
 #ifdef _OPENMP
 #	pragma omp parallel for
 #endif // _OPENMP
-	for (int i = 0; i < static_cast<int>(points.size() / Width); i++)
+	for (int i = 0; i < static_cast<int>((points.size() + Width - 1) / Width); i++)
 	{
+		const int count = std::min(Width, static_cast<int>(points.size()) - i * Width);
+
 		vector3f_t n;
-		load(n, normals.data() + i * Width);
+		load_n(n, normals.data() + i * Width, count);
 
 		// Compute
 		n /= n.norm();
 
-		store(normals.data() + i * Width, n);
-	}
-
-	for (
-		int i = static_cast<int>(points.size() / Width) * Width;
-		i < (int)points.size();
-		i++)
-	{
-		normals[i] /= normals[i].norm();
+		store_n(normals.data() + i * Width, n, count);
 	}
 
 #ifdef _OPENMP
@@ -30,12 +30,12 @@
 // C++ standard library
 #include <limits>
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 // VCL
 #include <vcl/components/componentstore.h>
 #include <vcl/components/entity.h>
+#include <vcl/core/container/flathashmap.h>
 
 namespace Vcl { namespace Components {
 	/*!
@@ -182,9 +182,9 @@ namespace Vcl { namespace Components {
 
 	private: // Component store
 		//! Per type storage of unique components per entity
-		std::unordered_map<size_t, std::unique_ptr<ComponentStoreBase>> _components;
+		Core::FlatHashMap<size_t, std::unique_ptr<ComponentStoreBase>> _components;
 
 		//! Per type stortage of multi-components per entity
-		std::unordered_map<size_t, std::unique_ptr<ComponentStoreBase>> _multiComponents;
+		Core::FlatHashMap<size_t, std::unique_ptr<ComponentStoreBase>> _multiComponents;
 	};
 }}
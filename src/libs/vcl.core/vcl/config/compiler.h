@@ -380,6 +380,30 @@ extern "C"
 }
 #	endif // defined(VCL_VECTORIZE_SSE)
 
+	// Fused multiply-add is available with every AVX2 capable CPU, but GCC
+	// and clang only expose it when explicitly requested
+#	if defined(VCL_VECTORIZE_AVX2) && (defined(__FMA__) || defined(VCL_COMPILER_MSVC))
+#		ifndef VCL_VECTORIZE_FMA
+#			define VCL_VECTORIZE_FMA
+#		endif
+#	endif
+
+	// Half-precision conversions are available with every AVX2 capable CPU,
+	// but GCC and clang only expose them when explicitly requested
+#	if defined(VCL_VECTORIZE_AVX) && (defined(__F16C__) || (defined(VCL_COMPILER_MSVC) && defined(VCL_VECTORIZE_AVX2)))
+#		ifndef VCL_VECTORIZE_F16C
+#			define VCL_VECTORIZE_F16C
+#		endif
+#	endif
+
+	// Bit deposit and extract are available with every AVX2 capable CPU,
+	// but GCC and clang only expose them when explicitly requested
+#	if defined(VCL_VECTORIZE_AVX2) && (defined(__BMI2__) || defined(VCL_COMPILER_MSVC))
+#		ifndef VCL_VECTORIZE_BMI2
+#			define VCL_VECTORIZE_BMI2
+#		endif
+#	endif
+
 #elif (defined(VCL_ARCH_ARM) || defined(VCL_ARCH_ARM64)) && defined VCL_VECTORIZE_NEON
 #	include <arm_neon.h>
 #endif
@@ -0,0 +1,136 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/algorithm/histogram.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstring>
+
+// VCL
+#include <vcl/core/concurrency/parallel.h>
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	namespace {
+		//! Minimum number of values processed by a single task
+		const size_t MinBlockSize = 16384;
+
+		//! Adds 'n' entries of 'src' to 'dst'
+		void accumulate(unsigned int* dst, const unsigned int* src, size_t n)
+		{
+			size_t i = 0;
+#ifdef VCL_VECTORIZE_SSE2
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(a, b));
+			}
+#endif
+			for (; i < n; i++)
+				dst[i] += src[i];
+		}
+	}
+
+	Histogram::Histogram(unsigned int nr_elements, unsigned int nr_buckets, ThreadPool& pool)
+	: _pool(&pool)
+	, _maxNrElements(nr_elements)
+	, _maxNrBuckets(nr_buckets)
+	{
+		VclRequire(nr_buckets > 0, "Histogram has buckets.");
+	}
+
+	void Histogram::operator()(
+		stdext::span<unsigned int> histogram,
+		stdext::span<const unsigned int> values,
+		unsigned int num_elements)
+	{
+		VclRequire(num_elements <= _maxNrElements, "Values fit into the configured size.");
+		VclRequire(histogram.size() >= _maxNrBuckets, "Output holds all buckets.");
+		VclRequire(values.size() >= num_elements, "Input holds all values.");
+
+		const size_t nr_blocks = std::max<size_t>(1, std::min<size_t>(4 * _pool->size(), num_elements / MinBlockSize));
+		const size_t nr_lanes = _maxNrBuckets <= MaxInterleavedBuckets ? NrLanes : 1;
+
+		// Build the histogram per block
+		partialHistograms(values, num_elements, nr_blocks);
+
+		// Collect the previous partial histograms
+		collectPartialHistograms(histogram, nr_blocks * nr_lanes);
+	}
+
+	void Histogram::partialHistograms(
+		stdext::span<const unsigned int> values,
+		unsigned int num_elements,
+		size_t nr_blocks)
+	{
+		const size_t n = num_elements;
+		const size_t nr_buckets = _maxNrBuckets;
+		const size_t block_size = (n + nr_blocks - 1) / nr_blocks;
+		const bool interleaved = _maxNrBuckets <= MaxInterleavedBuckets;
+		const size_t nr_lanes = interleaved ? NrLanes : 1;
+
+		_partialHistograms.assign(nr_blocks * nr_lanes * nr_buckets, 0);
+		parallel_for(*_pool, 0, nr_blocks, 1, [&](size_t first_block, size_t last_block) {
+			for (size_t b = first_block; b < last_block; b++)
+			{
+				const size_t first = std::min(n, b * block_size);
+				const size_t last = std::min(n, first + block_size);
+				const unsigned int* data = values.data();
+
+				unsigned int* buckets = _partialHistograms.data() + b * nr_lanes * nr_buckets;
+				size_t i = first;
+				if (interleaved)
+				{
+					unsigned int* lane1 = buckets + nr_buckets;
+					unsigned int* lane2 = buckets + 2 * nr_buckets;
+					unsigned int* lane3 = buckets + 3 * nr_buckets;
+					for (; i + 4 <= last; i += 4)
+					{
+						buckets[data[i + 0]]++;
+						lane1[data[i + 1]]++;
+						lane2[data[i + 2]]++;
+						lane3[data[i + 3]]++;
+					}
+				}
+				for (; i < last; i++)
+					buckets[data[i]]++;
+			}
+		});
+	}
+
+	void Histogram::collectPartialHistograms(
+		stdext::span<unsigned int> histogram,
+		size_t nr_partials)
+	{
+		const size_t nr_buckets = _maxNrBuckets;
+		parallel_for(*_pool, 0, nr_buckets, CacheLineGranularity<unsigned int>::value, [&](size_t first, size_t last) {
+			const unsigned int* partials = _partialHistograms.data();
+			std::memcpy(histogram.data() + first, partials + first, (last - first) * sizeof(unsigned int));
+			for (size_t p = 1; p < nr_partials; p++)
+				accumulate(histogram.data() + first, partials + p * nr_buckets + first, last - first);
+		});
+	}
+}}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <vector>
+
+// VCL
+#include <vcl/core/concurrency/threadpool.h>
+#include <vcl/core/span.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	CPU counterpart of the GPU histogram.
+	 *
+	 *	Each block of values is counted into a private partial histogram,
+	 *	which are summed up afterwards. For small numbers of buckets,
+	 *	consecutive values are counted into interleaved copies of the
+	 *	partial histogram to avoid stalls on repeated values.
+	 */
+	class Histogram
+	{
+	public:
+		Histogram(unsigned int nr_elements, unsigned int nr_buckets, ThreadPool& pool = ThreadPool::global());
+
+	public:
+		/*!
+		 *	Counts the occurrences of each value
+		 *
+		 *	\param histogram    Output with an entry for each bucket
+		 *	\param values       Input values, each less than the number of buckets
+		 *	\param num_elements Number of values to count
+		 */
+		void operator()(
+			stdext::span<unsigned int> histogram,
+			stdext::span<const unsigned int> values,
+			unsigned int num_elements);
+
+	private:
+		void partialHistograms(
+			stdext::span<const unsigned int> values,
+			unsigned int num_elements,
+			size_t nr_blocks);
+
+		void collectPartialHistograms(
+			stdext::span<unsigned int> histogram,
+			size_t nr_partials);
+
+	private: // Limits
+		//! Number of interleaved copies of a partial histogram
+		static const unsigned int NrLanes = 4;
+
+		//! Maximum number of buckets counted using interleaved copies
+		static const unsigned int MaxInterleavedBuckets = 1024;
+
+	private: // Configuration
+		//! Pool executing the blocks
+		ThreadPool* _pool;
+
+		unsigned int _maxNrElements{ 0 };
+
+		unsigned int _maxNrBuckets{ 0 };
+
+	private: // Buffers
+		//! Buffer accumulating the partial results
+		std::vector<unsigned int> _partialHistograms;
+	};
+}}
@@ -0,0 +1,269 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/algorithm/radixsort.h>
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+// VCL
+#include <vcl/core/concurrency/parallel.h>
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	namespace {
+		//! Number of key bits sorted per pass
+		const unsigned int DigitBits = 8;
+
+		//! Number of distinct digits
+		const size_t NrBuckets = size_t(1) << DigitBits;
+
+		//! Minimum number of entries processed by a single task
+		const size_t MinBlockSize = 16384;
+
+		//! Size of a write-combining buffer in bytes
+		const size_t CombineBufferSize = 64;
+
+		//! Digit of 'key' sorted in a pass
+		template<typename Key>
+		struct DigitExtractor
+		{
+			DigitExtractor(unsigned int pass, unsigned int key_bits)
+			: shift(pass * DigitBits)
+			, mask(static_cast<Key>((Key(1) << std::min(DigitBits, key_bits - shift)) - 1))
+			{
+			}
+
+			VCL_STRONG_INLINE size_t operator()(Key key) const noexcept
+			{
+				return static_cast<size_t>((key >> shift) & mask);
+			}
+
+			unsigned int shift;
+			Key mask;
+		};
+
+		template<typename Key>
+		void countDigits(const Key* keys, size_t first, size_t last, const DigitExtractor<Key>& digit, size_t* histogram)
+		{
+			for (size_t i = first; i < last; i++)
+				histogram[digit(keys[i])]++;
+		}
+
+		/*!
+		 *	Move the entries [first, last) to their output positions.
+		 *	Entries are collected per digit until a cache-line is filled,
+		 *	which is then written at once.
+		 */
+		template<typename Key>
+		void scatter(
+			const Key* keys, const uint32_t* values, size_t first, size_t last,
+			const DigitExtractor<Key>& digit, size_t* offsets,
+			Key* dst_keys, uint32_t* dst_values)
+		{
+			const size_t width = CombineBufferSize / sizeof(Key);
+
+			std::vector<Key> key_buffer(NrBuckets * width);
+			std::vector<uint32_t> value_buffer(values ? NrBuckets * width : 0);
+			std::array<size_t, NrBuckets> fill;
+			fill.fill(0);
+
+			for (size_t i = first; i < last; i++)
+			{
+				const size_t d = digit(keys[i]);
+				const size_t slot = d * width + fill[d];
+				key_buffer[slot] = keys[i];
+				if (values)
+					value_buffer[slot] = values[i];
+
+				if (++fill[d] == width)
+				{
+					std::memcpy(dst_keys + offsets[d], key_buffer.data() + d * width, width * sizeof(Key));
+					if (values)
+						std::memcpy(dst_values + offsets[d], value_buffer.data() + d * width, width * sizeof(uint32_t));
+					offsets[d] += width;
+					fill[d] = 0;
+				}
+			}
+
+			for (size_t d = 0; d < NrBuckets; d++)
+			{
+				if (fill[d] == 0)
+					continue;
+
+				std::memcpy(dst_keys + offsets[d], key_buffer.data() + d * width, fill[d] * sizeof(Key));
+				if (values)
+					std::memcpy(dst_values + offsets[d], value_buffer.data() + d * width, fill[d] * sizeof(uint32_t));
+				offsets[d] += fill[d];
+			}
+		}
+	}
+
+	RadixSort::RadixSort(ThreadPool& pool)
+	: _pool(&pool)
+	{
+	}
+
+	void RadixSort::operator()(stdext::span<uint32_t> keys, unsigned int keyBits)
+	{
+		sort(keys, {}, keyBits, _tmpKeys32);
+	}
+
+	void RadixSort::operator()(stdext::span<uint64_t> keys, unsigned int keyBits)
+	{
+		sort(keys, {}, keyBits, _tmpKeys64);
+	}
+
+	void RadixSort::operator()(stdext::span<uint32_t> keys, stdext::span<uint32_t> values, unsigned int keyBits)
+	{
+		sort(keys, values, keyBits, _tmpKeys32);
+	}
+
+	void RadixSort::operator()(stdext::span<uint64_t> keys, stdext::span<uint32_t> values, unsigned int keyBits)
+	{
+		sort(keys, values, keyBits, _tmpKeys64);
+	}
+
+	template<typename Key>
+	void RadixSort::sort(stdext::span<Key> keys, stdext::span<uint32_t> values, unsigned int keyBits, std::vector<Key>& tmpKeys)
+	{
+		VclRequire(values.empty() || values.size() == keys.size(), "Every key has a value.");
+		VclRequire(0 < keyBits && keyBits <= 8 * sizeof(Key), "Number of key bits is valid.");
+
+		const size_t n = keys.size();
+		if (n < 2)
+			return;
+
+		const bool has_values = !values.empty();
+		const unsigned int nr_passes = (keyBits + DigitBits - 1) / DigitBits;
+		const size_t nr_blocks = std::max<size_t>(1, std::min<size_t>(4 * _pool->size(), n / MinBlockSize));
+		const size_t block_size = (n + nr_blocks - 1) / nr_blocks;
+
+		tmpKeys.resize(n);
+		if (has_values)
+			_tmpValues.resize(n);
+		_histograms.assign(nr_blocks * nr_passes * NrBuckets, 0);
+		_offsets.resize(nr_blocks * NrBuckets);
+
+		auto histogram = [this, nr_passes](size_t block, unsigned int pass) {
+			return _histograms.data() + (block * nr_passes + pass) * NrBuckets;
+		};
+
+		std::vector<DigitExtractor<Key>> digits;
+		for (unsigned int p = 0; p < nr_passes; p++)
+			digits.emplace_back(p, keyBits);
+
+		// Count the digits of all passes in a single sweep. As skipped passes
+		// do not move any data, the counts of the first executed pass stay valid.
+		const Key* data = keys.data();
+		const Key key_mask = keyBits == 8 * sizeof(Key) ? ~Key(0) : static_cast<Key>((Key(1) << keyBits) - 1);
+		parallel_for(*_pool, 0, nr_blocks, 1, [&](size_t first_block, size_t last_block) {
+			for (size_t b = first_block; b < last_block; b++)
+			{
+				const size_t first = std::min(n, b * block_size);
+				const size_t last = std::min(n, first + block_size);
+				size_t* counts = histogram(b, 0);
+				for (size_t i = first; i < last; i++)
+				{
+					const Key key = data[i] & key_mask;
+					for (unsigned int p = 0; p < nr_passes; p++)
+						counts[p * NrBuckets + ((key >> (p * DigitBits)) & (NrBuckets - 1))]++;
+				}
+			}
+		});
+
+		Key* src_keys = keys.data();
+		Key* dst_keys = tmpKeys.data();
+		uint32_t* src_values = has_values ? values.data() : nullptr;
+		uint32_t* dst_values = has_values ? _tmpValues.data() : nullptr;
+
+		bool counted = true;
+		for (unsigned int p = 0; p < nr_passes; p++)
+		{
+			const DigitExtractor<Key>& digit = digits[p];
+
+			// Skip the pass if all keys share the same digit
+			bool uniform = false;
+			for (size_t d = 0; d < NrBuckets && !uniform; d++)
+			{
+				size_t count = 0;
+				for (size_t b = 0; b < nr_blocks; b++)
+					count += histogram(b, p)[d];
+				uniform = count == n;
+			}
+			if (uniform)
+				continue;
+
+			if (!counted)
+			{
+				parallel_for(*_pool, 0, nr_blocks, 1, [&](size_t first_block, size_t last_block) {
+					for (size_t b = first_block; b < last_block; b++)
+					{
+						const size_t first = std::min(n, b * block_size);
+						const size_t last = std::min(n, first + block_size);
+						std::fill(histogram(b, p), histogram(b, p) + NrBuckets, size_t(0));
+						countDigits(src_keys, first, last, digit, histogram(b, p));
+					}
+				});
+			}
+			counted = false;
+
+			// Entries of a digit are ordered by their block, keeping the sort stable
+			size_t offset = 0;
+			for (size_t d = 0; d < NrBuckets; d++)
+			{
+				for (size_t b = 0; b < nr_blocks; b++)
+				{
+					_offsets[b * NrBuckets + d] = offset;
+					offset += histogram(b, p)[d];
+				}
+			}
+
+			parallel_for(*_pool, 0, nr_blocks, 1, [&](size_t first_block, size_t last_block) {
+				for (size_t b = first_block; b < last_block; b++)
+				{
+					const size_t first = std::min(n, b * block_size);
+					const size_t last = std::min(n, first + block_size);
+					scatter(src_keys, src_values, first, last, digit, _offsets.data() + b * NrBuckets, dst_keys, dst_values);
+				}
+			});
+
+			std::swap(src_keys, dst_keys);
+			std::swap(src_values, dst_values);
+		}
+
+		// Move the result back to the input after an odd number of passes
+		if (src_keys != keys.data())
+		{
+			parallel_for(*_pool, 0, n, CacheLineGranularity<Key>::value, [&](size_t first, size_t last) {
+				std::memcpy(keys.data() + first, src_keys + first, (last - first) * sizeof(Key));
+				if (has_values)
+					std::memcpy(values.data() + first, src_values + first, (last - first) * sizeof(uint32_t));
+			});
+		}
+	}
+}}
@@ -0,0 +1,92 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdint>
+#include <vector>
+
+// VCL
+#include <vcl/core/concurrency/threadpool.h>
+#include <vcl/core/span.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Multi-threaded least-significant-digit radix sort for unsigned
+	 *	integer keys with an optional payload.
+	 *
+	 *	Each pass sorts by 8 key bits. The keys are split into contiguous
+	 *	blocks with their own digit histograms, which keeps the sort stable.
+	 *	Entries are scattered through per-digit write-combining buffers to
+	 *	write whole cache-lines at a time. Passes in which all keys share
+	 *	the same digit are skipped.
+	 *
+	 *	The temporary storage is kept between calls, thus an instance must
+	 *	not be used by multiple threads at the same time.
+	 */
+	class RadixSort
+	{
+	public:
+		explicit RadixSort(ThreadPool& pool = ThreadPool::global());
+
+	public:
+		/*!
+		 *	Sorts an array of unsigned integer keys and (optional) values
+		 *
+		 *	\param keys    Keys to be sorted
+		 *	\param values  Payload permuted together with the keys. Either
+		 *	               empty or of the same size as 'keys'.
+		 *	\param keyBits The number of lower bits in each key to use for ordering
+		 */
+		void operator()(stdext::span<uint32_t> keys, unsigned int keyBits = 32);
+		void operator()(stdext::span<uint64_t> keys, unsigned int keyBits = 64);
+		void operator()(stdext::span<uint32_t> keys, stdext::span<uint32_t> values, unsigned int keyBits = 32);
+		void operator()(stdext::span<uint64_t> keys, stdext::span<uint32_t> values, unsigned int keyBits = 64);
+
+	private:
+		template<typename Key>
+		void sort(stdext::span<Key> keys, stdext::span<uint32_t> values, unsigned int keyBits, std::vector<Key>& tmpKeys);
+
+	private:
+		//! Pool executing the passes
+		ThreadPool* _pool;
+
+		//! Work space for the keys
+		std::vector<uint32_t> _tmpKeys32;
+		std::vector<uint64_t> _tmpKeys64;
+
+		//! Work space for the values
+		std::vector<uint32_t> _tmpValues;
+
+		//! Digit counts per block and pass
+		std::vector<size_t> _histograms;
+
+		//! Output position of each digit per block
+		std::vector<size_t> _offsets;
+	};
+}}
@@ -0,0 +1,194 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/algorithm/scan.h>
+
+// C++ standard library
+#include <algorithm>
+
+// VCL
+#include <vcl/core/concurrency/parallel.h>
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core { namespace Details {
+	namespace {
+		//! Minimum number of entries processed by a single task
+		const size_t MinBlockSize = 16384;
+
+		unsigned int reduce(const unsigned int* src, size_t n)
+		{
+			unsigned int sum = 0;
+			size_t i = 0;
+#ifdef VCL_VECTORIZE_SSE2
+			__m128i acc = _mm_setzero_si128();
+			for (; i + 4 <= n; i += 4)
+				acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+			acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+			acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+			sum = static_cast<unsigned int>(_mm_cvtsi128_si32(acc));
+#endif
+			for (; i < n; i++)
+				sum += src[i];
+
+			return sum;
+		}
+
+		/*!
+		 *	Scans 'n' entries starting with 'carry'.
+		 *	Returns the sum of 'carry' and all entries.
+		 */
+		template<bool Inclusive>
+		unsigned int scanRange(unsigned int* dst, const unsigned int* src, size_t n, unsigned int carry)
+		{
+			size_t i = 0;
+#ifdef VCL_VECTORIZE_SSE2
+			// Prefix sum within a register using two shifted additions
+			__m128i offset = _mm_set1_epi32(static_cast<int>(carry));
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128i s = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+				s = _mm_add_epi32(s, _mm_slli_si128(s, 8));
+				s = _mm_add_epi32(s, offset);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Inclusive ? s : _mm_sub_epi32(s, x));
+				offset = _mm_shuffle_epi32(s, _MM_SHUFFLE(3, 3, 3, 3));
+			}
+			carry = static_cast<unsigned int>(_mm_cvtsi128_si32(offset));
+#endif
+			for (; i < n; i++)
+			{
+				const unsigned int x = src[i];
+				carry += x;
+				dst[i] = Inclusive ? carry : carry - x;
+			}
+
+			return carry;
+		}
+
+		//! Index of the segment containing the entry 'i'
+		size_t findSegment(stdext::span<const unsigned int> segments, size_t i)
+		{
+			const auto seg = std::upper_bound(segments.begin(), segments.end(), i);
+			return static_cast<size_t>(seg - segments.begin()) - 1;
+		}
+	}
+
+	ParallelScan::ParallelScan(unsigned int maxElements, ThreadPool& pool)
+	: _pool(&pool)
+	, _maxElements(maxElements)
+	{
+		const size_t max_blocks = 4 * _pool->size();
+		_blockSums.reserve(max_blocks);
+		_blockHeads.reserve(max_blocks);
+	}
+
+	void ParallelScan::scan(
+		stdext::span<unsigned int> dst,
+		stdext::span<const unsigned int> src,
+		unsigned int batchSize,
+		unsigned int arrayLength,
+		bool inclusive)
+	{
+		VclRequire(batchSize > 0, "At least one array is scanned.");
+
+		_batchOffsets.resize(batchSize);
+		for (unsigned int b = 0; b < batchSize; b++)
+			_batchOffsets[b] = b * arrayLength;
+
+		scan(dst, src, _batchOffsets, batchSize * arrayLength, inclusive);
+	}
+
+	void ParallelScan::scan(
+		stdext::span<unsigned int> dst,
+		stdext::span<const unsigned int> src,
+		stdext::span<const unsigned int> segmentOffsets,
+		unsigned int arrayLength,
+		bool inclusive)
+	{
+		VclRequire(arrayLength <= _maxElements, "Array fits into the configured size.");
+		VclRequire(dst.size() >= arrayLength, "Output holds all entries.");
+		VclRequire(src.size() >= arrayLength, "Input holds all entries.");
+		VclRequire(!segmentOffsets.empty() && segmentOffsets[0] == 0, "First segment starts at the beginning.");
+		VclRequire(std::is_sorted(segmentOffsets.begin(), segmentOffsets.end()), "Segments are ordered.");
+
+		const size_t n = arrayLength;
+		if (n == 0)
+			return;
+
+		const size_t nr_blocks = std::max<size_t>(1, std::min<size_t>(4 * _pool->size(), n / MinBlockSize));
+		const size_t block_size = (n + nr_blocks - 1) / nr_blocks;
+
+		// Sum of each block after its last segment start
+		_blockSums.assign(nr_blocks, 0);
+		_blockHeads.assign(nr_blocks, 0);
+		if (nr_blocks > 1)
+		{
+			parallel_for(*_pool, 0, nr_blocks, 1, [&](size_t first_block, size_t last_block) {
+				for (size_t b = first_block; b < last_block; b++)
+				{
+					const size_t first = b * block_size;
+					const size_t last = std::min(n, first + block_size);
+					const size_t head = segmentOffsets[findSegment(segmentOffsets, last - 1)];
+					const size_t start = std::max<size_t>(first, head);
+
+					_blockSums[b] = reduce(src.data() + start, last - start);
+					_blockHeads[b] = head >= first ? 1 : 0;
+				}
+			});
+
+			// Turn the block sums into the carry entering each block
+			unsigned int carry = 0;
+			for (size_t b = 0; b < nr_blocks; b++)
+			{
+				const unsigned int sum = _blockSums[b];
+				_blockSums[b] = carry;
+				carry = _blockHeads[b] ? sum : carry + sum;
+			}
+		}
+
+		parallel_for(*_pool, 0, nr_blocks, 1, [&](size_t first_block, size_t last_block) {
+			for (size_t b = first_block; b < last_block; b++)
+			{
+				const size_t first = b * block_size;
+				const size_t last = std::min(n, first + block_size);
+
+				// Only the first piece continues a segment of the previous block
+				size_t seg = findSegment(segmentOffsets, first);
+				unsigned int carry = segmentOffsets[seg] < first ? _blockSums[b] : 0;
+				for (size_t start = first; start < last; seg++, carry = 0)
+				{
+					size_t end = last;
+					if (seg + 1 < segmentOffsets.size())
+						end = std::min<size_t>(end, segmentOffsets[seg + 1]);
+
+					if (inclusive)
+						scanRange<true>(dst.data() + start, src.data() + start, end - start, carry);
+					else
+						scanRange<false>(dst.data() + start, src.data() + start, end - start, carry);
+					start = end;
+				}
+			}
+		});
+	}
+}}}
@@ -0,0 +1,173 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <vector>
+
+// VCL
+#include <vcl/core/concurrency/threadpool.h>
+#include <vcl/core/span.h>
+
+namespace Vcl { namespace Core {
+	namespace Details {
+		/*!
+		 *	Multi-threaded prefix sum over unsigned integers.
+		 *
+		 *	The input is split into contiguous blocks. The sums of all blocks
+		 *	are computed in parallel, scanned sequentially and used as
+		 *	starting offsets while scanning the blocks in parallel.
+		 */
+		class ParallelScan
+		{
+		protected:
+			ParallelScan(unsigned int maxElements, ThreadPool& pool);
+
+			void scan(
+				stdext::span<unsigned int> dst,
+				stdext::span<const unsigned int> src,
+				unsigned int batchSize,
+				unsigned int arrayLength,
+				bool inclusive);
+
+			void scan(
+				stdext::span<unsigned int> dst,
+				stdext::span<const unsigned int> src,
+				stdext::span<const unsigned int> segmentOffsets,
+				unsigned int arrayLength,
+				bool inclusive);
+
+		private:
+			//! Pool executing the blocks
+			ThreadPool* _pool;
+
+			//! Maximum number of scanned entries
+			size_t _maxElements = 0;
+
+			//! Start offsets of uniformly sized segments
+			std::vector<unsigned int> _batchOffsets;
+
+			//! Carried sum of each block
+			std::vector<unsigned int> _blockSums;
+
+			//! Marks blocks containing the start of a segment
+			std::vector<unsigned char> _blockHeads;
+		};
+	}
+
+	/*!
+	 *	CPU counterpart of the GPU exclusive scan, computing
+	 *	dst[i] = src[0] + ... + src[i - 1].
+	 *	'dst' and 'src' may refer to the same memory.
+	 */
+	class ScanExclusive : private Details::ParallelScan
+	{
+	public:
+		ScanExclusive(unsigned int maxElements, ThreadPool& pool = ThreadPool::global())
+		: ParallelScan(maxElements, pool)
+		{
+		}
+
+	public:
+		void operator()(
+			stdext::span<unsigned int> dst,
+			stdext::span<const unsigned int> src,
+			unsigned int arrayLength)
+		{
+			scan(dst, src, 1, arrayLength, false);
+		}
+
+		//! Scans 'batchSize' consecutive arrays of 'arrayLength' entries each
+		void operator()(
+			stdext::span<unsigned int> dst,
+			stdext::span<const unsigned int> src,
+			unsigned int batchSize,
+			unsigned int arrayLength)
+		{
+			scan(dst, src, batchSize, arrayLength, false);
+		}
+
+		/*!
+		 *	Segmented scan restarting at every segment
+		 *
+		 *	\param segmentOffsets Sorted start index of each segment, beginning with 0
+		 *	\param arrayLength    Total number of entries of all segments
+		 */
+		void operator()(
+			stdext::span<unsigned int> dst,
+			stdext::span<const unsigned int> src,
+			stdext::span<const unsigned int> segmentOffsets,
+			unsigned int arrayLength)
+		{
+			scan(dst, src, segmentOffsets, arrayLength, false);
+		}
+	};
+
+	/*!
+	 *	Inclusive variant of the scan, computing
+	 *	dst[i] = src[0] + ... + src[i].
+	 *	'dst' and 'src' may refer to the same memory.
+	 */
+	class ScanInclusive : private Details::ParallelScan
+	{
+	public:
+		ScanInclusive(unsigned int maxElements, ThreadPool& pool = ThreadPool::global())
+		: ParallelScan(maxElements, pool)
+		{
+		}
+
+	public:
+		void operator()(
+			stdext::span<unsigned int> dst,
+			stdext::span<const unsigned int> src,
+			unsigned int arrayLength)
+		{
+			scan(dst, src, 1, arrayLength, true);
+		}
+
+		//! Scans 'batchSize' consecutive arrays of 'arrayLength' entries each
+		void operator()(
+			stdext::span<unsigned int> dst,
+			stdext::span<const unsigned int> src,
+			unsigned int batchSize,
+			unsigned int arrayLength)
+		{
+			scan(dst, src, batchSize, arrayLength, true);
+		}
+
+		//! Segmented scan restarting at every entry of 'segmentOffsets'
+		void operator()(
+			stdext::span<unsigned int> dst,
+			stdext::span<const unsigned int> src,
+			stdext::span<const unsigned int> segmentOffsets,
+			unsigned int arrayLength)
+		{
+			scan(dst, src, segmentOffsets, arrayLength, true);
+		}
+	};
+}}
@@ -0,0 +1,166 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+// VCL
+#include <vcl/core/concurrency/threadpool.h>
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Number of elements of type 'T' filling a cache-line. Using it as
+	 *	granularity of a parallel loop prevents false sharing between the
+	 *	tasks and always yields complete SIMD vectors, as no supported
+	 *	vector register is wider than a cache-line.
+	 */
+	template<typename T>
+	struct CacheLineGranularity
+	{
+		static const size_t value = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+	};
+
+	namespace Details {
+		//! Size of the ranges processed sequentially
+		inline size_t leafSize(const ThreadPool& pool, size_t size, size_t grain)
+		{
+			// Create a few tasks per worker to balance the load
+			const size_t tasks = 4 * static_cast<size_t>(pool.size());
+			const size_t leaf = (size + tasks - 1) / tasks;
+			return std::max(grain, (leaf + grain - 1) / grain * grain);
+		}
+
+		//! Split point of a range aligned to the granularity
+		inline size_t splitPoint(size_t begin, size_t end, size_t grain)
+		{
+			size_t mid = (begin + (end - begin) / 2) / grain * grain;
+			if (mid <= begin)
+				mid = (begin / grain + 1) * grain;
+
+			return mid;
+		}
+
+		template<typename Func>
+		void parallelFor(ThreadPool& pool, size_t begin, size_t end, size_t grain, size_t leaf, Func& func)
+		{
+			const size_t mid = splitPoint(begin, end, grain);
+			if (end - begin <= leaf || mid >= end)
+			{
+				func(begin, end);
+				return;
+			}
+
+			pool.invoke(
+				[&]() { parallelFor(pool, begin, mid, grain, leaf, func); },
+				[&]() { parallelFor(pool, mid, end, grain, leaf, func); });
+		}
+
+		template<typename T, typename Func, typename Reduce>
+		T parallelReduce(ThreadPool& pool, size_t begin, size_t end, size_t grain, size_t leaf, const T& identity, Func& func, Reduce& reduce)
+		{
+			const size_t mid = splitPoint(begin, end, grain);
+			if (end - begin <= leaf || mid >= end)
+				return func(begin, end, identity);
+
+			T lhs = identity;
+			T rhs = identity;
+			pool.invoke(
+				[&]() { lhs = parallelReduce(pool, begin, mid, grain, leaf, identity, func, reduce); },
+				[&]() { rhs = parallelReduce(pool, mid, end, grain, leaf, identity, func, reduce); });
+
+			return reduce(std::move(lhs), std::move(rhs));
+		}
+	}
+
+	/*!
+	 *	Execute 'func(first, last)' for disjoint sub-ranges covering [begin, end).
+	 *
+	 *	\param pool  Thread pool executing the loop
+	 *	\param begin First index of the range
+	 *	\param end   One past the last index of the range
+	 *	\param grain Sub-ranges are split at multiples of 'grain' only
+	 *	\param func  Function processing the sub-range [first, last)
+	 *
+	 *	The loop may be nested within other parallel loops.
+	 */
+	template<typename Func>
+	void parallel_for(ThreadPool& pool, size_t begin, size_t end, size_t grain, Func&& func)
+	{
+		VclRequire(begin <= end, "Range is valid.");
+		VclRequire(grain > 0, "Granularity is positive.");
+
+		if (begin == end)
+			return;
+
+		const size_t leaf = Details::leafSize(pool, end - begin, grain);
+		Details::parallelFor(pool, begin, end, grain, leaf, func);
+	}
+
+	template<typename Func>
+	void parallel_for(size_t begin, size_t end, size_t grain, Func&& func)
+	{
+		parallel_for(ThreadPool::global(), begin, end, grain, std::forward<Func>(func));
+	}
+
+	/*!
+	 *	Reduce the range [begin, end) in parallel.
+	 *
+	 *	\param pool     Thread pool executing the reduction
+	 *	\param begin    First index of the range
+	 *	\param end      One past the last index of the range
+	 *	\param grain    Sub-ranges are split at multiples of 'grain' only
+	 *	\param identity Identity element of the reduction
+	 *	\param func     Function accumulating the sub-range [first, last)
+	 *	                onto a value: 'T func(first, last, const T& init)'
+	 *	\param reduce   Associative function combining two partial results
+	 *
+	 *	The partial results are combined in the order of the sub-ranges.
+	 */
+	template<typename T, typename Func, typename Reduce>
+	T parallel_reduce(ThreadPool& pool, size_t begin, size_t end, size_t grain, const T& identity, Func&& func, Reduce&& reduce)
+	{
+		VclRequire(begin <= end, "Range is valid.");
+		VclRequire(grain > 0, "Granularity is positive.");
+
+		if (begin == end)
+			return identity;
+
+		const size_t leaf = Details::leafSize(pool, end - begin, grain);
+		return Details::parallelReduce(pool, begin, end, grain, leaf, identity, func, reduce);
+	}
+
+	template<typename T, typename Func, typename Reduce>
+	T parallel_reduce(size_t begin, size_t end, size_t grain, const T& identity, Func&& func, Reduce&& reduce)
+	{
+		return parallel_reduce(ThreadPool::global(), begin, end, grain, identity, std::forward<Func>(func), std::forward<Reduce>(reduce));
+	}
+}}
@@ -0,0 +1,268 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/concurrency/threadpool.h>
+
+// C++ standard library
+#include <algorithm>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	namespace {
+		//! Pool and index of the worker running on the current thread
+		struct WorkerIdentity
+		{
+			const ThreadPool* pool;
+			int index;
+		};
+		thread_local WorkerIdentity CurrentWorker = { nullptr, -1 };
+
+		//! Number of unsuccessful searches for work before a waiting worker blocks
+		constexpr int SpinLimit = 64;
+	}
+
+	ThreadPool::ThreadPool(unsigned int nr_threads)
+	{
+		if (nr_threads == 0)
+			nr_threads = std::max(1u, std::thread::hardware_concurrency());
+
+		mWorkers.reserve(nr_threads);
+		for (unsigned int i = 0; i < nr_threads; i++)
+			mWorkers.emplace_back(std::make_unique<Worker>());
+
+		// Start the threads only after all the deques are available for stealing
+		for (unsigned int i = 0; i < nr_threads; i++)
+			mWorkers[i]->thread = std::thread([this, i]() { run(i); });
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> guard{ mQueueLock };
+			mStop = true;
+		}
+		mWakeUp.notify_all();
+
+		for (auto& worker : mWorkers)
+			worker->thread.join();
+	}
+
+	ThreadPool& ThreadPool::global()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	int ThreadPool::currentWorker() const
+	{
+		return CurrentWorker.pool == this ? CurrentWorker.index : -1;
+	}
+
+	void ThreadPool::push(unsigned int idx, Task* task)
+	{
+		VclRequire(idx < mWorkers.size(), "Worker index is valid.");
+
+		Worker& worker = *mWorkers[idx];
+		{
+			std::lock_guard<std::mutex> guard{ worker.lock };
+			worker.tasks.push_back(task);
+		}
+		mPending++;
+		notify();
+	}
+
+	bool ThreadPool::tryPop(unsigned int idx, Task* task)
+	{
+		Worker& worker = *mWorkers[idx];
+		std::lock_guard<std::mutex> guard{ worker.lock };
+		if (!worker.tasks.empty() && worker.tasks.back() == task)
+		{
+			worker.tasks.pop_back();
+			mPending--;
+			return true;
+		}
+
+		return false;
+	}
+
+	void ThreadPool::wait(unsigned int idx, const Task& task)
+	{
+		int failed = 0;
+		while (!task.done())
+		{
+			bool shared = false;
+			if (Task* other = findWork(idx, shared))
+			{
+				executeTask(other, shared);
+				failed = 0;
+			}
+			else if (++failed < SpinLimit)
+			{
+				std::this_thread::yield();
+			}
+			else
+			{
+				// The task is executed by a thief, which may take long
+				block(task);
+				failed = 0;
+			}
+		}
+	}
+
+	void ThreadPool::block(const Task& task)
+	{
+		std::unique_lock<std::mutex> lock{ mQueueLock };
+		mBlocked++;
+		mSleeping++;
+
+		// Pairs with the fence in 'executeTask', so either the completion is
+		// observed here or the executing thread observes the blocked worker
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		mWakeUp.wait(lock, [this, &task]() { return task.done() || mPending.load() > 0; });
+
+		mSleeping--;
+		mBlocked--;
+	}
+
+	void ThreadPool::submit(Task* task)
+	{
+		std::unique_lock<std::mutex> lock{ mQueueLock };
+		mQueue.push_back(task);
+		mPending++;
+		mWakeUp.notify_one();
+
+		mCompleted.wait(lock, [task]() { return task->done(); });
+	}
+
+	Task* ThreadPool::findWork(unsigned int idx, bool& shared)
+	{
+		shared = false;
+		if (mPending.load() == 0)
+			return nullptr;
+
+		// Newest local task
+		{
+			Worker& worker = *mWorkers[idx];
+			std::lock_guard<std::mutex> guard{ worker.lock };
+			if (!worker.tasks.empty())
+			{
+				Task* task = worker.tasks.back();
+				worker.tasks.pop_back();
+				mPending--;
+				return task;
+			}
+		}
+
+		// Oldest task of another worker
+		const unsigned int nr_workers = size();
+		for (unsigned int i = 1; i < nr_workers; i++)
+		{
+			Worker& victim = *mWorkers[(idx + i) % nr_workers];
+			std::unique_lock<std::mutex> guard{ victim.lock, std::try_to_lock };
+			if (guard.owns_lock() && !victim.tasks.empty())
+			{
+				Task* task = victim.tasks.front();
+				victim.tasks.pop_front();
+				mPending--;
+				return task;
+			}
+		}
+
+		// Work submitted from outside the pool
+		{
+			std::lock_guard<std::mutex> guard{ mQueueLock };
+			if (!mQueue.empty())
+			{
+				Task* task = mQueue.front();
+				mQueue.pop_front();
+				mPending--;
+				shared = true;
+				return task;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void ThreadPool::executeTask(Task* task, bool shared)
+	{
+		task->execute();
+
+		// The submitting thread owns the task and may destroy it as soon as
+		// it observes the completion. Only the pool is accessed afterwards.
+		if (shared)
+		{
+			std::lock_guard<std::mutex> guard{ mQueueLock };
+			mCompleted.notify_all();
+			return;
+		}
+
+		// Wake up workers blocked on the completion of stolen tasks
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (mBlocked.load(std::memory_order_relaxed) > 0)
+		{
+			{
+				std::lock_guard<std::mutex> guard{ mQueueLock };
+			}
+			mWakeUp.notify_all();
+		}
+	}
+
+	void ThreadPool::run(unsigned int idx)
+	{
+		CurrentWorker = { this, static_cast<int>(idx) };
+
+		while (true)
+		{
+			bool shared = false;
+			if (Task* task = findWork(idx, shared))
+			{
+				executeTask(task, shared);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock{ mQueueLock };
+			mSleeping++;
+			mWakeUp.wait(lock, [this]() { return mStop || mPending.load() > 0; });
+			mSleeping--;
+
+			if (mStop && mPending.load() == 0)
+				break;
+		}
+	}
+
+	void ThreadPool::notify()
+	{
+		// Pairs with the check of 'mPending' in 'run' while holding the lock
+		if (mSleeping.load() > 0)
+		{
+			{
+				std::lock_guard<std::mutex> guard{ mQueueLock };
+			}
+			mWakeUp.notify_one();
+		}
+	}
+}}
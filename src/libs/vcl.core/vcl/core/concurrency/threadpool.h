@@ -0,0 +1,261 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Unit of work executed by the ThreadPool.
+	 *	Tasks are owned by the code spawning them and have to stay alive
+	 *	until they are completed.
+	 */
+	class Task
+	{
+	public:
+		using Function = void (*)(void*);
+
+		Task(Function func, void* ctx)
+		: mFunc(func)
+		, mCtx(ctx)
+		{
+		}
+
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+
+		//! Run the task and store a potentially thrown exception
+		void execute() noexcept
+		{
+			try
+			{
+				mFunc(mCtx);
+			}
+			catch (...)
+			{
+				mError = std::current_exception();
+			}
+			mDone.store(true, std::memory_order_release);
+		}
+
+		bool done() const noexcept
+		{
+			return mDone.load(std::memory_order_acquire);
+		}
+
+		//! Rethrow the exception raised during the execution
+		void rethrow() const
+		{
+			if (mError)
+				std::rethrow_exception(mError);
+		}
+
+	private:
+		//! Function to call
+		Function mFunc;
+		//! Context passed to the function
+		void* mCtx;
+		//! Error raised while executing the function
+		std::exception_ptr mError;
+		//! Completion flag
+		std::atomic<bool> mDone{ false };
+	};
+
+	/*!
+	 *	Work-stealing thread pool executing fork-join style parallelism.
+	 *
+	 *	Every worker owns a deque of tasks. New tasks are pushed to the back
+	 *	of the local deque and popped from there again (LIFO), while idle
+	 *	workers steal the oldest, and thus typically largest, tasks from the
+	 *	front of other deques. A worker waiting for a stolen task executes
+	 *	other pending work, which allows arbitrarily nested parallelism.
+	 *	If no work is left to help with, it blocks until the task completes.
+	 *	Threads outside of the pool submit their work to a shared queue and
+	 *	block until it is completed.
+	 */
+	class ThreadPool
+	{
+	public:
+		/*!
+		 *	\param nr_threads Number of worker threads. 0 selects the number
+		 *	                  of hardware threads.
+		 */
+		explicit ThreadPool(unsigned int nr_threads = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		//! Process wide thread pool using all hardware threads
+		static ThreadPool& global();
+
+		//! Number of worker threads
+		unsigned int size() const { return static_cast<unsigned int>(mWorkers.size()); }
+
+		//! Index of the calling worker in this pool, -1 for other threads
+		int currentWorker() const;
+
+		/*!
+		 *	Execute two functions, potentially in parallel, and return when
+		 *	both are completed. Exceptions thrown by either are propagated.
+		 */
+		template<typename F0, typename F1>
+		void invoke(F0&& f0, F1&& f1);
+
+		/*!
+		 *	Execute a function on the thread pool and return when it is completed.
+		 */
+		template<typename Func>
+		void execute(Func&& func);
+
+	private:
+		//! Thread local task storage
+		struct Worker
+		{
+			std::mutex lock;
+			std::deque<Task*> tasks;
+			std::thread thread;
+		};
+
+		//! Push a task to the deque of the worker 'idx'
+		void push(unsigned int idx, Task* task);
+
+		//! Remove the task from the back of the local deque if it was not stolen
+		bool tryPop(unsigned int idx, Task* task);
+
+		//! Execute pending tasks until the task is completed
+		void wait(unsigned int idx, const Task& task);
+
+		//! Block until the task is completed or new work becomes available
+		void block(const Task& task);
+
+		//! Submit a task from a thread outside of the pool and wait for its completion
+		void submit(Task* task);
+
+		//! Find a task, either locally, from the shared queue or by stealing
+		Task* findWork(unsigned int idx, bool& shared);
+
+		//! Execute a task and signal the completion of submitted tasks
+		void executeTask(Task* task, bool shared);
+
+		//! Main loop of each worker
+		void run(unsigned int idx);
+
+		//! Wake up sleeping workers after new work became available
+		void notify();
+
+	private:
+		//! Per thread data
+		std::vector<std::unique_ptr<Worker>> mWorkers;
+
+		//! Tasks submitted by threads outside of the pool
+		std::deque<Task*> mQueue;
+
+		//! Lock protecting the shared queue and the sleep state
+		std::mutex mQueueLock;
+
+		//! Signal idle workers
+		std::condition_variable mWakeUp;
+
+		//! Signal the completion of submitted tasks
+		std::condition_variable mCompleted;
+
+		//! Number of tasks queued in any of the deques
+		std::atomic<int> mPending{ 0 };
+
+		//! Number of workers waiting for new work
+		std::atomic<int> mSleeping{ 0 };
+
+		//! Number of workers blocked on the completion of a stolen task
+		std::atomic<int> mBlocked{ 0 };
+
+		//! Signal to terminate the workers
+		bool mStop{ false };
+	};
+
+	template<typename F0, typename F1>
+	void ThreadPool::invoke(F0&& f0, F1&& f1)
+	{
+		const int idx = currentWorker();
+		if (idx < 0)
+		{
+			execute([&f0, &f1, this]() { invoke(f0, f1); });
+			return;
+		}
+
+		using Callable = typename std::remove_reference<F1>::type;
+		Task task{ [](void* ctx) { (*static_cast<Callable*>(ctx))(); }, const_cast<void*>(static_cast<const void*>(std::addressof(f1))) };
+		push(static_cast<unsigned int>(idx), &task);
+
+		// The spawned task references the stack and has to be completed
+		// before leaving, even if the inline part throws.
+		std::exception_ptr error;
+		try
+		{
+			f0();
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+
+		if (tryPop(static_cast<unsigned int>(idx), &task))
+			task.execute();
+		else
+			wait(static_cast<unsigned int>(idx), task);
+
+		if (error)
+			std::rethrow_exception(error);
+		task.rethrow();
+	}
+
+	template<typename Func>
+	void ThreadPool::execute(Func&& func)
+	{
+		using Callable = typename std::remove_reference<Func>::type;
+		Task task{ [](void* ctx) { (*static_cast<Callable*>(ctx))(); }, const_cast<void*>(static_cast<const void*>(std::addressof(func))) };
+
+		const int idx = currentWorker();
+		if (idx >= 0)
+			task.execute();
+		else
+			submit(&task);
+
+		task.rethrow();
+	}
+}}
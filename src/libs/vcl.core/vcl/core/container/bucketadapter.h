@@ -29,27 +29,53 @@
 
 // C++ standard library
 #include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // VCL
+#include <vcl/core/concurrency/parallel.h>
+#include <vcl/core/simd/algorithm.h>
 #include <vcl/core/contract.h>
+#include <vcl/core/span.h>
 
 namespace Vcl { namespace Core {
+	namespace Details {
+		//! Keys which can be compared using the SIMD vector types
+		template<typename Key>
+		struct IsVectorizableKey : std::integral_constant<
+			bool,
+			std::is_same<Key, float>::value || std::is_same<Key, double>::value || std::is_same<Key, int>::value>
+		{
+		};
+	}
+
 	/*!
+	 *	Maintains the 'k' best elements pushed to a container, where 'k'
+	 *	is the capacity of the container. An element 'a' is better than
+	 *	'b' if 'Compare(a, b)' holds, thus by default the smallest
+	 *	elements are kept.
+	 *
 	 *	\note The heap order is ignored until the maximum size is reached
 	 */
-	template<typename T>
+	template<typename T, typename Compare = std::less<T>>
 	class bucket_adapter
 	{
 	public:
-		bucket_adapter(std::vector<T>& cont)
+		bucket_adapter(std::vector<T>& cont, Compare comp = Compare())
 		: _data(cont)
+		, _comp(comp)
 		{
+			VclRequire(cont.capacity() > 0, "Container has reserved space for the entries.");
 		}
 
 		/*!
 		 *	\brief Add a new entry.
 		 *
+		 *	Once the maximum size is reached, entries which are not better
+		 *	than the current top are discarded.
+		 *
 		 *	\note The heap order is ignored until the maximum size is reached
 		 */
 		void push(const T& v)
@@ -59,21 +85,56 @@ namespace Vcl { namespace Core {
 				_data.emplace_back(v);
 				if (_data.size() == _data.capacity())
 				{
-					std::make_heap(std::begin(_data), std::end(_data));
+					std::make_heap(std::begin(_data), std::end(_data), _comp);
 				}
-			} else
+			} else if (_comp(v, _data.front()))
 			{
-				// Remove the element with the least priority
-				std::pop_heap(std::begin(_data), std::end(_data));
-				_data.pop_back();
-
-				// Add the new element
-				_data.emplace_back(v);
-				std::push_heap(std::begin(_data), std::end(_data));
+				replaceTop(v);
 			}
 		}
 
-		//! \returns the element with the highest priority
+		/*!
+		 *	\brief Add a range of entries.
+		 *
+		 *	Once the maximum size is reached, arithmetic entries ordered by
+		 *	'std::less' are compared in blocks against the current top
+		 *	using SIMD instructions. Only blocks containing a better entry
+		 *	touch the heap.
+		 */
+		void push(stdext::span<const T> values)
+		{
+			pushRange(values, std::integral_constant<bool, Details::IsVectorizableKey<T>::value && std::is_same<Compare, std::less<T>>::value>{});
+		}
+
+		/*!
+		 *	\brief Add a range of entries identified by their keys.
+		 *
+		 *	\param keys Keys of the candidates
+		 *	\param proj Function returning the key of a stored entry
+		 *	\param make Function creating the entry 'make(i)' for 'keys[i]'
+		 *
+		 *	The order of the entries needs to agree with the keys, i.e.
+		 *	'Compare(a, b)' holds iff 'proj(a) < proj(b)'. This allows to
+		 *	filter the candidates of a k-nearest-neighbour query by their
+		 *	distance before creating the entries.
+		 */
+		template<typename Key, typename Proj, typename Make>
+		void push(stdext::span<Key> keys, Proj proj, Make make)
+		{
+			size_t i = 0;
+			for (; i < keys.size() && _data.size() < _data.capacity(); i++)
+				push(make(i));
+
+			filter(stdext::span<const std::remove_const_t<Key>>{ keys }, i, proj, make, Details::IsVectorizableKey<std::remove_const_t<Key>>{});
+		}
+
+		//! Add all entries of 'other'
+		void merge(const bucket_adapter& other)
+		{
+			push(stdext::make_span(other._data));
+		}
+
+		//! \returns the element with the highest priority, i.e. the worst element of the set
 		const T& top()
 		{
 			VclRequire(_data.size() == _data.capacity(), "Set has reached the maximum limit.");
@@ -87,9 +148,138 @@ namespace Vcl { namespace Core {
 			return _data.size();
 		}
 
+		//! \returns a copy of the entries sorted from best to worst
+		std::vector<T> sorted() const
+		{
+			// Use the heap order if it was established already
+			std::vector<T> result(_data);
+			if (result.size() == _data.capacity())
+				std::sort_heap(std::begin(result), std::end(result), _comp);
+			else
+				std::sort(std::begin(result), std::end(result), _comp);
+
+			return result;
+		}
+
 		std::vector<T>& container() { return _data; }
 
+	private:
+		//! Replace the top element by a better one, restoring the heap order in a single pass
+		void replaceTop(const T& v)
+		{
+			const size_t n = _data.size();
+			size_t i = 0;
+			for (;;)
+			{
+				size_t child = 2 * i + 1;
+				if (child >= n)
+					break;
+				if (child + 1 < n && _comp(_data[child], _data[child + 1]))
+					child++;
+				if (!_comp(v, _data[child]))
+					break;
+
+				_data[i] = std::move(_data[child]);
+				i = child;
+			}
+			_data[i] = v;
+		}
+
+		void pushRange(stdext::span<const T> values, std::false_type)
+		{
+			for (const auto& v : values)
+				push(v);
+		}
+
+		void pushRange(stdext::span<const T> values, std::true_type)
+		{
+			push(
+				values, [](const T& v) { return v; }, [values](size_t i) { return values[i]; });
+		}
+
+		template<typename Key, typename Proj, typename Make>
+		void filter(stdext::span<const Key> keys, size_t i, Proj& proj, Make& make, std::false_type)
+		{
+			for (; i < keys.size(); i++)
+			{
+				if (keys[i] < proj(_data.front()))
+					replaceTop(make(i));
+			}
+		}
+
+		template<typename Key, typename Proj, typename Make>
+		void filter(stdext::span<const Key> keys, size_t i, Proj& proj, Make& make, std::true_type)
+		{
+			using namespace Simd;
+
+			using vector_t = VectorScalar<Key, NativeWidth<Key>::value>;
+			const size_t width = NativeWidth<Key>::value;
+
+			if (i >= keys.size())
+				return;
+
+			Key threshold = proj(_data.front());
+			for (; i + width <= keys.size(); i += width)
+			{
+				vector_t v;
+				load(v, keys.data() + i);
+				if (!any(v < vector_t(threshold)))
+					continue;
+
+				// The threshold tightens with every accepted entry
+				for (size_t j = i; j < i + width; j++)
+				{
+					if (keys[j] < threshold)
+					{
+						replaceTop(make(j));
+						threshold = proj(_data.front());
+					}
+				}
+			}
+			filter(keys, i, proj, make, std::false_type{});
+		}
+
 	private:
 		std::vector<T>& _data;
+		Compare _comp;
 	};
+
+	/*!
+	 *	\brief Select the 'k' best entries of 'values' in parallel.
+	 *
+	 *	Each task collects the best entries of a partition of 'values'
+	 *	in its own heap, the heaps are merged pair-wise afterwards.
+	 *
+	 *	\returns the selected entries sorted from best to worst
+	 */
+	template<typename T, typename Compare = std::less<T>>
+	std::vector<T> top_k(ThreadPool& pool, stdext::span<const T> values, size_t k, Compare comp = Compare())
+	{
+		if (k == 0)
+			return {};
+
+		const size_t grain = std::max<size_t>(k, 4096);
+		std::vector<T> best = parallel_reduce(
+			pool, 0, values.size(), grain, std::vector<T>{},
+			[values, k, comp](size_t first, size_t last, const std::vector<T>&) {
+				std::vector<T> heap;
+				heap.reserve(k);
+				bucket_adapter<T, Compare>{ heap, comp }.push(stdext::make_span(values.data() + first, last - first));
+				return heap;
+			},
+			[k, comp](std::vector<T>&& a, std::vector<T>&& b) {
+				a.reserve(k);
+				bucket_adapter<T, Compare>{ a, comp }.push(stdext::make_span(static_cast<const std::vector<T>&>(b)));
+				return std::move(a);
+			});
+
+		best.reserve(k);
+		return bucket_adapter<T, Compare>{ best, comp }.sorted();
+	}
+
+	template<typename T, typename Compare = std::less<T>>
+	std::vector<T> top_k(stdext::span<const T> values, size_t k, Compare comp = Compare())
+	{
+		return top_k(ThreadPool::global(), values, k, comp);
+	}
 }}
@@ -0,0 +1,234 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// VCL
+#include <vcl/core/container/packedbitvector.h>
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Resettable flag vector which can be shared between threads.
+	 *
+	 *	Bits are packed into 64-bit atomic words. The lower 48 bits of
+	 *	a word store flags, the upper 16 bits store the generation the
+	 *	word was last written in. A word tagged with an outdated
+	 *	generation reads as all 'false', thus resetting the entire vector
+	 *	is a single atomic store of the new generation.
+	 *
+	 *	Concurrent calls to 'test', 'set', 'testAndSet' and 'reset' are
+	 *	safe. 'resetAllBitsToFalse' may run concurrently with readers,
+	 *	which observe per word either the state before or after the reset.
+	 *	It must not overlap with concurrent writers.
+	 *	Resizing is not thread-safe.
+	 */
+	class ConcurrentBitVector
+	{
+	public:
+		//! Number of flags stored per word
+		static const size_t BitsPerWord = 48;
+
+	private:
+		static const uint64_t DataMask = (uint64_t(1) << BitsPerWord) - 1;
+		static const uint64_t MaxGeneration = 0xffff;
+
+	public:
+		ConcurrentBitVector() = default;
+
+		explicit ConcurrentBitVector(size_t n)
+		{
+			assign(n);
+		}
+
+		ConcurrentBitVector(const ConcurrentBitVector&) = delete;
+		ConcurrentBitVector& operator=(const ConcurrentBitVector&) = delete;
+
+	public: // Element access
+		//! \returns the state of the bit 'idx'
+		bool test(size_t idx) const noexcept
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			const uint64_t tag = _generation.load(std::memory_order_acquire) << BitsPerWord;
+			const uint64_t word = _words[idx / BitsPerWord].load(std::memory_order_acquire);
+			return (word & ~DataMask) == tag && (word & mask(idx)) != 0;
+		}
+
+		bool operator[](size_t idx) const noexcept
+		{
+			return test(idx);
+		}
+
+	public: // Modifiers
+		/*!
+		 *	Atomically set the bit 'idx'.
+		 *	\returns the previous state of the bit. Among concurrent callers
+		 *	         on the same bit exactly one observes 'false'.
+		 */
+		bool testAndSet(size_t idx) noexcept
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			const uint64_t tag = _generation.load(std::memory_order_acquire) << BitsPerWord;
+			const uint64_t bit = mask(idx);
+			std::atomic<uint64_t>& word = _words[idx / BitsPerWord];
+
+			uint64_t curr = word.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				if ((curr & ~DataMask) == tag)
+				{
+					// Common case: the word belongs to the current generation
+					const uint64_t prev = word.fetch_or(bit, std::memory_order_acq_rel);
+					if ((prev & ~DataMask) == tag)
+						return (prev & bit) != 0;
+
+					curr = prev | bit;
+				} else if (word.compare_exchange_weak(curr, tag | bit, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					// First write to the word in this generation
+					return false;
+				}
+			}
+		}
+
+		void set(size_t idx) noexcept
+		{
+			testAndSet(idx);
+		}
+
+		//! Atomically clear the bit 'idx'
+		void reset(size_t idx) noexcept
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			const uint64_t tag = _generation.load(std::memory_order_acquire) << BitsPerWord;
+			std::atomic<uint64_t>& word = _words[idx / BitsPerWord];
+
+			// Words of older generations read as 'false' already
+			if ((word.load(std::memory_order_relaxed) & ~DataMask) == tag)
+				word.fetch_and(~mask(idx), std::memory_order_acq_rel);
+		}
+
+		/*!
+		 *	Clear all bits by advancing the generation. Only when the
+		 *	generation counter wraps are the words cleared explicitly.
+		 */
+		void resetAllBitsToFalse() noexcept
+		{
+			const uint64_t gen = _generation.load(std::memory_order_relaxed);
+			if (gen == MaxGeneration)
+			{
+				for (size_t i = 0; i < nrWords(); i++)
+					_words[i].store(0, std::memory_order_relaxed);
+
+				_generation.store(1, std::memory_order_release);
+			} else
+			{
+				_generation.store(gen + 1, std::memory_order_release);
+			}
+		}
+
+		//! Resize the vector to 'n' bits, all 'false'. Not thread-safe.
+		void assign(size_t n)
+		{
+			if (nrWords(n) != nrWords())
+				_words.reset(nrWords(n) > 0 ? new std::atomic<uint64_t>[nrWords(n)] : nullptr);
+
+			_size = n;
+			for (size_t i = 0; i < nrWords(); i++)
+				_words[i].store(0, std::memory_order_relaxed);
+
+			_generation.store(1, std::memory_order_release);
+		}
+
+		//! Release all memory. Not thread-safe.
+		void clear()
+		{
+			_words.reset();
+			_size = 0;
+		}
+
+	public:
+		size_t size() const noexcept
+		{
+			return _size;
+		}
+
+		uint16_t generation() const noexcept
+		{
+			return static_cast<uint16_t>(_generation.load(std::memory_order_acquire));
+		}
+
+		//! \returns the number of set bits
+		size_t count() const noexcept
+		{
+			const uint64_t tag = _generation.load(std::memory_order_acquire) << BitsPerWord;
+
+			size_t nr_bits = 0;
+			for (size_t i = 0; i < nrWords(); i++)
+			{
+				const uint64_t word = _words[i].load(std::memory_order_acquire);
+				if ((word & ~DataMask) == tag)
+					nr_bits += static_cast<size_t>(Details::popcount(word & DataMask));
+			}
+			return nr_bits;
+		}
+
+	private:
+		static uint64_t mask(size_t idx) noexcept
+		{
+			return uint64_t(1) << (idx % BitsPerWord);
+		}
+
+		static size_t nrWords(size_t n) noexcept
+		{
+			return (n + BitsPerWord - 1) / BitsPerWord;
+		}
+
+		size_t nrWords() const noexcept
+		{
+			return nrWords(_size);
+		}
+
+	private:
+		//! Generation indicating valid words
+		std::atomic<uint64_t> _generation{ 1 };
+
+		//! Number of bits
+		size_t _size{ 0 };
+
+		//! Packed bits with their generation tag
+		std::unique_ptr<std::atomic<uint64_t>[]> _words;
+	};
+}}
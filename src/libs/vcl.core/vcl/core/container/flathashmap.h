@@ -0,0 +1,909 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// VCL
+#include <vcl/core/container/packedbitvector.h>
+#include <vcl/core/contract.h>
+#include <vcl/core/string_view.h>
+#include <vcl/util/hashedstring.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Transparent string hash producing the same values as Util::StringHash.
+	 *	Allows looking up string keys by string views or C-strings, or by
+	 *	a hash computed ahead of time.
+	 */
+	struct StringHasher
+	{
+		using is_transparent = void;
+
+		size_t operator()(stdext::string_view str) const noexcept
+		{
+			return Util::calculateFnv1a32(str.data(), str.size());
+		}
+	};
+
+	//! Transparent string comparison accompanying 'StringHasher'
+	struct StringEqual
+	{
+		using is_transparent = void;
+
+		bool operator()(stdext::string_view a, stdext::string_view b) const noexcept
+		{
+			return a == b;
+		}
+	};
+
+	namespace Details {
+		//! Control byte of a slot. Full slots store 7 bits of the hash.
+		using HashCtrl = int8_t;
+		const HashCtrl CtrlEmpty = -128;
+		const HashCtrl CtrlDeleted = -2;
+		const HashCtrl CtrlSentinel = -1;
+
+		VCL_STRONG_INLINE bool isFull(HashCtrl c) noexcept { return c >= 0; }
+
+		//! Number of leading zeros in a mask of 16 bits. 'mask' must not be zero.
+		VCL_STRONG_INLINE int countLeadingZeros16(uint32_t mask) noexcept
+		{
+#if defined(VCL_COMPILER_MSVC)
+			unsigned long idx;
+			_BitScanReverse(&idx, mask);
+			return 15 - static_cast<int>(idx);
+#else
+			return __builtin_clz(mask) - 16;
+#endif
+		}
+
+		/*!
+		 *	Group of control bytes probed at once. Each query returns
+		 *	a mask with a bit set for every matching slot.
+		 */
+		class HashGroup
+		{
+		public:
+			static const size_t Width = 16;
+
+			explicit HashGroup(const HashCtrl* pos) noexcept
+			{
+#if defined(VCL_VECTORIZE_SSE2)
+				_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+#else
+				std::memcpy(_ctrl, pos, sizeof(_ctrl));
+#endif
+			}
+
+			//! Full slots storing 'h'
+			uint32_t match(HashCtrl h) const noexcept
+			{
+#if defined(VCL_VECTORIZE_SSE2)
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), _ctrl)));
+#else
+				uint32_t mask = 0;
+				for (int i = 0; i < 16; i++)
+					mask |= (_ctrl[i] == h ? 1u : 0u) << i;
+				return mask;
+#endif
+			}
+
+			uint32_t matchEmpty() const noexcept
+			{
+				return match(CtrlEmpty);
+			}
+
+			uint32_t matchEmptyOrDeleted() const noexcept
+			{
+#if defined(VCL_VECTORIZE_SSE2)
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(CtrlSentinel), _ctrl)));
+#else
+				uint32_t mask = 0;
+				for (int i = 0; i < 16; i++)
+					mask |= (_ctrl[i] < CtrlSentinel ? 1u : 0u) << i;
+				return mask;
+#endif
+			}
+
+		private:
+#if defined(VCL_VECTORIZE_SSE2)
+			__m128i _ctrl;
+#else
+			HashCtrl _ctrl[16];
+#endif
+		};
+
+		//! Control bytes of a table without any slots
+		inline HashCtrl* emptyHashGroup() noexcept
+		{
+			alignas(16) static const HashCtrl group[16] = {
+				CtrlSentinel, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty,
+				CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty, CtrlEmpty
+			};
+			return const_cast<HashCtrl*>(group);
+		}
+
+		template<typename T>
+		struct AlwaysVoid
+		{
+			using type = void;
+		};
+
+		template<typename H, typename = void>
+		struct IsTransparent : std::false_type
+		{
+		};
+		template<typename H>
+		struct IsTransparent<H, typename AlwaysVoid<typename H::is_transparent>::type> : std::true_type
+		{
+		};
+
+		//! Selects the argument type of lookups. Deducing 'K' requires the alias to map to it directly.
+		template<bool Transparent>
+		struct KeyArgSelector
+		{
+			template<typename K, typename Key>
+			using type = K;
+		};
+		template<>
+		struct KeyArgSelector<false>
+		{
+			template<typename K, typename Key>
+			using type = Key;
+		};
+
+		template<typename K, typename V>
+		struct FlatHashMapPolicy
+		{
+			using key_type = K;
+			using value_type = std::pair<const K, V>;
+
+			//! Entries can be modified through iterators
+			static const bool MutableValues = true;
+
+			static const K& key(const value_type& value) noexcept { return value.first; }
+		};
+
+		template<typename T>
+		struct FlatHashSetPolicy
+		{
+			using key_type = T;
+			using value_type = T;
+
+			//! Entries can be modified through iterators
+			static const bool MutableValues = false;
+
+			static const T& key(const value_type& value) noexcept { return value; }
+		};
+
+		/*!
+		 *	Open-addressing hash table storing its entries in a flat array.
+		 *
+		 *	Every slot is accompanied by a control byte marking it as empty,
+		 *	deleted or full. Full slots store the lower 7 bits of the hash,
+		 *	while the upper bits select the start of the probe sequence.
+		 *	Lookups compare the control bytes of 16 slots at once and only
+		 *	compare the keys of slots with matching hash bits.
+		 *
+		 *	The capacity is always a power of two minus one. The control
+		 *	bytes are followed by a sentinel and a copy of the first bytes,
+		 *	such that groups can be loaded at every position.
+		 *
+		 *	Inserting entries may move existing ones, invalidating all
+		 *	iterators, pointers and references to entries.
+		 */
+		template<typename Policy, typename Hash, typename Eq, typename Alloc>
+		class FlatHashTable
+		{
+		public:
+			using key_type = typename Policy::key_type;
+			using value_type = typename Policy::value_type;
+			using size_type = size_t;
+			using hasher = Hash;
+			using key_equal = Eq;
+			using allocator_type = Alloc;
+
+		private:
+			using SlotAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+			using SlotTraits = std::allocator_traits<SlotAlloc>;
+			using CtrlAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<HashCtrl>;
+			using CtrlTraits = std::allocator_traits<CtrlAlloc>;
+
+		protected:
+			//! Lookups accept any key type if both hash and comparison are transparent
+			template<typename K>
+			using KeyArg = typename KeyArgSelector<IsTransparent<Hash>::value && IsTransparent<Eq>::value>::template type<K, key_type>;
+
+		public:
+			template<bool Const>
+			class Iterator
+			{
+				friend class FlatHashTable;
+
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = typename Policy::value_type;
+				using difference_type = ptrdiff_t;
+				using reference = typename std::conditional<Const, const value_type&, value_type&>::type;
+				using pointer = typename std::conditional<Const, const value_type*, value_type*>::type;
+
+				Iterator() = default;
+
+				//! Conversion to a constant iterator
+				template<bool C = Const, typename = typename std::enable_if<C>::type>
+				Iterator(const Iterator<false>& other) noexcept
+				: _ctrl(other._ctrl)
+				, _slot(other._slot)
+				{
+				}
+
+				reference operator*() const noexcept { return *_slot; }
+				pointer operator->() const noexcept { return _slot; }
+
+				Iterator& operator++() noexcept
+				{
+					++_ctrl;
+					++_slot;
+					skipEmptyOrDeleted();
+					return *this;
+				}
+				Iterator operator++(int) noexcept
+				{
+					auto tmp = *this;
+					++*this;
+					return tmp;
+				}
+
+				friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a._ctrl == b._ctrl; }
+				friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return a._ctrl != b._ctrl; }
+
+			private:
+				template<bool>
+				friend class Iterator;
+
+				Iterator(HashCtrl* ctrl, value_type* slot) noexcept
+				: _ctrl(ctrl)
+				, _slot(slot)
+				{
+				}
+
+				//! Advance to the next full slot or the sentinel
+				void skipEmptyOrDeleted() noexcept
+				{
+					while (*_ctrl < CtrlSentinel)
+					{
+						++_ctrl;
+						++_slot;
+					}
+				}
+
+				HashCtrl* _ctrl{ nullptr };
+				value_type* _slot{ nullptr };
+			};
+
+			using iterator = Iterator<!Policy::MutableValues>;
+			using const_iterator = Iterator<true>;
+
+		public:
+			explicit FlatHashTable(size_t bucket_count = 0, const Hash& hash = Hash(), const Eq& eq = Eq(), const Alloc& alloc = Alloc())
+			: _hash(hash)
+			, _eq(eq)
+			, _alloc(alloc)
+			{
+				if (bucket_count > 0)
+					initialize(normalizeCapacity(bucket_count));
+			}
+
+			FlatHashTable(const FlatHashTable& other)
+			: FlatHashTable(0, other._hash, other._eq, std::allocator_traits<Alloc>::select_on_container_copy_construction(other._alloc))
+			{
+				reserve(other.size());
+				for (const auto& value : other)
+				{
+					const size_t hash = hashOf(Policy::key(value));
+					const size_t i = prepareInsert(hash);
+					constructAt(i, value);
+				}
+			}
+
+			FlatHashTable(FlatHashTable&& other) noexcept
+			: _ctrl(other._ctrl)
+			, _slots(other._slots)
+			, _size(other._size)
+			, _capacity(other._capacity)
+			, _growthLeft(other._growthLeft)
+			, _hash(std::move(other._hash))
+			, _eq(std::move(other._eq))
+			, _alloc(std::move(other._alloc))
+			{
+				other.reset();
+			}
+
+			FlatHashTable& operator=(const FlatHashTable& other)
+			{
+				if (this != &other)
+				{
+					FlatHashTable tmp{ other };
+					swap(tmp);
+				}
+				return *this;
+			}
+
+			FlatHashTable& operator=(FlatHashTable&& other) noexcept
+			{
+				if (this != &other)
+				{
+					destroyAll();
+					deallocate();
+
+					_ctrl = other._ctrl;
+					_slots = other._slots;
+					_size = other._size;
+					_capacity = other._capacity;
+					_growthLeft = other._growthLeft;
+					_hash = std::move(other._hash);
+					_eq = std::move(other._eq);
+					_alloc = std::move(other._alloc);
+					other.reset();
+				}
+				return *this;
+			}
+
+			~FlatHashTable()
+			{
+				destroyAll();
+				deallocate();
+			}
+
+		public: // Iterators
+			iterator begin() noexcept
+			{
+				iterator it{ _ctrl, _slots };
+				it.skipEmptyOrDeleted();
+				return it;
+			}
+			iterator end() noexcept { return { _ctrl + _capacity, nullptr }; }
+
+			const_iterator begin() const noexcept { return const_cast<FlatHashTable*>(this)->begin(); }
+			const_iterator end() const noexcept { return const_cast<FlatHashTable*>(this)->end(); }
+			const_iterator cbegin() const noexcept { return begin(); }
+			const_iterator cend() const noexcept { return end(); }
+
+		public: // Capacity
+			bool empty() const noexcept { return _size == 0; }
+			size_t size() const noexcept { return _size; }
+
+			//! Number of slots
+			size_t capacity() const noexcept { return _capacity; }
+
+			//! Allocate enough slots to store 'n' entries without rehashing
+			void reserve(size_t n)
+			{
+				if (n > _size + _growthLeft)
+					resize(normalizeCapacity(n + (n - 1) / 7));
+			}
+
+		public: // Modifiers
+			//! Remove all entries, keeping the allocated slots
+			void clear() noexcept
+			{
+				destroyAll();
+				if (_capacity > 0)
+					resetCtrl();
+				_size = 0;
+			}
+
+			std::pair<iterator, bool> insert(const value_type& value)
+			{
+				return emplaceUnique(Policy::key(value), value);
+			}
+
+			std::pair<iterator, bool> insert(value_type&& value)
+			{
+				return emplaceUnique(Policy::key(value), std::move(value));
+			}
+
+			template<typename InputIt>
+			void insert(InputIt first, InputIt last)
+			{
+				for (; first != last; ++first)
+					insert(*first);
+			}
+
+			iterator erase(const_iterator pos)
+			{
+				VclRequire(pos != end(), "Iterator points to an entry.");
+
+				eraseAt(static_cast<size_t>(pos._slot - _slots));
+				iterator next{ pos._ctrl + 1, pos._slot + 1 };
+				next.skipEmptyOrDeleted();
+				return next;
+			}
+
+			//! Erase by key. Iterators are excluded as transparent keys, such that they select the overload above.
+			template<typename K = key_type, typename = typename std::enable_if<!std::is_convertible<const K&, const_iterator>::value>::type>
+			size_t erase(const KeyArg<K>& key)
+			{
+				const size_t i = findIndex(key, hashOf(key));
+				if (i == npos)
+					return 0;
+
+				eraseAt(i);
+				return 1;
+			}
+
+			void swap(FlatHashTable& other) noexcept
+			{
+				using std::swap;
+				swap(_ctrl, other._ctrl);
+				swap(_slots, other._slots);
+				swap(_size, other._size);
+				swap(_capacity, other._capacity);
+				swap(_growthLeft, other._growthLeft);
+				swap(_hash, other._hash);
+				swap(_eq, other._eq);
+				swap(_alloc, other._alloc);
+			}
+
+		public: // Lookup
+			template<typename K = key_type>
+			iterator find(const KeyArg<K>& key)
+			{
+				return iteratorAt(findIndex(key, hashOf(key)));
+			}
+
+			template<typename K = key_type>
+			const_iterator find(const KeyArg<K>& key) const
+			{
+				return const_cast<FlatHashTable*>(this)->find(key);
+			}
+
+			/*!
+			 *	Look up an entry using a hash computed ahead of time, for
+			 *	example by Util::StringHash together with StringHasher.
+			 *	'hash' must be the value of 'hash_function()(key)'.
+			 */
+			template<typename K = key_type>
+			iterator find(const KeyArg<K>& key, size_t hash)
+			{
+				VclRequire(hash == _hash(key), "Hash belongs to the key.");
+				return iteratorAt(findIndex(key, mix(hash)));
+			}
+
+			template<typename K = key_type>
+			const_iterator find(const KeyArg<K>& key, size_t hash) const
+			{
+				return const_cast<FlatHashTable*>(this)->find(key, hash);
+			}
+
+			template<typename K = key_type>
+			bool contains(const KeyArg<K>& key) const
+			{
+				return findIndex(key, hashOf(key)) != npos;
+			}
+
+			template<typename K = key_type>
+			size_t count(const KeyArg<K>& key) const
+			{
+				return contains(key) ? 1 : 0;
+			}
+
+		public: // Observers
+			hasher hash_function() const { return _hash; }
+			key_equal key_eq() const { return _eq; }
+			allocator_type get_allocator() const { return _alloc; }
+
+		protected:
+			/*!
+			 *	Insert an entry constructed from 'args' unless an entry with 'key'
+			 *	already exists. 'key' must be the key of the constructed entry.
+			 */
+			template<typename K, typename... Args>
+			std::pair<iterator, bool> emplaceUnique(const K& key, Args&&... args)
+			{
+				const size_t hash = hashOf(key);
+				size_t i = findIndex(key, hash);
+				if (i != npos)
+					return { iteratorAt(i), false };
+
+				i = prepareInsert(hash);
+				constructAt(i, std::forward<Args>(args)...);
+				return { iteratorAt(i), true };
+			}
+
+		private:
+			static const size_t npos = ~size_t(0);
+
+			//! Spread the bits of user provided hashes, which may be the identity
+			static size_t mix(size_t hash) noexcept
+			{
+				const uint64_t m = static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+				return static_cast<size_t>(m ^ (m >> 32));
+			}
+
+			static size_t H1(size_t hash) noexcept { return hash >> 7; }
+			static HashCtrl H2(size_t hash) noexcept { return static_cast<HashCtrl>(hash & 0x7f); }
+
+			//! Smallest valid capacity of at least 'n' slots
+			static size_t normalizeCapacity(size_t n) noexcept
+			{
+				size_t capacity = HashGroup::Width - 1;
+				while (capacity < n)
+					capacity = 2 * capacity + 1;
+				return capacity;
+			}
+
+			//! Number of entries stored in 'capacity' slots before growing
+			static size_t maxEntries(size_t capacity) noexcept
+			{
+				return capacity - capacity / 8;
+			}
+
+			template<typename K>
+			size_t hashOf(const K& key) const
+			{
+				return mix(_hash(key));
+			}
+
+			iterator iteratorAt(size_t i) noexcept
+			{
+				return i == npos ? end() : iterator{ _ctrl + i, _slots + i };
+			}
+
+			template<typename K>
+			size_t findIndex(const K& key, size_t hash) const
+			{
+				const HashCtrl h2 = H2(hash);
+				size_t offset = H1(hash) & _capacity;
+				for (size_t step = HashGroup::Width;; step += HashGroup::Width)
+				{
+					const HashGroup group{ _ctrl + offset };
+					for (uint32_t mask = group.match(h2); mask != 0; mask &= mask - 1)
+					{
+						const size_t i = (offset + countTrailingZeros(mask)) & _capacity;
+						if (_eq(Policy::key(_slots[i]), key))
+							return i;
+					}
+					if (group.matchEmpty() != 0)
+						return npos;
+
+					offset = (offset + step) & _capacity;
+				}
+			}
+
+			//! First empty or deleted slot in the probe sequence of 'hash'
+			size_t findFirstNonFull(size_t hash) const noexcept
+			{
+				size_t offset = H1(hash) & _capacity;
+				for (size_t step = HashGroup::Width;; step += HashGroup::Width)
+				{
+					const uint32_t mask = HashGroup{ _ctrl + offset }.matchEmptyOrDeleted();
+					if (mask != 0)
+						return (offset + countTrailingZeros(mask)) & _capacity;
+
+					offset = (offset + step) & _capacity;
+				}
+			}
+
+			//! Mark a slot for an entry with 'hash'. The slot is not yet constructed.
+			size_t prepareInsert(size_t hash)
+			{
+				size_t i = findFirstNonFull(hash);
+				if (_growthLeft == 0 && _ctrl[i] != CtrlDeleted)
+				{
+					// Remove deleted slots if they take up a significant part of the table
+					if (_capacity > 0 && _size * 32 <= _capacity * 25)
+						resize(_capacity);
+					else
+						resize(normalizeCapacity(2 * _capacity + 1));
+					i = findFirstNonFull(hash);
+				}
+
+				_size++;
+				_growthLeft -= _ctrl[i] == CtrlEmpty ? 1 : 0;
+				setCtrl(i, H2(hash));
+				return i;
+			}
+
+			template<typename... Args>
+			void constructAt(size_t i, Args&&... args)
+			{
+				try
+				{
+					SlotAlloc alloc{ _alloc };
+					SlotTraits::construct(alloc, _slots + i, std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					// Return the slot prepared for the entry
+					_size--;
+					_growthLeft++;
+					setCtrl(i, CtrlEmpty);
+					throw;
+				}
+			}
+
+			void eraseAt(size_t i)
+			{
+				SlotAlloc alloc{ _alloc };
+				SlotTraits::destroy(alloc, _slots + i);
+				_size--;
+
+				// The slot can be marked empty again if no probe sequence
+				// ever passed over it, which is the case if the surrounding
+				// slots never formed a full group.
+				const size_t before = (i - HashGroup::Width) & _capacity;
+				const uint32_t empty_before = HashGroup{ _ctrl + before }.matchEmpty();
+				const uint32_t empty_after = HashGroup{ _ctrl + i }.matchEmpty();
+				const bool never_full =
+					empty_before != 0 && empty_after != 0 &&
+					static_cast<size_t>(countLeadingZeros16(empty_before) + countTrailingZeros(empty_after)) < HashGroup::Width;
+
+				if (_capacity < HashGroup::Width || never_full)
+				{
+					setCtrl(i, CtrlEmpty);
+					_growthLeft++;
+				} else
+				{
+					setCtrl(i, CtrlDeleted);
+				}
+			}
+
+			//! Set the control byte of a slot and its copy after the sentinel
+			void setCtrl(size_t i, HashCtrl h) noexcept
+			{
+				const size_t cloned = HashGroup::Width - 1;
+				_ctrl[i] = h;
+				_ctrl[((i - cloned) & _capacity) + cloned] = h;
+			}
+
+			void resetCtrl() noexcept
+			{
+				std::memset(_ctrl, CtrlEmpty, _capacity + HashGroup::Width);
+				_ctrl[_capacity] = CtrlSentinel;
+				_growthLeft = maxEntries(_capacity);
+			}
+
+			//! Replace the storage by 'capacity' empty slots. The table is left untouched if an allocation fails.
+			void initialize(size_t capacity)
+			{
+				CtrlAlloc ctrl_alloc{ _alloc };
+				SlotAlloc slot_alloc{ _alloc };
+
+				HashCtrl* ctrl = CtrlTraits::allocate(ctrl_alloc, capacity + HashGroup::Width);
+				value_type* slots = nullptr;
+				try
+				{
+					slots = SlotTraits::allocate(slot_alloc, capacity);
+				}
+				catch (...)
+				{
+					CtrlTraits::deallocate(ctrl_alloc, ctrl, capacity + HashGroup::Width);
+					throw;
+				}
+
+				_ctrl = ctrl;
+				_slots = slots;
+				_capacity = capacity;
+				resetCtrl();
+			}
+
+			//! Move all entries to a new allocation of 'capacity' slots
+			void resize(size_t capacity)
+			{
+				HashCtrl* old_ctrl = _ctrl;
+				value_type* old_slots = _slots;
+				const size_t old_capacity = _capacity;
+
+				initialize(capacity);
+
+				SlotAlloc alloc{ _alloc };
+				for (size_t i = 0; i < old_capacity; i++)
+				{
+					if (!isFull(old_ctrl[i]))
+						continue;
+
+					const size_t hash = hashOf(Policy::key(old_slots[i]));
+					const size_t target = findFirstNonFull(hash);
+					setCtrl(target, H2(hash));
+					SlotTraits::construct(alloc, _slots + target, std::move(old_slots[i]));
+					SlotTraits::destroy(alloc, old_slots + i);
+				}
+				_growthLeft -= _size;
+
+				deallocate(old_ctrl, old_slots, old_capacity);
+			}
+
+			void destroyAll() noexcept
+			{
+				if (std::is_trivially_destructible<value_type>::value)
+					return;
+
+				SlotAlloc alloc{ _alloc };
+				for (size_t i = 0; i < _capacity; i++)
+				{
+					if (isFull(_ctrl[i]))
+						SlotTraits::destroy(alloc, _slots + i);
+				}
+			}
+
+			void deallocate() noexcept
+			{
+				deallocate(_ctrl, _slots, _capacity);
+				reset();
+			}
+
+			void deallocate(HashCtrl* ctrl, value_type* slots, size_t capacity) noexcept
+			{
+				if (capacity == 0)
+					return;
+
+				CtrlAlloc ctrl_alloc{ _alloc };
+				SlotAlloc slot_alloc{ _alloc };
+				CtrlTraits::deallocate(ctrl_alloc, ctrl, capacity + HashGroup::Width);
+				SlotTraits::deallocate(slot_alloc, slots, capacity);
+			}
+
+			//! Reset to a table without slots
+			void reset() noexcept
+			{
+				_ctrl = emptyHashGroup();
+				_slots = nullptr;
+				_size = 0;
+				_capacity = 0;
+				_growthLeft = 0;
+			}
+
+		private:
+			//! Control bytes
+			HashCtrl* _ctrl{ emptyHashGroup() };
+
+			//! Storage of the entries
+			value_type* _slots{ nullptr };
+
+			//! Number of stored entries
+			size_t _size{ 0 };
+
+			//! Number of slots
+			size_t _capacity{ 0 };
+
+			//! Number of entries which can be added before growing
+			size_t _growthLeft{ 0 };
+
+			Hash _hash;
+			Eq _eq;
+			Alloc _alloc;
+		};
+	}
+
+	/*!
+	 *	Hash map storing its entries in a single flat array using
+	 *	SIMD-probed open addressing (Swiss table).
+	 *
+	 *	In contrast to std::unordered_map, inserting entries may move
+	 *	existing ones, invalidating references and iterators.
+	 */
+	template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>, typename Alloc = std::allocator<std::pair<const Key, Value>>>
+	class FlatHashMap : public Details::FlatHashTable<Details::FlatHashMapPolicy<Key, Value>, Hash, Eq, Alloc>
+	{
+		using Base = Details::FlatHashTable<Details::FlatHashMapPolicy<Key, Value>, Hash, Eq, Alloc>;
+
+		template<typename K>
+		using KeyArg = typename Base::template KeyArg<K>;
+
+	public:
+		using mapped_type = Value;
+		using typename Base::iterator;
+
+		using Base::Base;
+		FlatHashMap() = default;
+
+		template<typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+		{
+			return this->emplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+
+		template<typename K, typename V>
+		std::pair<iterator, bool> emplace(K&& key, V&& value)
+		{
+			return try_emplace(std::forward<K>(key), std::forward<V>(value));
+		}
+
+		template<typename V>
+		std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value)
+		{
+			auto entry = try_emplace(key, std::forward<V>(value));
+			if (!entry.second)
+				entry.first->second = std::forward<V>(value);
+			return entry;
+		}
+
+		using Base::insert;
+
+		Value& operator[](const Key& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		Value& operator[](Key&& key)
+		{
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		template<typename K = Key>
+		Value& at(const KeyArg<K>& key)
+		{
+			auto entry = this->find(key);
+			if (entry == this->end())
+				throw std::out_of_range("Key not found");
+			return entry->second;
+		}
+
+		template<typename K = Key>
+		const Value& at(const KeyArg<K>& key) const
+		{
+			auto entry = this->find(key);
+			if (entry == this->end())
+				throw std::out_of_range("Key not found");
+			return entry->second;
+		}
+	};
+
+	/*!
+	 *	Hash set storing its entries in a single flat array using
+	 *	SIMD-probed open addressing (Swiss table).
+	 */
+	template<typename Key, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>, typename Alloc = std::allocator<Key>>
+	class FlatHashSet : public Details::FlatHashTable<Details::FlatHashSetPolicy<Key>, Hash, Eq, Alloc>
+	{
+		using Base = Details::FlatHashTable<Details::FlatHashSetPolicy<Key>, Hash, Eq, Alloc>;
+
+	public:
+		using typename Base::iterator;
+
+		using Base::Base;
+		FlatHashSet() = default;
+
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args)
+		{
+			return this->insert(Key(std::forward<Args>(args)...));
+		}
+	};
+}}
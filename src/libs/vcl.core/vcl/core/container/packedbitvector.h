@@ -0,0 +1,529 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#if defined(VCL_COMPILER_MSVC)
+#	include <intrin.h>
+#endif
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	namespace Details {
+		VCL_STRONG_INLINE int popcount(uint64_t word) noexcept
+		{
+#if defined(VCL_COMPILER_MSVC) && defined(VCL_ARCH_X64)
+			return static_cast<int>(__popcnt64(word));
+#elif defined(VCL_COMPILER_MSVC)
+			return static_cast<int>(__popcnt(static_cast<uint32_t>(word)) + __popcnt(static_cast<uint32_t>(word >> 32)));
+#else
+			return __builtin_popcountll(word);
+#endif
+		}
+
+		//! Index of the lowest set bit. 'word' must not be zero.
+		VCL_STRONG_INLINE int countTrailingZeros(uint64_t word) noexcept
+		{
+#if defined(VCL_COMPILER_MSVC) && defined(VCL_ARCH_X64)
+			unsigned long idx;
+			_BitScanForward64(&idx, word);
+			return static_cast<int>(idx);
+#elif defined(VCL_COMPILER_MSVC)
+			unsigned long idx;
+			if (_BitScanForward(&idx, static_cast<uint32_t>(word)))
+				return static_cast<int>(idx);
+			_BitScanForward(&idx, static_cast<uint32_t>(word >> 32));
+			return static_cast<int>(idx) + 32;
+#else
+			return __builtin_ctzll(word);
+#endif
+		}
+
+		struct BitOr
+		{
+			static uint64_t apply(uint64_t a, uint64_t b) noexcept { return a | b; }
+#if defined(VCL_VECTORIZE_AVX512)
+			static __m512i apply(__m512i a, __m512i b) noexcept { return _mm512_or_si512(a, b); }
+#endif
+#if defined(VCL_VECTORIZE_AVX2)
+			static __m256i apply(__m256i a, __m256i b) noexcept { return _mm256_or_si256(a, b); }
+#endif
+#if defined(VCL_VECTORIZE_SSE2)
+			static __m128i apply(__m128i a, __m128i b) noexcept { return _mm_or_si128(a, b); }
+#elif defined(VCL_VECTORIZE_NEON)
+			static uint64x2_t apply(uint64x2_t a, uint64x2_t b) noexcept { return vorrq_u64(a, b); }
+#endif
+		};
+
+		struct BitAnd
+		{
+			static uint64_t apply(uint64_t a, uint64_t b) noexcept { return a & b; }
+#if defined(VCL_VECTORIZE_AVX512)
+			static __m512i apply(__m512i a, __m512i b) noexcept { return _mm512_and_si512(a, b); }
+#endif
+#if defined(VCL_VECTORIZE_AVX2)
+			static __m256i apply(__m256i a, __m256i b) noexcept { return _mm256_and_si256(a, b); }
+#endif
+#if defined(VCL_VECTORIZE_SSE2)
+			static __m128i apply(__m128i a, __m128i b) noexcept { return _mm_and_si128(a, b); }
+#elif defined(VCL_VECTORIZE_NEON)
+			static uint64x2_t apply(uint64x2_t a, uint64x2_t b) noexcept { return vandq_u64(a, b); }
+#endif
+		};
+
+		//! a & ~b
+		struct BitAndNot
+		{
+			static uint64_t apply(uint64_t a, uint64_t b) noexcept { return a & ~b; }
+#if defined(VCL_VECTORIZE_AVX512)
+			static __m512i apply(__m512i a, __m512i b) noexcept { return _mm512_ternarylogic_epi64(a, b, b, 0x30); }
+#endif
+#if defined(VCL_VECTORIZE_AVX2)
+			static __m256i apply(__m256i a, __m256i b) noexcept { return _mm256_andnot_si256(b, a); }
+#endif
+#if defined(VCL_VECTORIZE_SSE2)
+			static __m128i apply(__m128i a, __m128i b) noexcept { return _mm_andnot_si128(b, a); }
+#elif defined(VCL_VECTORIZE_NEON)
+			static uint64x2_t apply(uint64x2_t a, uint64x2_t b) noexcept { return vbicq_u64(a, b); }
+#endif
+		};
+
+		//! Combine 'n' words: dst[i] = Op(dst[i], src[i])
+		template<typename Op>
+		void combineWords(uint64_t* dst, const uint64_t* src, size_t n) noexcept
+		{
+			size_t i = 0;
+#if defined(VCL_VECTORIZE_AVX512)
+			for (; i + 8 <= n; i += 8)
+			{
+				const __m512i a = _mm512_loadu_si512(dst + i);
+				const __m512i b = _mm512_loadu_si512(src + i);
+				_mm512_storeu_si512(dst + i, Op::apply(a, b));
+			}
+#endif
+#if defined(VCL_VECTORIZE_AVX2)
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::apply(a, b));
+			}
+#endif
+#if defined(VCL_VECTORIZE_SSE2)
+			for (; i + 2 <= n; i += 2)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::apply(a, b));
+			}
+#elif defined(VCL_VECTORIZE_NEON)
+			for (; i + 2 <= n; i += 2)
+			{
+				vst1q_u64(dst + i, Op::apply(vld1q_u64(dst + i), vld1q_u64(src + i)));
+			}
+#endif
+			for (; i < n; i++)
+				dst[i] = Op::apply(dst[i], src[i]);
+		}
+	}
+
+	/*!
+	 *	Bit vector storing a single bit per entry.
+	 *
+	 *	In order to support a cheap reset of large, sparsely populated
+	 *	vectors, a second level mask tracks the words which were written
+	 *	since the last reset. Words without a dirty flag are guaranteed to be
+	 *	zero, such that resetting, counting and scanning only visit the dirty
+	 *	words.
+	 */
+	template<template<class> class AllocatorT = std::allocator>
+	class PackedBitVector
+	{
+	public:
+		using word_t = uint64_t;
+		using allocator_t = AllocatorT<word_t>;
+		using container_t = std::vector<word_t, allocator_t>;
+
+		//! Number of bits in a word
+		static const size_t WordBits = 64;
+
+		//! Index returned if no bit was found
+		static const size_t npos = static_cast<size_t>(-1);
+
+	public:
+		//! Iterator visiting the indices of the set bits in increasing order
+		class const_iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = size_t;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const size_t*;
+			using reference = size_t;
+
+			const_iterator(const PackedBitVector* bits, size_t idx)
+			: mBits(bits)
+			, mIdx(idx)
+			{
+			}
+
+			size_t operator*() const { return mIdx; }
+
+			const_iterator& operator++()
+			{
+				mIdx = mBits->findNext(mIdx + 1);
+				return *this;
+			}
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const const_iterator& rhs) const { return mIdx == rhs.mIdx; }
+			bool operator!=(const const_iterator& rhs) const { return mIdx != rhs.mIdx; }
+
+		private:
+			const PackedBitVector* mBits;
+			size_t mIdx;
+		};
+
+		//! Range of the set bits
+		class SetBits
+		{
+		public:
+			explicit SetBits(const PackedBitVector* bits)
+			: mBits(bits)
+			{
+			}
+
+			const_iterator begin() const { return { mBits, mBits->findFirst() }; }
+			const_iterator end() const { return { mBits, npos }; }
+
+		private:
+			const PackedBitVector* mBits;
+		};
+
+	public:
+		explicit PackedBitVector(const allocator_t& alloc = allocator_t())
+		: _words(alloc)
+		, _dirty(alloc)
+		{
+		}
+
+		explicit PackedBitVector(size_t n, const allocator_t& alloc = allocator_t())
+		: _words(alloc)
+		, _dirty(alloc)
+		{
+			assign(n, false);
+		}
+
+		PackedBitVector(size_t n, bool val, const allocator_t& alloc = allocator_t())
+		: _words(alloc)
+		, _dirty(alloc)
+		{
+			assign(n, val);
+		}
+
+	public: // Element access
+		bool operator[](size_t idx) const
+		{
+			return test(idx);
+		}
+
+		bool test(size_t idx) const
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			return (_words[idx / WordBits] >> (idx % WordBits)) & 1;
+		}
+
+	public: // Modifiers
+		void clear()
+		{
+			_words.clear();
+			_dirty.clear();
+			_size = 0;
+		}
+
+		void assign(size_t n, bool val)
+		{
+			if (n == _size && !val)
+			{
+				resetAllBitsToFalse();
+				return;
+			}
+
+			_size = n;
+			_words.assign(wordCount(n), val ? ~word_t(0) : 0);
+			_dirty.assign(wordCount(_words.size()), val ? ~word_t(0) : 0);
+			if (val)
+			{
+				maskTail(_words, _size);
+				maskTail(_dirty, _words.size());
+			}
+		}
+
+		void setBit(size_t idx, bool val)
+		{
+			if (val)
+				set(idx);
+			else
+				reset(idx);
+		}
+
+		void set(size_t idx)
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			const size_t w = idx / WordBits;
+			_words[w] |= word_t(1) << (idx % WordBits);
+			markDirty(w);
+		}
+
+		void reset(size_t idx)
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			_words[idx / WordBits] &= ~(word_t(1) << (idx % WordBits));
+		}
+
+		void flip(size_t idx)
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			const size_t w = idx / WordBits;
+			_words[w] ^= word_t(1) << (idx % WordBits);
+			markDirty(w);
+		}
+
+		//! Set the bit and return its previous value
+		bool testAndSet(size_t idx)
+		{
+			VclRequire(idx < _size, "Index is valid");
+
+			const size_t w = idx / WordBits;
+			const word_t mask = word_t(1) << (idx % WordBits);
+			const bool was_set = (_words[w] & mask) != 0;
+			_words[w] |= mask;
+			markDirty(w);
+
+			return was_set;
+		}
+
+		//! Reset all bits. Only the words written since the last reset are visited.
+		void resetAllBitsToFalse()
+		{
+			for (size_t d = 0; d < _dirty.size(); d++)
+			{
+				word_t dirty = _dirty[d];
+				while (dirty)
+				{
+					_words[d * WordBits + Details::countTrailingZeros(dirty)] = 0;
+					dirty &= dirty - 1;
+				}
+				_dirty[d] = 0;
+			}
+		}
+
+	public: // Bulk operations
+		PackedBitVector& operator|=(const PackedBitVector& rhs)
+		{
+			VclRequire(_size == rhs._size, "Sizes match.");
+
+			Details::combineWords<Details::BitOr>(_words.data(), rhs._words.data(), _words.size());
+			Details::combineWords<Details::BitOr>(_dirty.data(), rhs._dirty.data(), _dirty.size());
+			return *this;
+		}
+
+		PackedBitVector& operator&=(const PackedBitVector& rhs)
+		{
+			VclRequire(_size == rhs._size, "Sizes match.");
+
+			Details::combineWords<Details::BitAnd>(_words.data(), rhs._words.data(), _words.size());
+			return *this;
+		}
+
+		//! Reset all the bits which are set in 'rhs'
+		PackedBitVector& andNot(const PackedBitVector& rhs)
+		{
+			VclRequire(_size == rhs._size, "Sizes match.");
+
+			Details::combineWords<Details::BitAndNot>(_words.data(), rhs._words.data(), _words.size());
+			return *this;
+		}
+
+	public: // Queries
+		//! Number of set bits
+		size_t count() const
+		{
+			size_t n = 0;
+			forEachDirtyWord([this, &n](size_t w) { n += static_cast<size_t>(Details::popcount(_words[w])); return false; });
+			return n;
+		}
+
+		bool any() const
+		{
+			return findFirst() != npos;
+		}
+
+		//! Index of the first set bit, 'npos' if none is set
+		size_t findFirst() const
+		{
+			return findNext(0);
+		}
+
+		//! Index of the first set bit at or after 'pos', 'npos' if none is set
+		size_t findNext(size_t pos) const
+		{
+			if (pos >= _size)
+				return npos;
+
+			// Remaining bits of the first word
+			size_t w = pos / WordBits;
+			const word_t bits = _words[w] & (~word_t(0) << (pos % WordBits));
+			if (bits)
+				return w * WordBits + static_cast<size_t>(Details::countTrailingZeros(bits));
+
+			// Following words, skipping the ones which are not dirty
+			size_t found = npos;
+			forEachDirtyWord(
+				[this, &found](size_t d) {
+					if (_words[d])
+					{
+						found = d * WordBits + static_cast<size_t>(Details::countTrailingZeros(_words[d]));
+						return true;
+					}
+					return false;
+				},
+				w + 1);
+
+			return found;
+		}
+
+		//! Call 'func(idx)' for every set bit in increasing order
+		template<typename Func>
+		void forEachSetBit(Func&& func) const
+		{
+			forEachDirtyWord([this, &func](size_t w) {
+				word_t bits = _words[w];
+				while (bits)
+				{
+					func(w * WordBits + static_cast<size_t>(Details::countTrailingZeros(bits)));
+					bits &= bits - 1;
+				}
+				return false;
+			});
+		}
+
+		//! Range over the indices of the set bits
+		SetBits setBits() const
+		{
+			return SetBits(this);
+		}
+
+	public:
+		size_t size() const noexcept
+		{
+			return _size;
+		}
+
+		void shrink_to_fit()
+		{
+			_words.shrink_to_fit();
+			_dirty.shrink_to_fit();
+		}
+
+		//! Packed bits, bit 'i' is stored in bit 'i % 64' of word 'i / 64'
+		const word_t* words() const noexcept
+		{
+			return _words.data();
+		}
+
+	private:
+		static size_t wordCount(size_t bits)
+		{
+			return (bits + WordBits - 1) / WordBits;
+		}
+
+		//! Clear the bits beyond 'bits' in the last word
+		static void maskTail(container_t& words, size_t bits)
+		{
+			if (bits % WordBits != 0)
+				words.back() &= (word_t(1) << (bits % WordBits)) - 1;
+		}
+
+		void markDirty(size_t w)
+		{
+			_dirty[w / WordBits] |= word_t(1) << (w % WordBits);
+		}
+
+		//! Call 'func(w)' for every dirty word 'w >= first' until it returns true
+		template<typename Func>
+		void forEachDirtyWord(Func&& func, size_t first = 0) const
+		{
+			for (size_t d = first / WordBits; d < _dirty.size(); d++)
+			{
+				word_t dirty = _dirty[d];
+				if (d == first / WordBits)
+					dirty &= ~word_t(0) << (first % WordBits);
+
+				while (dirty)
+				{
+					if (func(d * WordBits + static_cast<size_t>(Details::countTrailingZeros(dirty))))
+						return;
+					dirty &= dirty - 1;
+				}
+			}
+		}
+
+	private:
+		//! Number of bits
+		size_t _size{ 0 };
+
+		//! Packed bits
+		container_t _words;
+
+		//! One flag per word in '_words' marking it as potentially non-zero
+		container_t _dirty;
+	};
+
+	template<template<class> class AllocatorT>
+	const size_t PackedBitVector<AllocatorT>::WordBits;
+
+	template<template<class> class AllocatorT>
+	const size_t PackedBitVector<AllocatorT>::npos;
+}}
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <cstdint>
+#include <cstring>
+
+namespace Vcl {
+	/*!
+	 *	IEEE 754 binary16 storage type.
+	 *
+	 *	The type only supports conversions from and to 'float'. Computations
+	 *	are performed in single precision after loading the values, e.g. using
+	 *	the widening 'load' and narrowing 'store' of the SIMD module.
+	 *	Conversions from 'float' round to the nearest representable value,
+	 *	ties to even.
+	 */
+	class half
+	{
+	public:
+		half() = default;
+		explicit half(float f) noexcept
+		: _bits(fromFloat(f))
+		{
+		}
+
+		explicit operator float() const noexcept
+		{
+			return toFloat(_bits);
+		}
+
+		//! Construct a value from its binary representation
+		static half fromBits(uint16_t bits) noexcept
+		{
+			half h;
+			h._bits = bits;
+			return h;
+		}
+
+		//! Access the binary representation
+		uint16_t bits() const noexcept
+		{
+			return _bits;
+		}
+
+	private:
+		static float toFloat(uint16_t h) noexcept
+		{
+#ifdef VCL_VECTORIZE_F16C
+			return _cvtsh_ss(h);
+#else
+			// Based on https://gist.github.com/rygorous/2144712
+			const uint32_t shifted_exp = 0x7c00u << 13;
+			uint32_t o = (h & 0x7fffu) << 13;
+			const uint32_t exp = shifted_exp & o;
+			o += (127 - 15) << 23;
+
+			if (exp == shifted_exp)
+			{
+				// Inf or NaN
+				o += (128 - 16) << 23;
+			} else if (exp == 0)
+			{
+				// Zero or denormal, renormalize using the FPU
+				const uint32_t magic_bits = 113 << 23;
+				float magic, f;
+				memcpy(&magic, &magic_bits, sizeof(float));
+
+				o += 1 << 23;
+				memcpy(&f, &o, sizeof(float));
+				f -= magic;
+				memcpy(&o, &f, sizeof(float));
+			}
+			o |= static_cast<uint32_t>(h & 0x8000u) << 16;
+
+			float f;
+			memcpy(&f, &o, sizeof(float));
+			return f;
+#endif
+		}
+
+		static uint16_t fromFloat(float f) noexcept
+		{
+#ifdef VCL_VECTORIZE_F16C
+			return static_cast<uint16_t>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+#else
+			// Based on https://gist.github.com/rygorous/2144712
+			uint32_t u;
+			memcpy(&u, &f, sizeof(float));
+
+			const uint32_t sign = u & 0x80000000u;
+			u ^= sign;
+
+			uint16_t o;
+			if (u >= (127 + 16) << 23)
+			{
+				// Overflow maps to Inf, NaN stays NaN
+				o = (u > 0x7f800000u) ? 0x7e00 : 0x7c00;
+			} else if (u < (127 - 14) << 23)
+			{
+				// Denormal or zero, let the FPU do the rounding
+				const uint32_t magic_bits = (127 - 15 + 23 - 10 + 1) << 23;
+				float magic, g;
+				memcpy(&magic, &magic_bits, sizeof(float));
+				memcpy(&g, &u, sizeof(float));
+
+				g += magic;
+				memcpy(&u, &g, sizeof(float));
+				o = static_cast<uint16_t>(u - magic_bits);
+			} else
+			{
+				// Rebias the exponent and round to nearest, ties to even
+				const uint32_t mant_odd = (u >> 13) & 1;
+				u += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff;
+				u += mant_odd;
+				o = static_cast<uint16_t>(u >> 13);
+			}
+
+			return static_cast<uint16_t>(o | (sign >> 16));
+#endif
+		}
+
+	private:
+		uint16_t _bits;
+	};
+}
+
+namespace Eigen {
+	template<>
+	struct NumTraits<Vcl::half> : GenericNumTraits<Vcl::half>
+	{
+		enum
+		{
+			IsComplex = 0,
+			IsInteger = 0,
+			IsSigned = 1,
+			RequireInitialization = 0,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		typedef Vcl::half Real;
+		typedef Vcl::half NonInteger;
+		typedef Vcl::half Literal;
+	};
+}
@@ -44,10 +44,89 @@ namespace Vcl { namespace Core {
 		static const int value = sizeof(T1) / sizeof(T2);
 	};
 
+	/*!
+	 *	Eigen map accessing a single entry of an interleaved storage
+	 */
+	template<typename SCALAR, typename SCALAR_OUT, int ROWS, int COLS, int STRIDE>
+	struct InterleavedMap
+	{
+		using StrideType = Eigen::Stride<
+			((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? ROWS : (ROWS * STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value))),
+			((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? 1 : (STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value)))>;
+
+		using type = Eigen::Map<Eigen::Matrix<SCALAR_OUT, ROWS, COLS>, Eigen::Unaligned, StrideType>;
+
+		/*!
+		 *	\param data      Pointer to the storage
+		 *	\param idx       Index of the accessed entry, in units of 'SCALAR_OUT'
+		 *	                  when accessing multiple entries at once
+		 *	\param rows      Number of rows in a data element
+		 *	\param cols      Number of cols in a data element
+		 *	\param stride    Stride configuration of the storage
+		 *	\param allocated Number of allocated elements
+		 */
+		static type make(SCALAR* data, size_t idx, size_t rows, size_t cols, size_t stride_cfg, size_t allocated)
+		{
+			static_assert(
+				(sizeof(SCALAR_OUT) >= sizeof(SCALAR)) && (sizeof(SCALAR_OUT) % sizeof(SCALAR) == 0),
+				"Always access multiples of the internal type.");
+			static_assert(
+				implies(STRIDE != DynamicStride && STRIDE > 1, (sizeof(SCALAR_OUT) / sizeof(SCALAR) <= static_cast<size_t>(STRIDE)) && (static_cast<size_t>(STRIDE) % (sizeof(SCALAR_OUT) / sizeof(SCALAR)) == 0)),
+				"Output size and stride size are compatible.");
+			static_assert(
+				implies(STRIDE == 0 || STRIDE == 1, sizeof(SCALAR_OUT) == sizeof(SCALAR)),
+				"Output size and stride size are compatible.");
+
+			VclRequire(
+				implies(STRIDE == DynamicStride, (sizeof(SCALAR_OUT) / sizeof(SCALAR) <= allocated) && (allocated % (sizeof(SCALAR_OUT) / sizeof(SCALAR)) == 0)),
+				"Output size and stride size are compatible.");
+
+			// Stride between to entries of the same matrix
+			const size_t stride = (stride_cfg == static_cast<size_t>(DynamicStride)) ? allocated : stride_cfg;
+
+			// Size of a single entry
+			const size_t scalar_width = sizeof(SCALAR_OUT) / sizeof(SCALAR);
+
+			// Outer/Inner stride
+			size_t outer_stride = 0;
+			size_t inner_stride = 0;
+
+			// Compute the address of the first entry
+			auto base = reinterpret_cast<SCALAR_OUT*>(data);
+			if (stride == 0 || stride == 1)
+			{
+				base += idx * rows * cols;
+			} else if (stride < allocated)
+			{
+				// Wide accesses address blocks of 'scalar_width' entries
+				size_t first = idx * scalar_width;
+				size_t entry = first % stride;
+				size_t group_idx = first - entry;
+				base += (group_idx * rows * cols + entry) / scalar_width;
+
+				outer_stride = rows * stride / scalar_width;
+				inner_stride = stride / scalar_width;
+			} else
+			{
+				base += idx;
+
+				outer_stride = rows * stride / scalar_width;
+				inner_stride = stride / scalar_width;
+			}
+
+			if (STRIDE == DynamicStride || stride_cfg == size_t(DynamicStride))
+				return type(base, StrideType(static_cast<ptrdiff_t>(outer_stride), static_cast<ptrdiff_t>(inner_stride)));
+			else
+				return type(base);
+		}
+	};
+
 	/*!
 	 *	Storage class storing the given matrix objects in row-major order.
+	 *	The memory is provided by the allocation policy 'ALLOCATOR', e.g.
+	 *	\ref PageAllocPolicy in order to use huge pages for large arrays.
 	 */
-	template<typename SCALAR, int ROWS = 0, int COLS = 0, int STRIDE = 0>
+	template<typename SCALAR, int ROWS = 0, int COLS = 0, int STRIDE = 0, typename ALLOCATOR = AlignedAllocPolicy<SCALAR, 64>>
 	class InterleavedArray
 	{
 	public:
@@ -97,7 +176,7 @@ namespace Vcl { namespace Core {
 				mAllocated += alignment - mAllocated % alignment;
 
 			// Allocate initial memory
-			AlignedAllocPolicy<SCALAR, 64> alloc;
+			ALLOCATOR alloc;
 			mData = alloc.allocate(mAllocated * mRows * mCols);
 		}
 
@@ -121,7 +200,7 @@ namespace Vcl { namespace Core {
 		{
 			if (mData)
 			{
-				AlignedAllocPolicy<SCALAR, 64> alloc;
+				ALLOCATOR alloc;
 				alloc.deallocate(mData, mAllocated * mRows * mCols);
 			}
 		}
@@ -149,78 +228,13 @@ namespace Vcl { namespace Core {
 
 	public:
 		template<typename SCALAR_OUT>
-		Eigen::Map<
-			Eigen::Matrix<SCALAR_OUT, ROWS, COLS>,
-			Eigen::Unaligned,
-			Eigen::Stride<
-				((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? ROWS : (ROWS * STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value))),
-				((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? 1 : (STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value)))> >
-		at(size_t idx)
+		typename InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::type at(size_t idx)
 		{
-			static_assert(
-				(sizeof(SCALAR_OUT) >= sizeof(SCALAR)) && (sizeof(SCALAR_OUT) % sizeof(SCALAR) == 0),
-				"Always access multiples of the internal type.");
-			static_assert(
-				implies(Stride != DynamicStride, (sizeof(SCALAR_OUT) / sizeof(SCALAR) <= static_cast<size_t>(Stride)) && (static_cast<size_t>(Stride) % (sizeof(SCALAR_OUT) / sizeof(SCALAR)) == 0)),
-				"Output size and stride size are compatible.");
-
-			using StrideType = Eigen::Stride<
-				((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? ROWS : (ROWS * STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value))),
-				((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? 1 : (STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value)))>;
-
-			VclRequire(
-				implies(Stride == DynamicStride, (sizeof(SCALAR_OUT) / sizeof(SCALAR) <= mAllocated) && (mAllocated % (sizeof(SCALAR_OUT) / sizeof(SCALAR)) == 0)),
-				"Output size and stride size are compatible.");
-
-			const size_t rows = mRows;
-			const size_t cols = mCols;
-
-			// Stride between to entries of the same matrix
-			const size_t stride = (mStride == static_cast<size_t>(DynamicStride)) ? mAllocated : mStride;
-
-			// Size of a single entry
-			const size_t scalar_width = sizeof(SCALAR_OUT) / sizeof(SCALAR);
-
-			// Outer/Inner stride
-			size_t outer_stride = 0;
-			size_t inner_stride = 0;
-
-			// Compute the address of the first entry
-			auto base = reinterpret_cast<SCALAR_OUT*>(mData);
-			if (stride == 0 || stride == 1)
-			{
-				base += idx * rows * cols;
-			} else if (stride < mAllocated)
-			{
-				size_t entry = idx % stride;
-				size_t group_idx = idx - entry;
-				base += group_idx * rows * cols + entry;
-
-				outer_stride = rows * stride / scalar_width;
-				inner_stride = stride / scalar_width;
-			} else
-			{
-				base += idx;
-
-				outer_stride = rows * stride / scalar_width;
-				inner_stride = stride / scalar_width;
-			}
-
-			if (Stride == DynamicStride || mStride == size_t(DynamicStride))
-				return Eigen::Map<Eigen::Matrix<SCALAR_OUT, ROWS, COLS>, Eigen::Unaligned, StrideType>(
-					base, StrideType(static_cast<ptrdiff_t>(outer_stride), static_cast<ptrdiff_t>(inner_stride)));
-			else
-				return Eigen::Map<Eigen::Matrix<SCALAR_OUT, ROWS, COLS>, Eigen::Unaligned, StrideType>(base);
+			return InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::make(mData, idx, mRows, mCols, mStride, mAllocated);
 		}
 
 		template<typename SCALAR_OUT>
-		const Eigen::Map<
-			Eigen::Matrix<SCALAR_OUT, ROWS, COLS>,
-			Eigen::Unaligned,
-			Eigen::Stride<
-				((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? ROWS : (ROWS * STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value))),
-				((STRIDE == DynamicStride) ? DynamicStride : ((STRIDE == 0 || STRIDE == 1) ? 1 : (STRIDE / VectorWidth<SCALAR_OUT, SCALAR>::value)))> >
-		at(size_t idx) const
+		const typename InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::type at(size_t idx) const
 		{
 			return const_cast<InterleavedArray*>(this)->at<SCALAR_OUT>(idx);
 		}
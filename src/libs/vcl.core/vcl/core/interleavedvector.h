@@ -0,0 +1,334 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// VCL
+#include <vcl/core/memory/allocator.h>
+#include <vcl/core/contract.h>
+#include <vcl/core/interleavedarray.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Growable storage class laying out fixed sized matrix objects in
+	 *	the same interleaved layouts as \ref InterleavedArray.
+	 *
+	 *	The capacity is always a multiple of the stride and of the cache-line
+	 *	size, such that the last group of entries can be accessed with full
+	 *	vector loads. Growing the storage relocates only the live stride groups.
+	 *	The memory is provided by the allocation policy 'ALLOCATOR'.
+	 */
+	template<typename SCALAR, int ROWS, int COLS, int STRIDE = 0, typename ALLOCATOR = AlignedAllocPolicy<SCALAR, 64>>
+	class InterleavedVector
+	{
+	public:
+		static const int Cols = COLS;
+		static const int Rows = ROWS;
+		static const int Stride = ((STRIDE == 0) || (STRIDE == 1)) ? 1 : STRIDE;
+
+		using value_type = Eigen::Matrix<SCALAR, ROWS, COLS>;
+
+		static_assert(ROWS > 0 && COLS > 0, "Size of a data member is fixed.");
+		static_assert(STRIDE == DynamicStride || STRIDE >= 0, "Stride is Dynamic, 0 or greater 0");
+		static_assert(std::is_trivially_copyable<SCALAR>::value, "Data is relocated by copying memory.");
+
+	public:
+		/*!
+		 *	Range of indices visiting the storage in blocks of entries
+		 *	accessible as single SIMD vectors.
+		 */
+		template<typename SCALAR_OUT, typename Container>
+		class BlockRange
+		{
+		public:
+			static const int Width = VectorWidth<SCALAR_OUT, SCALAR>::value;
+
+			class iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = typename InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::type;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = value_type;
+
+				iterator(Container* container, size_t idx)
+				: mContainer(container)
+				, mIdx(idx)
+				{
+				}
+
+				//! Map of the SIMD block starting at entry 'index()'
+				value_type operator*() const { return mContainer->template at<SCALAR_OUT>(mIdx / Width); }
+
+				//! Index of the first entry of the current block
+				size_t index() const { return mIdx; }
+
+				iterator& operator++()
+				{
+					mIdx += Width;
+					return *this;
+				}
+				iterator operator++(int)
+				{
+					iterator tmp = *this;
+					mIdx += Width;
+					return tmp;
+				}
+
+				bool operator==(const iterator& rhs) const { return mIdx == rhs.mIdx; }
+				bool operator!=(const iterator& rhs) const { return mIdx != rhs.mIdx; }
+
+			private:
+				Container* mContainer;
+				size_t mIdx;
+			};
+
+			explicit BlockRange(Container* container)
+			: mContainer(container)
+			{
+			}
+
+			iterator begin() const { return { mContainer, 0 }; }
+			iterator end() const { return { mContainer, (mContainer->size() + Width - 1) / Width * Width }; }
+
+		private:
+			Container* mContainer;
+		};
+
+	public:
+		InterleavedVector() = default;
+
+		/*!
+		 *	\param size Number of zero initialised entries in the storage.
+		 */
+		explicit InterleavedVector(size_t size)
+		{
+			resize(size);
+		}
+
+		InterleavedVector(const InterleavedVector&) = delete;
+		InterleavedVector& operator=(const InterleavedVector&) = delete;
+
+		InterleavedVector(InterleavedVector&& rhs) noexcept
+		{
+			std::swap(mData, rhs.mData);
+			std::swap(mSize, rhs.mSize);
+			std::swap(mAllocated, rhs.mAllocated);
+		}
+
+		InterleavedVector& operator=(InterleavedVector&& rhs) noexcept
+		{
+			std::swap(mData, rhs.mData);
+			std::swap(mSize, rhs.mSize);
+			std::swap(mAllocated, rhs.mAllocated);
+			return *this;
+		}
+
+		~InterleavedVector()
+		{
+			if (mData)
+			{
+				ALLOCATOR alloc;
+				alloc.deallocate(mData, mAllocated * Rows * Cols);
+			}
+		}
+
+	public:
+		SCALAR* data() const
+		{
+			return mData;
+		}
+
+		size_t size() const
+		{
+			return mSize;
+		}
+
+		bool empty() const
+		{
+			return mSize == 0;
+		}
+
+		size_t capacity() const
+		{
+			return mAllocated;
+		}
+
+		void setZero()
+		{
+			if (mData)
+				memset(mData, 0, mAllocated * Rows * Cols * sizeof(SCALAR));
+		}
+
+	public:
+		//! Ensure the storage can hold at least 'n' entries without relocation
+		void reserve(size_t n)
+		{
+			if (n > mAllocated)
+				reallocate(paddedCapacity(n));
+		}
+
+		//! Change the number of entries. New entries are zero initialised.
+		void resize(size_t n)
+		{
+			if (n > mAllocated)
+				grow(n);
+
+			for (size_t i = mSize; i < n; i++)
+				at<SCALAR>(i).setZero();
+			mSize = n;
+		}
+
+		//! Remove all entries without releasing the memory
+		void clear()
+		{
+			mSize = 0;
+		}
+
+		template<typename Derived>
+		void push_back(const Eigen::MatrixBase<Derived>& value)
+		{
+			if (mSize == mAllocated)
+				grow(mSize + 1);
+
+			at<SCALAR>(mSize) = value;
+			mSize++;
+		}
+
+	public:
+		/*!
+		 *	Access an entry. When 'SCALAR_OUT' is wider than 'SCALAR', 'idx'
+		 *	addresses blocks of 'sizeof(SCALAR_OUT)/sizeof(SCALAR)' entries.
+		 */
+		template<typename SCALAR_OUT>
+		typename InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::type at(size_t idx)
+		{
+			VclRequire((idx + 1) * (sizeof(SCALAR_OUT) / sizeof(SCALAR)) <= mAllocated, "Access is within the allocated memory.");
+
+			return InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::make(mData, idx, Rows, Cols, STRIDE, mAllocated);
+		}
+
+		template<typename SCALAR_OUT>
+		const typename InterleavedMap<SCALAR, SCALAR_OUT, ROWS, COLS, STRIDE>::type at(size_t idx) const
+		{
+			return const_cast<InterleavedVector*>(this)->at<SCALAR_OUT>(idx);
+		}
+
+		/*!
+		 *	Iterate over the entries in blocks of 'sizeof(SCALAR_OUT)/sizeof(SCALAR)'.
+		 *	The last block may contain padding entries beyond 'size()'.
+		 */
+		template<typename SCALAR_OUT>
+		BlockRange<SCALAR_OUT, InterleavedVector> blocks()
+		{
+			return BlockRange<SCALAR_OUT, InterleavedVector>(this);
+		}
+
+		template<typename SCALAR_OUT>
+		BlockRange<SCALAR_OUT, const InterleavedVector> blocks() const
+		{
+			return BlockRange<SCALAR_OUT, const InterleavedVector>(this);
+		}
+
+	private:
+		//! Round a number of entries up to the stride and the cache-line size
+		static size_t paddedCapacity(size_t n)
+		{
+			const size_t alignment = 64;
+			const size_t group = (STRIDE > 1) ? static_cast<size_t>(STRIDE) : 1;
+
+			// Least common multiple of the stride and the alignment
+			size_t a = group, b = alignment;
+			while (b != 0)
+			{
+				size_t t = a % b;
+				a = b;
+				b = t;
+			}
+			const size_t granularity = group / a * alignment;
+
+			return (n + granularity - 1) / granularity * granularity;
+		}
+
+		void grow(size_t n)
+		{
+			reallocate(paddedCapacity(std::max(n, 2 * mAllocated)));
+		}
+
+		void reallocate(size_t capacity)
+		{
+			VclRequire(capacity >= mSize, "New capacity holds all entries.");
+
+			const size_t planes = Rows * Cols;
+
+			ALLOCATOR alloc;
+			SCALAR* data = alloc.allocate(capacity * planes);
+
+			if (STRIDE == DynamicStride)
+			{
+				// Each component is stored in a plane of size 'capacity'
+				for (size_t p = 0; p < planes; p++)
+				{
+					if (mSize > 0)
+						memcpy(data + p * capacity, mData + p * mAllocated, mSize * sizeof(SCALAR));
+					memset(data + p * capacity + mSize, 0, (capacity - mSize) * sizeof(SCALAR));
+				}
+			} else
+			{
+				// Copy only the stride groups containing live entries
+				const size_t group = static_cast<size_t>(Stride);
+				const size_t live = (mSize + group - 1) / group * group * planes;
+				if (live > 0)
+					memcpy(data, mData, live * sizeof(SCALAR));
+				memset(data + live, 0, (capacity * planes - live) * sizeof(SCALAR));
+			}
+
+			if (mData)
+				alloc.deallocate(mData, mAllocated * planes);
+
+			mData = data;
+			mAllocated = capacity;
+		}
+
+	private:
+		//! Pointer to the allocated memory
+		SCALAR* mData{ nullptr };
+		//! Number of used elements in the buffer
+		size_t mSize{ 0 };
+		//! Number of allocated elements
+		size_t mAllocated{ 0 };
+	};
+}}
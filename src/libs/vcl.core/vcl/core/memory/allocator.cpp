@@ -0,0 +1,282 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/allocator.h>
+
+// C++ standard library
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+#ifdef VCL_ABI_WINAPI
+#	include <windows.h>
+#elif defined(VCL_ABI_POSIX)
+#	include <sys/mman.h>
+#	include <unistd.h>
+#	ifdef __linux__
+#		include <sys/syscall.h>
+#	endif
+#endif
+VCL_END_EXTERNAL_HEADERS
+
+namespace Vcl { namespace Core { namespace Details {
+	namespace {
+		const size_t HugePageSize = 2 * 1024 * 1024;
+
+		size_t systemPageSize()
+		{
+#if defined(VCL_ABI_POSIX)
+			static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			return size;
+#else
+			return 4096;
+#endif
+		}
+
+		size_t roundUp(size_t value, size_t multiple)
+		{
+			return (value + multiple - 1) / multiple * multiple;
+		}
+
+#if defined(__linux__) && defined(SYS_mbind)
+		// Memory policies as defined in linux/mempolicy.h
+		const int MpolInterleave = 3;
+		const int MpolLocal = 4;
+
+		// Support up to 1024 NUMA nodes
+		const size_t MaxNumaNodes = 1024;
+		using NodeMask = unsigned long[MaxNumaNodes / (8 * sizeof(unsigned long))];
+
+		//! Read the online NUMA nodes, e.g. "0-3,5". Returns the number of nodes.
+		int onlineNumaNodes(NodeMask& mask)
+		{
+			std::fill(std::begin(mask), std::end(mask), 0ul);
+
+			std::ifstream file{ "/sys/devices/system/node/online" };
+			std::string list;
+			if (!std::getline(file, list))
+				return 0;
+
+			int nr_nodes = 0;
+			size_t pos = 0;
+			while (pos < list.size())
+			{
+				size_t end = list.find(',', pos);
+				if (end == std::string::npos)
+					end = list.size();
+
+				const std::string range = list.substr(pos, end - pos);
+				const size_t dash = range.find('-');
+				const unsigned long first = std::stoul(range.substr(0, dash));
+				const unsigned long last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+				for (unsigned long n = first; n <= last && n < MaxNumaNodes; n++)
+				{
+					mask[n / (8 * sizeof(unsigned long))] |= 1ul << (n % (8 * sizeof(unsigned long)));
+					nr_nodes++;
+				}
+
+				pos = end + 1;
+			}
+
+			return nr_nodes;
+		}
+
+		//! Set the placement of the pages before they are touched the first time.
+		//! The placement is a hint, failures are ignored.
+		void bindPages(void* ptr, size_t bytes, NumaPlacement placement)
+		{
+			if (placement == NumaPlacement::Interleaved)
+			{
+				static NodeMask nodes;
+				static const int nr_nodes = onlineNumaNodes(nodes);
+				if (nr_nodes > 1)
+					syscall(SYS_mbind, ptr, bytes, MpolInterleave, nodes, MaxNumaNodes + 1, 0);
+			} else if (placement == NumaPlacement::FirstTouch)
+			{
+				syscall(SYS_mbind, ptr, bytes, MpolLocal, nullptr, 0, 0);
+			}
+		}
+#else
+		void bindPages(void*, size_t, NumaPlacement)
+		{
+		}
+#endif
+
+#if defined(VCL_ABI_WINAPI)
+		// Size of the chunks distributed across the NUMA nodes
+		const size_t InterleaveGranularity = 64 * 1024;
+
+		//! Map explicit huge pages. Only succeeds if the process holds the privilege to lock pages in memory.
+		void* allocateLargePages(size_t size)
+		{
+			if (GetLargePageMinimum() != HugePageSize)
+				return nullptr;
+
+			return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+		}
+
+		//! Reserve an address range aligned to 'alignment'. Returns nullptr on failure.
+		void* reserveAligned(size_t size, size_t alignment)
+		{
+			// Reservations are only aligned to the allocation granularity (64 KB).
+			// Locate a suitable range by over-reserving, then reserve its aligned part.
+			// Another thread may take the range in between, thus retry.
+			for (int attempt = 0; attempt < 16; attempt++)
+			{
+				void* base = VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+				if (!base)
+					return nullptr;
+
+				VirtualFree(base, 0, MEM_RELEASE);
+				void* aligned = reinterpret_cast<void*>(roundUp(reinterpret_cast<size_t>(base), alignment));
+				if (void* ptr = VirtualAlloc(aligned, size, MEM_RESERVE, PAGE_NOACCESS))
+					return ptr;
+			}
+
+			return nullptr;
+		}
+
+		//! Commit a reserved range. The placement is a hint, the pages are
+		//! placed on any node if the preferred one has no memory left.
+		bool commitPages(void* ptr, size_t size, NumaPlacement placement)
+		{
+			ULONG highest_node = 0;
+			if (placement == NumaPlacement::Interleaved && GetNumaHighestNodeNumber(&highest_node) && highest_node > 0)
+			{
+				// Windows has no interleaving policy, thus distribute the chunks of the range round-robin
+				const size_t nr_nodes = static_cast<size_t>(highest_node) + 1;
+				for (size_t offset = 0; offset < size; offset += InterleaveGranularity)
+				{
+					void* chunk = static_cast<char*>(ptr) + offset;
+					const size_t bytes = std::min(InterleaveGranularity, size - offset);
+					const DWORD node = static_cast<DWORD>((offset / InterleaveGranularity) % nr_nodes);
+					if (!VirtualAllocExNuma(GetCurrentProcess(), chunk, bytes, MEM_COMMIT, PAGE_READWRITE, node) &&
+						!VirtualAlloc(chunk, bytes, MEM_COMMIT, PAGE_READWRITE))
+						return false;
+				}
+
+				return true;
+			}
+
+			// Windows places committed pages on the node of the thread touching them first
+			return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+		}
+#endif
+	}
+
+	size_t pageMappingSize(size_t bytes, PageSize pages)
+	{
+		return roundUp(bytes, pages == PageSize::Regular ? systemPageSize() : HugePageSize);
+	}
+
+	void* allocatePages(size_t bytes, PageSize pages, NumaPlacement placement)
+	{
+		const size_t size = pageMappingSize(bytes, pages);
+
+#if defined(VCL_ABI_WINAPI)
+		// Large pages cannot be committed separately, thus they are not interleaved
+		if (pages == PageSize::Huge)
+		{
+			if (void* ptr = allocateLargePages(size))
+				return ptr;
+		}
+
+		// Without transparent huge pages, the alignment is kept for consistency with the other platforms
+		void* ptr = (pages == PageSize::Regular) ? VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS) : reserveAligned(size, HugePageSize);
+		if (!ptr)
+			return nullptr;
+
+		if (!commitPages(ptr, size, placement))
+		{
+			VirtualFree(ptr, 0, MEM_RELEASE);
+			return nullptr;
+		}
+
+		return ptr;
+#elif defined(VCL_ABI_POSIX)
+		void* ptr = nullptr;
+
+#	if defined(MAP_HUGETLB)
+		if (pages == PageSize::Huge)
+		{
+			// Only succeeds if huge pages were reserved by the system
+			int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#		ifdef MAP_HUGE_SHIFT
+			flags |= 21 << MAP_HUGE_SHIFT;
+#		endif
+			ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+			if (ptr == MAP_FAILED)
+				ptr = nullptr;
+		}
+#	endif
+
+		if (!ptr && pages != PageSize::Regular)
+		{
+			// Over-allocate in order to align the mapping to the huge page size
+			void* base = mmap(nullptr, size + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (base == MAP_FAILED)
+				return nullptr;
+
+			const size_t head = roundUp(reinterpret_cast<size_t>(base), HugePageSize) - reinterpret_cast<size_t>(base);
+			if (head > 0)
+				munmap(base, head);
+			if (HugePageSize - head > 0)
+				munmap(static_cast<char*>(base) + head + size, HugePageSize - head);
+
+			ptr = static_cast<char*>(base) + head;
+#	ifdef MADV_HUGEPAGE
+			madvise(ptr, size, MADV_HUGEPAGE);
+#	endif
+		} else if (!ptr)
+		{
+			ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (ptr == MAP_FAILED)
+				return nullptr;
+		}
+
+		bindPages(ptr, size, placement);
+		return ptr;
+#else
+		VCL_UNREFERENCED_PARAMETER(placement);
+		return aligned_alloc(systemPageSize(), size);
+#endif
+	}
+
+	void deallocatePages(void* ptr, size_t bytes, PageSize pages)
+	{
+#if defined(VCL_ABI_WINAPI)
+		VCL_UNREFERENCED_PARAMETER(bytes);
+		VCL_UNREFERENCED_PARAMETER(pages);
+		VirtualFree(ptr, 0, MEM_RELEASE);
+#elif defined(VCL_ABI_POSIX)
+		munmap(ptr, pageMappingSize(bytes, pages));
+#else
+		VCL_UNREFERENCED_PARAMETER(bytes);
+		VCL_UNREFERENCED_PARAMETER(pages);
+		free(ptr);
+#endif
+	}
+}}}
@@ -268,6 +268,127 @@ namespace Vcl { namespace Core {
 		return false;
 	}
 
+	//! Type of the pages backing an allocation
+	enum class PageSize
+	{
+		//! Regular pages of the operating system
+		Regular,
+		//! Regular pages, aligned and marked as candidates for transparent huge pages
+		Transparent,
+		//! Explicit 2 MB pages, falling back to transparent huge pages when none are reserved
+		Huge
+	};
+
+	//! Placement of the pages on the NUMA nodes
+	enum class NumaPlacement
+	{
+		//! Placement policy of the calling thread
+		Default,
+		//! Pages are placed on the node of the thread touching them first
+		FirstTouch,
+		//! Pages are distributed round-robin across all nodes
+		Interleaved
+	};
+
+	namespace Details {
+		//! Number of bytes mapped for an allocation of 'bytes' bytes
+		size_t pageMappingSize(size_t bytes, PageSize pages);
+
+		//! Map 'bytes' bytes of memory. Returns nullptr on failure.
+		void* allocatePages(size_t bytes, PageSize pages, NumaPlacement placement);
+
+		//! Release memory allocated with 'allocatePages'
+		void deallocatePages(void* ptr, size_t bytes, PageSize pages);
+	}
+
+	/*!
+	 *	Allocation policy mapping memory directly from the operating system.
+	 *	The memory is page aligned and zero initialised. It is only committed
+	 *	when it is first touched, such that the placement of the pages
+	 *	follows the threads initialising the data when using
+	 *	NumaPlacement::FirstTouch. Huge pages reduce the TLB pressure of
+	 *	large buffers, but round every allocation up to 2 MB.
+	 *	On Windows, explicit huge pages require the privilege to lock pages
+	 *	in memory and are not interleaved. Otherwise, regular pages aligned
+	 *	to 2 MB are used, as there are no transparent huge pages.
+	 */
+	template<typename T, PageSize Pages = PageSize::Transparent, NumaPlacement Placement = NumaPlacement::Default>
+	class PageAllocPolicy
+	{
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+	public: // Convert an PageAllocPolicy<T> to PageAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			using other = PageAllocPolicy<U, Pages, Placement>;
+		};
+
+	public:
+		explicit PageAllocPolicy() noexcept = default;
+		explicit PageAllocPolicy(PageAllocPolicy const&) noexcept = default;
+		template<typename U>
+		explicit PageAllocPolicy(PageAllocPolicy<U, Pages, Placement> const&)
+		{}
+
+	public: // Memory allocation
+		pointer allocate(size_type cnt, const_pointer = nullptr)
+		{
+			if (cnt == 0)
+				return nullptr;
+			if (cnt > max_size())
+				throw std::bad_alloc();
+
+			void* ptr = Details::allocatePages(cnt * sizeof(T), Pages, Placement);
+			if (!ptr)
+				throw std::bad_alloc();
+
+			return reinterpret_cast<pointer>(ptr);
+		}
+		void deallocate(pointer p, size_type cnt)
+		{
+			if (p)
+				Details::deallocatePages(p, cnt * sizeof(T), Pages);
+		}
+
+	public: // Size
+		size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max() / sizeof(T);
+		}
+	};
+
+	//! Large buffers backed by 2 MB pages
+	template<typename T>
+	using HugePageAllocPolicy = PageAllocPolicy<T, PageSize::Huge>;
+
+	//! Large buffers shared by all NUMA nodes
+	template<typename T>
+	using InterleavedNumaAllocPolicy = PageAllocPolicy<T, PageSize::Transparent, NumaPlacement::Interleaved>;
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, PageSize Pages, NumaPlacement Placement, typename T2>
+	bool operator==(PageAllocPolicy<T, Pages, Placement> const&, PageAllocPolicy<T2, Pages, Placement> const&)
+	{
+		return true;
+	}
+
+	template<typename T, PageSize Pages, NumaPlacement Placement, typename OtherAllocator>
+	bool operator==(PageAllocPolicy<T, Pages, Placement> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+
 	template<typename T, typename Policy = StandardAllocPolicy<T>, typename Traits = ObjectTraits<T>>
 	class Allocator : public Policy, public Traits
 	{
@@ -293,6 +414,8 @@ namespace Vcl { namespace Core {
 
 	public:
 		explicit Allocator() noexcept = default;
+		explicit Allocator(Policy const& policy) noexcept
+		: Policy(policy) {}
 		Allocator(Allocator const& rhs) noexcept
 		: Policy(rhs), Traits(rhs) {}
 		template<typename U, typename P, typename T2>
@@ -0,0 +1,113 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/arena.h>
+
+// C++ standard library
+#include <algorithm>
+#include <new>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	MemoryArena::MemoryArena(size_t chunk_size)
+	: mChunkSize(chunk_size)
+	{
+		VclRequire(chunk_size > 0, "Chunks have a size.");
+	}
+
+	MemoryArena::~MemoryArena()
+	{
+		for (auto& chunk : mChunks)
+			::operator delete(chunk.data);
+	}
+
+	MemoryArena& MemoryArena::threadLocal()
+	{
+		thread_local MemoryArena arena;
+		return arena;
+	}
+
+	void* MemoryArena::allocate(size_t bytes, size_t alignment)
+	{
+		VclRequire(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment is a power of two.");
+
+		while (mCurrent < mChunks.size())
+		{
+			const Chunk& chunk = mChunks[mCurrent];
+			const size_t base = reinterpret_cast<size_t>(chunk.data);
+			const size_t offset = ((base + mOffset + alignment - 1) & ~(alignment - 1)) - base;
+			if (offset + bytes <= chunk.size)
+			{
+				mOffset = offset + bytes;
+				return chunk.data + offset;
+			}
+
+			// Continue with the next chunk if it is large enough
+			if (mCurrent + 1 == mChunks.size() || mChunks[mCurrent + 1].size < bytes + alignment)
+				break;
+
+			mCurrent++;
+			mOffset = 0;
+		}
+
+		// Insert a new chunk after the current one, such that markers stay valid
+		const size_t size = std::max(mChunkSize, bytes + alignment);
+		Chunk chunk = { static_cast<char*>(::operator new(size)), size };
+		const size_t next = mChunks.empty() ? 0 : mCurrent + 1;
+		mChunks.insert(mChunks.begin() + static_cast<ptrdiff_t>(next), chunk);
+		mCurrent = next;
+		mOffset = 0;
+
+		return allocate(bytes, alignment);
+	}
+
+	void MemoryArena::deallocate(void* ptr, size_t bytes)
+	{
+		if (!ptr || mCurrent >= mChunks.size())
+			return;
+
+		char* data = mChunks[mCurrent].data;
+		if (static_cast<char*>(ptr) + bytes == data + mOffset)
+			mOffset = static_cast<size_t>(static_cast<char*>(ptr) - data);
+	}
+
+	void MemoryArena::rewind(Marker marker)
+	{
+		VclRequire(marker.chunk < mCurrent || (marker.chunk == mCurrent && marker.offset <= mOffset), "Marker was taken before the current state.");
+
+		mCurrent = marker.chunk;
+		mOffset = marker.offset;
+	}
+
+	size_t MemoryArena::capacity() const
+	{
+		size_t size = 0;
+		for (const auto& chunk : mChunks)
+			size += chunk.size;
+
+		return size;
+	}
+}}
@@ -0,0 +1,216 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstddef>
+#include <vector>
+
+// VCL
+#include <vcl/core/memory/allocator.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Monotonic memory arena handing out memory by bumping a pointer.
+	 *	Memory is only released in bulk by rewinding the arena to a previous
+	 *	state. The memory chunks are kept for later allocations.
+	 */
+	class MemoryArena
+	{
+	public:
+		//! State of the arena which can be restored later
+		struct Marker
+		{
+			size_t chunk;
+			size_t offset;
+		};
+
+	public:
+		/*!
+		 *	\param chunk_size Minimum size of the chunks requested from the system
+		 */
+		explicit MemoryArena(size_t chunk_size = 64 * 1024);
+		~MemoryArena();
+
+		MemoryArena(const MemoryArena&) = delete;
+		MemoryArena& operator=(const MemoryArena&) = delete;
+
+		//! Arena owned by the calling thread. Memory allocated from it has to
+		//! be released before the thread terminates.
+		static MemoryArena& threadLocal();
+
+	public:
+		void* allocate(size_t bytes, size_t alignment);
+
+		//! Return memory to the arena if it is the most recent allocation.
+		//! Other memory is only released when rewinding the arena.
+		void deallocate(void* ptr, size_t bytes);
+
+		//! Current state of the arena
+		Marker mark() const { return { mCurrent, mOffset }; }
+
+		//! Release all memory allocated after 'marker' was taken
+		void rewind(Marker marker);
+
+		//! Release all memory
+		void reset() { rewind({ 0, 0 }); }
+
+		//! Number of bytes reserved from the system
+		size_t capacity() const;
+
+	private:
+		struct Chunk
+		{
+			char* data;
+			size_t size;
+		};
+
+		//! Chunks of memory. Chunks after 'mCurrent' are unused.
+		std::vector<Chunk> mChunks;
+
+		//! Chunk used for allocations
+		size_t mCurrent{ 0 };
+
+		//! First unused byte in the current chunk
+		size_t mOffset{ 0 };
+
+		//! Minimum size of a chunk
+		size_t mChunkSize;
+	};
+
+	/*!
+	 *	Rewinds an arena to the state at construction of the scope.
+	 */
+	class ArenaScope
+	{
+	public:
+		explicit ArenaScope(MemoryArena& arena = MemoryArena::threadLocal())
+		: mArena(arena)
+		, mMarker(arena.mark())
+		{
+		}
+
+		~ArenaScope()
+		{
+			mArena.rewind(mMarker);
+		}
+
+		ArenaScope(const ArenaScope&) = delete;
+		ArenaScope& operator=(const ArenaScope&) = delete;
+
+	private:
+		MemoryArena& mArena;
+		MemoryArena::Marker mMarker;
+	};
+
+	/*!
+	 *	Allocation policy serving memory from a MemoryArena, by default the
+	 *	arena of the calling thread.
+	 */
+	template<typename T>
+	class ArenaAllocPolicy
+	{
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+	public: // Convert an ArenaAllocPolicy<T> to ArenaAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			using other = ArenaAllocPolicy<U>;
+		};
+
+	public:
+		explicit ArenaAllocPolicy() noexcept
+		: mArena(&MemoryArena::threadLocal())
+		{}
+		explicit ArenaAllocPolicy(MemoryArena& arena) noexcept
+		: mArena(&arena)
+		{}
+		explicit ArenaAllocPolicy(ArenaAllocPolicy const&) noexcept = default;
+		template<typename U>
+		explicit ArenaAllocPolicy(ArenaAllocPolicy<U> const& rhs)
+		: mArena(&rhs.arena())
+		{}
+
+	public: // Memory allocation
+		pointer allocate(size_type cnt, const_pointer = nullptr)
+		{
+			if (cnt > max_size())
+				throw std::bad_alloc();
+
+			return reinterpret_cast<pointer>(mArena->allocate(cnt * sizeof(T), alignof(T)));
+		}
+		void deallocate(pointer p, size_type cnt)
+		{
+			mArena->deallocate(p, cnt * sizeof(T));
+		}
+
+	public: // Size
+		size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max() / sizeof(T);
+		}
+
+	public:
+		MemoryArena& arena() const
+		{
+			return *mArena;
+		}
+
+	private:
+		//! Arena providing the memory
+		MemoryArena* mArena;
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, typename T2>
+	bool operator==(ArenaAllocPolicy<T> const& lhs, ArenaAllocPolicy<T2> const& rhs)
+	{
+		return &lhs.arena() == &rhs.arena();
+	}
+
+	template<typename T, typename OtherAllocator>
+	bool operator==(ArenaAllocPolicy<T> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+
+	//! Allocator using the arena of the calling thread
+	template<typename T>
+	using ArenaAllocator = Allocator<T, ArenaAllocPolicy<T>>;
+}}
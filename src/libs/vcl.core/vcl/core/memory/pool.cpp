@@ -0,0 +1,120 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/memory/pool.h>
+
+// C++ standard library
+#include <new>
+
+// VCL
+#include <vcl/core/contract.h>
+
+namespace Vcl { namespace Core {
+	MemoryPool::MemoryPool(size_t block_size, size_t alignment, size_t blocks_per_chunk)
+	: mAlignment(std::max(alignment, alignof(FreeBlock)))
+	, mBlocksPerChunk(blocks_per_chunk)
+	{
+		VclRequire(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment is a power of two.");
+		VclRequire(blocks_per_chunk > 0, "Chunks contain blocks.");
+
+		// Every block needs to be able to store the free list node
+		const size_t size = std::max(block_size, sizeof(FreeBlock));
+		mBlockSize = (size + mAlignment - 1) / mAlignment * mAlignment;
+
+		// Keep the blocks aligned behind the pointer to the owning pool
+		mHeaderSize = (sizeof(MemoryPool*) + mAlignment - 1) / mAlignment * mAlignment;
+	}
+
+	MemoryPool::~MemoryPool()
+	{
+		for (void* chunk : mChunks)
+			::operator delete(chunk);
+	}
+
+	bool MemoryPool::reclaim()
+	{
+		FreeBlock* returned = mRemoteFree.exchange(nullptr, std::memory_order_acquire);
+		if (!returned)
+			return false;
+
+		mFree = returned;
+		for (FreeBlock* block = returned; block; block = block->next)
+			mInUse--;
+
+		return true;
+	}
+
+	void MemoryPool::deallocateRemote(FreeBlock* block)
+	{
+		FreeBlock* head = mRemoteFree.load(std::memory_order_acquire);
+		do
+		{
+			// The owning thread is gone, the last returned block destroys the pool
+			if (head == orphaned())
+			{
+				if (mOutstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					delete this;
+				return;
+			}
+
+			block->next = head;
+		} while (!mRemoteFree.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_acquire));
+	}
+
+	void MemoryPool::release()
+	{
+		// Blocks returned after this point only decrement the counter. The owner
+		// holds an additional reference, such that a block returned concurrently
+		// cannot destroy the pool before the owner is done with it.
+		mOutstanding.store(mInUse + 1, std::memory_order_relaxed);
+		FreeBlock* returned = mRemoteFree.exchange(orphaned(), std::memory_order_acq_rel);
+
+		size_t count = 1;
+		for (FreeBlock* block = returned; block; block = block->next)
+			count++;
+
+		if (mOutstanding.fetch_sub(count, std::memory_order_acq_rel) == count)
+			delete this;
+	}
+
+	void MemoryPool::grow()
+	{
+		// Over-allocate to align the first block
+		const size_t stride = mHeaderSize + mBlockSize;
+		char* chunk = static_cast<char*>(::operator new(stride * mBlocksPerChunk + mAlignment));
+		mChunks.push_back(chunk);
+
+		const size_t base = reinterpret_cast<size_t>(chunk);
+		char* first = chunk + (((base + mAlignment - 1) & ~(mAlignment - 1)) - base) + mHeaderSize;
+
+		// Tag the blocks with their owner and link them in address order
+		for (size_t i = mBlocksPerChunk; i > 0; i--)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(first + (i - 1) * stride);
+			reinterpret_cast<MemoryPool**>(block)[-1] = this;
+			block->next = mFree;
+			mFree = block;
+		}
+	}
+}}
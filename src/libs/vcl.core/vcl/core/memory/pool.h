@@ -0,0 +1,264 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// VCL
+#include <vcl/core/memory/allocator.h>
+
+namespace Vcl { namespace Core {
+	/*!
+	 *	Pool of fixed-size memory blocks. Unused blocks are linked in an
+	 *	intrusive free list, such that allocation and deallocation are a
+	 *	single pointer exchange.
+	 *
+	 *	Every block is tagged with the pool it was allocated from. Blocks
+	 *	released through a different pool are sent back to their owner
+	 *	through a lock-free list, which the owner reclaims once its own
+	 *	free list runs empty.
+	 */
+	class MemoryPool
+	{
+	public:
+		/*!
+		 *	\param block_size       Size of a single block
+		 *	\param alignment        Alignment of each block
+		 *	\param blocks_per_chunk Number of blocks requested from the system at once
+		 */
+		MemoryPool(size_t block_size, size_t alignment = alignof(std::max_align_t), size_t blocks_per_chunk = 256);
+		~MemoryPool();
+
+		MemoryPool(const MemoryPool&) = delete;
+		MemoryPool& operator=(const MemoryPool&) = delete;
+
+		/*!
+		 *	Pool owned by the calling thread. Memory allocated from it may be
+		 *	released on any thread. When the thread terminates while blocks
+		 *	are still in use elsewhere, the pool is kept alive until the last
+		 *	of them is returned.
+		 */
+		template<size_t BlockSize, size_t Alignment>
+		static MemoryPool& threadLocal()
+		{
+			struct Owner
+			{
+				~Owner() { pool->release(); }
+				MemoryPool* pool = new MemoryPool{ BlockSize, Alignment };
+			};
+			thread_local Owner owner;
+			return *owner.pool;
+		}
+
+	public:
+		void* allocate()
+		{
+			if (!mFree && !reclaim())
+				grow();
+
+			FreeBlock* block = mFree;
+			mFree = block->next;
+			mInUse++;
+			return block;
+		}
+
+		void deallocate(void* ptr)
+		{
+			if (!ptr)
+				return;
+
+			FreeBlock* block = static_cast<FreeBlock*>(ptr);
+			MemoryPool* owner = ownerOf(block);
+			if (owner != this)
+			{
+				owner->deallocateRemote(block);
+				return;
+			}
+
+			block->next = mFree;
+			mFree = block;
+			mInUse--;
+		}
+
+		//! Size of a single block
+		size_t blockSize() const { return mBlockSize; }
+
+		//! Number of blocks reserved from the system
+		size_t capacity() const { return mChunks.size() * mBlocksPerChunk; }
+
+	private:
+		//! Node of the free list stored in the unused blocks
+		struct FreeBlock
+		{
+			FreeBlock* next;
+		};
+
+		//! Pool a block was allocated from, stored in front of the block
+		static MemoryPool* ownerOf(FreeBlock* block)
+		{
+			return reinterpret_cast<MemoryPool**>(block)[-1];
+		}
+
+		//! Marks the list of returned blocks of a pool whose thread terminated
+		static FreeBlock* orphaned()
+		{
+			return reinterpret_cast<FreeBlock*>(alignof(FreeBlock));
+		}
+
+		//! Allocate a new chunk and add its blocks to the free list
+		void grow();
+
+		//! Move the blocks returned by other threads to the free list
+		bool reclaim();
+
+		//! Return a block released through another pool
+		void deallocateRemote(FreeBlock* block);
+
+		//! Destroy the pool as soon as all its blocks are returned
+		void release();
+
+	private:
+		//! First unused block
+		FreeBlock* mFree{ nullptr };
+
+		//! Blocks returned by other threads
+		std::atomic<FreeBlock*> mRemoteFree{ nullptr };
+
+		//! Number of blocks not on the free list
+		size_t mInUse{ 0 };
+
+		//! Number of blocks still missing after the owning thread terminated
+		std::atomic<size_t> mOutstanding{ 0 };
+
+		//! Chunks of memory requested from the system
+		std::vector<void*> mChunks;
+
+		//! Size of a single block, including padding to the alignment
+		size_t mBlockSize;
+
+		//! Space in front of each block holding the owning pool
+		size_t mHeaderSize;
+
+		//! Alignment of the blocks
+		size_t mAlignment;
+
+		//! Number of blocks in a chunk
+		size_t mBlocksPerChunk;
+	};
+
+	/*!
+	 *	Allocation policy serving requests of up to 'BlockSize' bytes from a
+	 *	thread-local pool of fixed-size blocks. Larger requests are forwarded
+	 *	to the global heap. Blocks freed on another thread are returned to
+	 *	the pool of the allocating thread.
+	 */
+	template<typename T, size_t BlockSize = 256>
+	class PoolAllocPolicy
+	{
+	public:
+		using value_type = T;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		//! Size of the blocks, large enough to hold at least one object
+		static const size_t Block = BlockSize > sizeof(T) ? BlockSize : sizeof(T);
+
+	public: // Convert an PoolAllocPolicy<T> to PoolAllocPolicy<U>
+		template<typename U>
+		struct rebind
+		{
+			using other = PoolAllocPolicy<U, BlockSize>;
+		};
+
+	public:
+		explicit PoolAllocPolicy() noexcept = default;
+		explicit PoolAllocPolicy(PoolAllocPolicy const&) noexcept = default;
+		template<typename U>
+		explicit PoolAllocPolicy(PoolAllocPolicy<U, BlockSize> const&)
+		{}
+
+	public: // Memory allocation
+		pointer allocate(size_type cnt, const_pointer = nullptr)
+		{
+			if (cnt > max_size())
+				throw std::bad_alloc();
+
+			if (cnt * sizeof(T) <= Block)
+				return reinterpret_cast<pointer>(pool().allocate());
+			else
+				return reinterpret_cast<pointer>(::operator new(cnt * sizeof(T)));
+		}
+		void deallocate(pointer p, size_type cnt)
+		{
+			if (cnt * sizeof(T) <= Block)
+				pool().deallocate(p);
+			else
+				::operator delete(p);
+		}
+
+	public: // Size
+		size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max() / sizeof(T);
+		}
+
+	private:
+		static MemoryPool& pool()
+		{
+			return MemoryPool::threadLocal<Block, alignof(T)>();
+		}
+	};
+
+	/*
+	 *	Determines if memory from another
+	 *	allocator can be deallocated from this one
+	 */
+	template<typename T, size_t BlockSize, typename T2>
+	bool operator==(PoolAllocPolicy<T, BlockSize> const&, PoolAllocPolicy<T2, BlockSize> const&)
+	{
+		return PoolAllocPolicy<T, BlockSize>::Block == PoolAllocPolicy<T2, BlockSize>::Block && alignof(T) == alignof(T2);
+	}
+
+	template<typename T, size_t BlockSize, typename OtherAllocator>
+	bool operator==(PoolAllocPolicy<T, BlockSize> const&, OtherAllocator const&)
+	{
+		return false;
+	}
+
+	//! Allocator using the pools of the calling thread
+	template<typename T>
+	using PoolAllocator = Allocator<T, PoolAllocPolicy<T>>;
+}}
@@ -0,0 +1,579 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// Abseil
+#include <absl/utility/utility.h>
+
+// VCL
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/contract.h>
+#include <vcl/core/span.h>
+
+namespace Vcl { namespace Core { namespace Simd {
+	//! Width of the vectors filling a single register of the target
+	template<typename Scalar>
+	struct NativeWidth : std::integral_constant<
+		int,
+#if defined(VCL_VECTORIZE_AVX512)
+		sizeof(Scalar) == 8 ? 8 : 16
+#elif defined(VCL_VECTORIZE_AVX)
+		sizeof(Scalar) == 8 ? 4 : 8
+#else
+		4
+#endif
+		>
+	{
+	};
+
+	namespace Details {
+		//! Select the native width if no width was requested
+		template<typename Scalar, int Width>
+		struct AlgorithmWidth : std::integral_constant<int, Width == 0 ? NativeWidth<Scalar>::value : Width>
+		{
+		};
+
+		//! Horizontal sum using the horizontal dot product of the vector
+		template<int Width>
+		VCL_STRONG_INLINE float horizontal_sum(const VectorScalar<float, Width>& v) noexcept
+		{
+			return v.dot(VectorScalar<float, Width>(1.0f));
+		}
+		template<int Width>
+		VCL_STRONG_INLINE double horizontal_sum(const VectorScalar<double, Width>& v) noexcept
+		{
+			return v.dot(VectorScalar<double, Width>(1.0));
+		}
+		template<typename Scalar, int Width>
+		VCL_STRONG_INLINE Scalar horizontal_sum(const VectorScalar<Scalar, Width>& v) noexcept
+		{
+			Scalar sum = v[0];
+			for (int i = 1; i < Width; i++)
+				sum += v[i];
+			return sum;
+		}
+
+		/*!
+		 *	Shift the lanes of the register pair ('prev', 'cur') by 'Count' lanes towards
+		 *	the end, i.e., return the last 'Count' lanes of 'prev' followed by the leading
+		 *	lanes of 'cur'. The overloads take the registers by type instead of a template
+		 *	parameter, as GCC ignores the attributes of vector types used as template arguments.
+		 */
+		template<int Count>
+		VCL_STRONG_INLINE float shift_register(float cur, float) noexcept
+		{
+			return cur;
+		}
+		template<int Count>
+		VCL_STRONG_INLINE double shift_register(double cur, double) noexcept
+		{
+			return cur;
+		}
+		template<int Count>
+		VCL_STRONG_INLINE int shift_register(int cur, int) noexcept
+		{
+			return cur;
+		}
+
+#if defined(VCL_VECTORIZE_SSE)
+		template<int Bytes>
+		VCL_STRONG_INLINE __m128i shift_bytes(__m128i cur, __m128i prev) noexcept
+		{
+#	if defined(VCL_VECTORIZE_SSSE3)
+			return _mm_alignr_epi8(cur, prev, 16 - Bytes);
+#	else
+			return _mm_or_si128(_mm_slli_si128(cur, Bytes), _mm_srli_si128(prev, 16 - Bytes));
+#	endif
+		}
+
+		template<int Count>
+		VCL_STRONG_INLINE __m128i shift_register(__m128i cur, __m128i prev) noexcept
+		{
+			return shift_bytes<4 * Count>(cur, prev);
+		}
+		template<int Count>
+		VCL_STRONG_INLINE __m128 shift_register(__m128 cur, __m128 prev) noexcept
+		{
+			return _mm_castsi128_ps(shift_bytes<4 * Count>(_mm_castps_si128(cur), _mm_castps_si128(prev)));
+		}
+		template<int Count>
+		VCL_STRONG_INLINE __m128d shift_register(__m128d cur, __m128d prev) noexcept
+		{
+			return _mm_castsi128_pd(shift_bytes<8 * Count>(_mm_castpd_si128(cur), _mm_castpd_si128(prev)));
+		}
+#endif
+
+#if defined(VCL_VECTORIZE_AVX)
+		//! Shift the bytes of each 128-bit half separately
+		template<int Bytes>
+		VCL_STRONG_INLINE __m256i shift_bytes_per_half(__m256i cur, __m256i prev) noexcept
+		{
+#	if defined(VCL_VECTORIZE_AVX2)
+			return _mm256_alignr_epi8(cur, prev, 16 - Bytes);
+#	else
+			const __m128i lo = shift_bytes<Bytes>(_mm256_castsi256_si128(cur), _mm256_castsi256_si128(prev));
+			const __m128i hi = shift_bytes<Bytes>(_mm256_extractf128_si256(cur, 1), _mm256_extractf128_si256(prev, 1));
+			return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+#	endif
+		}
+
+		// The upper half of 'prev' followed by the lower half of 'cur'
+		// provides the lanes crossing the 128-bit boundary
+		template<int Bytes>
+		VCL_STRONG_INLINE __m256i shift_bytes(__m256i cur, __m256i prev, std::integral_constant<int, 0>) noexcept
+		{
+			return shift_bytes_per_half<Bytes>(cur, _mm256_permute2f128_si256(prev, cur, 0x21));
+		}
+		template<int Bytes>
+		VCL_STRONG_INLINE __m256i shift_bytes(__m256i cur, __m256i prev, std::integral_constant<int, 1>) noexcept
+		{
+			return _mm256_permute2f128_si256(prev, cur, 0x21);
+		}
+		template<int Bytes>
+		VCL_STRONG_INLINE __m256i shift_bytes(__m256i cur, __m256i prev, std::integral_constant<int, 2>) noexcept
+		{
+			return shift_bytes_per_half<Bytes - 16>(_mm256_permute2f128_si256(prev, cur, 0x21), prev);
+		}
+		template<int Bytes>
+		VCL_STRONG_INLINE __m256i shift_bytes(__m256i cur, __m256i prev) noexcept
+		{
+			return shift_bytes<Bytes>(cur, prev, std::integral_constant<int, (Bytes < 16) ? 0 : (Bytes == 16) ? 1 : 2>{});
+		}
+
+		template<int Count>
+		VCL_STRONG_INLINE __m256i shift_register(__m256i cur, __m256i prev) noexcept
+		{
+			return shift_bytes<4 * Count>(cur, prev);
+		}
+		template<int Count>
+		VCL_STRONG_INLINE __m256 shift_register(__m256 cur, __m256 prev) noexcept
+		{
+			return _mm256_castsi256_ps(shift_bytes<4 * Count>(_mm256_castps_si256(cur), _mm256_castps_si256(prev)));
+		}
+		template<int Count>
+		VCL_STRONG_INLINE __m256d shift_register(__m256d cur, __m256d prev) noexcept
+		{
+			return _mm256_castsi256_pd(shift_bytes<8 * Count>(_mm256_castpd_si256(cur), _mm256_castpd_si256(prev)));
+		}
+#endif
+
+#if defined(VCL_VECTORIZE_AVX512)
+		template<int Count>
+		VCL_STRONG_INLINE __m512i shift_register(__m512i cur, __m512i prev) noexcept
+		{
+			return Count == 0 ? cur : _mm512_alignr_epi32(cur, prev, (16 - Count) & 15);
+		}
+		template<int Count>
+		VCL_STRONG_INLINE __m512 shift_register(__m512 cur, __m512 prev) noexcept
+		{
+			return _mm512_castsi512_ps(shift_register<Count>(_mm512_castps_si512(cur), _mm512_castps_si512(prev)));
+		}
+		template<int Count>
+		VCL_STRONG_INLINE __m512d shift_register(__m512d cur, __m512d prev) noexcept
+		{
+			return Count == 0 ? cur : _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(cur), _mm512_castpd_si512(prev), (8 - Count) & 7));
+		}
+#endif
+
+#if defined(VCL_VECTORIZE_NEON)
+		template<int Count>
+		VCL_STRONG_INLINE float32x4_t shift_register(float32x4_t cur, float32x4_t prev) noexcept
+		{
+			return Count == 0 ? cur : vextq_f32(prev, cur, (4 - Count) & 3);
+		}
+		template<int Count>
+		VCL_STRONG_INLINE int32x4_t shift_register(int32x4_t cur, int32x4_t prev) noexcept
+		{
+			return Count == 0 ? cur : vextq_s32(prev, cur, (4 - Count) & 3);
+		}
+#endif
+
+		template<int Count, typename Scalar, int Width, size_t... Rs>
+		VCL_STRONG_INLINE VectorScalar<Scalar, Width> shift_lanes(const VectorScalar<Scalar, Width>& v, absl::index_sequence<Rs...>) noexcept
+		{
+			using reg_t = decltype(v.get(0));
+			constexpr int lanes = static_cast<int>(sizeof(reg_t) / sizeof(Scalar));
+			constexpr int pad = Count / lanes + 1;
+
+			// Registers shifted in completely are zero
+			reg_t regs[pad + sizeof...(Rs)];
+			for (int r = 0; r < pad; r++)
+				regs[r] = reg_t{};
+			for (int r = 0; r < static_cast<int>(sizeof...(Rs)); r++)
+				regs[pad + r] = v.get(r);
+
+			return VectorScalar<Scalar, Width>(shift_register<Count % lanes>(regs[Rs + 1], regs[Rs])...);
+		}
+
+		/*!
+		 *	Shift the lanes of 'v' by 'Count' lanes towards the end, filling in zeros.
+		 *	The lanes are moved within the registers to avoid a round-trip through memory.
+		 */
+		template<int Count, typename Scalar, int Width>
+		VCL_STRONG_INLINE VectorScalar<Scalar, Width> shift_lanes(const VectorScalar<Scalar, Width>& v) noexcept
+		{
+			using reg_t = decltype(v.get(0));
+			static_assert(sizeof(v) % sizeof(reg_t) == 0, "Vector consists of registers only.");
+			return shift_lanes<Count>(v, absl::make_index_sequence<sizeof(v) / sizeof(reg_t)>{});
+		}
+
+		//! Prefix sum of the lanes of 'v' in log2(Width) shift-and-add steps
+		template<int Count, typename Scalar, int Width>
+		VCL_STRONG_INLINE VectorScalar<Scalar, Width> scan_lanes(const VectorScalar<Scalar, Width>& v, std::true_type) noexcept
+		{
+			return v;
+		}
+		template<int Count, typename Scalar, int Width>
+		VCL_STRONG_INLINE VectorScalar<Scalar, Width> scan_lanes(const VectorScalar<Scalar, Width>& v, std::false_type) noexcept
+		{
+			return scan_lanes<2 * Count>(v + shift_lanes<Count>(v), std::integral_constant<bool, (2 * Count >= Width)>{});
+		}
+		template<typename Scalar, int Width>
+		VCL_STRONG_INLINE VectorScalar<Scalar, Width> scan_lanes(const VectorScalar<Scalar, Width>& v) noexcept
+		{
+			return scan_lanes<1>(v, std::integral_constant<bool, (Width <= 1)>{});
+		}
+	}
+
+	/*!
+	 *	\brief Sum of all entries of 'values' and 'init'
+	 *
+	 *	The entries are accumulated in 'Width' independent lanes, thus the order
+	 *	of the floating point additions differs from a sequential summation.
+	 */
+	template<int Width = 0, typename T>
+	std::remove_const_t<T> reduce(stdext::span<T> values, std::remove_const_t<T> init = 0)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		const size_t size = values.size();
+		const scalar_t* data = values.data();
+
+		vector_t acc{ scalar_t(0) };
+		size_t i = 0;
+		for (; i + width <= size; i += width)
+		{
+			vector_t v;
+			load(v, data + i);
+			acc += v;
+		}
+		if (i < size)
+		{
+			// Inactive lanes are zero
+			vector_t v;
+			load_n(v, data + i, static_cast<int>(size - i));
+			acc += v;
+		}
+
+		return init + Details::horizontal_sum(acc);
+	}
+
+	/*!
+	 *	\brief Reduce all entries of 'values' and 'init' using 'op'
+	 *
+	 *	'op' needs to be associative and commutative, and callable on the
+	 *	vector as well as on the scalar type, e.g. a generic lambda.
+	 */
+	template<int Width = 0, typename T, typename BinaryOp>
+	std::remove_const_t<T> reduce(stdext::span<T> values, std::remove_const_t<T> init, BinaryOp op)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		const size_t size = values.size();
+		const scalar_t* data = values.data();
+		if (size < static_cast<size_t>(width))
+		{
+			for (size_t i = 0; i < size; i++)
+				init = op(init, data[i]);
+			return init;
+		}
+
+		vector_t acc;
+		load(acc, data);
+		size_t i = width;
+		for (; i + width <= size; i += width)
+		{
+			vector_t v;
+			load(v, data + i);
+			acc = op(acc, v);
+		}
+		if (i < size)
+		{
+			// Only combine the active lanes, 'op' has no known neutral element
+			const int count = static_cast<int>(size - i);
+			vector_t v;
+			load_n(v, data + i, count);
+			acc = select(Details::prefix_mask<width>(count), op(acc, v), acc);
+		}
+
+		for (int l = 0; l < width; l++)
+			init = op(init, acc[l]);
+		return init;
+	}
+
+	/*!
+	 *	\brief Smallest and largest entry of 'values'
+	 *
+	 *	Uses the horizontal minimum and maximum of the vectors for the final reduction.
+	 */
+	template<int Width = 0, typename T>
+	std::pair<std::remove_const_t<T>, std::remove_const_t<T>> minmax(stdext::span<T> values)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		VclRequire(!values.empty(), "Values are not empty.");
+
+		const size_t size = values.size();
+		const scalar_t* data = values.data();
+
+		// Initialize with the first entry in order to support arbitrary tails
+		vector_t lo{ data[0] };
+		vector_t hi{ data[0] };
+		size_t i = 0;
+		for (; i + width <= size; i += width)
+		{
+			vector_t v;
+			load(v, data + i);
+			lo = lo.min(v);
+			hi = hi.max(v);
+		}
+		if (i < size)
+		{
+			vector_t v{ data[0] };
+			load(v, data + i, Details::prefix_mask<width>(static_cast<int>(size - i)));
+			lo = lo.min(v);
+			hi = hi.max(v);
+		}
+
+		return { lo.min(), hi.max() };
+	}
+
+	/*!
+	 *	\brief Compute several dot products in a single pass
+	 *
+	 *	Each vector in 'vectors' is loaded once per block, the entry 'k' of the
+	 *	result is the dot product of the vectors indexed by 'products[k]'.
+	 *	All vectors need to have the same size.
+	 */
+	template<int Width = 0, typename T, size_t K, size_t N>
+	std::array<std::remove_const_t<T>, N> multi_dot(
+		const std::array<stdext::span<T>, K>& vectors,
+		const std::array<std::pair<int, int>, N>& products)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		const size_t size = K > 0 ? vectors[0].size() : 0;
+		for (size_t k = 0; k < K; k++)
+			VclRequire(vectors[k].size() == size, "All vectors have the same size.");
+		for (size_t p = 0; p < N; p++)
+			VclRequire(0 <= products[p].first && products[p].first < static_cast<int>(K) && 0 <= products[p].second && products[p].second < static_cast<int>(K), "Product references valid vectors.");
+
+		std::array<vector_t, N> acc;
+		acc.fill(vector_t{ scalar_t(0) });
+
+		std::array<vector_t, K> v;
+		for (size_t i = 0; i < size; i += width)
+		{
+			// Inactive lanes of the tail are zero and do not contribute
+			const int count = static_cast<int>(std::min<size_t>(width, size - i));
+			for (size_t k = 0; k < K; k++)
+			{
+				if (count == width)
+					load(v[k], vectors[k].data() + i);
+				else
+					load_n(v[k], vectors[k].data() + i, count);
+			}
+
+			for (size_t p = 0; p < N; p++)
+				acc[p] = fma(v[products[p].first], v[products[p].second], acc[p]);
+		}
+
+		std::array<scalar_t, N> result;
+		for (size_t p = 0; p < N; p++)
+			result[p] = Details::horizontal_sum(acc[p]);
+		return result;
+	}
+
+	/*!
+	 *	\brief Apply 'op' to each vector of entries of 'in' and write the result to 'out'
+	 *
+	 *	'op' is called with vectors of 'Width' entries; 'in' and 'out' may be the same.
+	 */
+	template<int Width = 0, typename T, typename U, typename UnaryOp>
+	void transform(stdext::span<T> in, stdext::span<U> out, UnaryOp op)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		VclRequire(out.size() >= in.size(), "Output is large enough.");
+
+		const size_t size = in.size();
+		size_t i = 0;
+		for (; i + width <= size; i += width)
+		{
+			vector_t v;
+			load(v, in.data() + i);
+			store(out.data() + i, op(v));
+		}
+		if (i < size)
+		{
+			const int count = static_cast<int>(size - i);
+			vector_t v;
+			load_n(v, in.data() + i, count);
+			store_n(out.data() + i, op(v), count);
+		}
+	}
+
+	/*!
+	 *	\brief Apply 'op' to pairs of vectors of 'a' and 'b' and write the result to 'out'
+	 */
+	template<int Width = 0, typename T, typename S, typename U, typename BinaryOp>
+	void transform(stdext::span<T> a, stdext::span<S> b, stdext::span<U> out, BinaryOp op)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		VclRequire(b.size() == a.size(), "Inputs have the same size.");
+		VclRequire(out.size() >= a.size(), "Output is large enough.");
+
+		const size_t size = a.size();
+		size_t i = 0;
+		for (; i + width <= size; i += width)
+		{
+			vector_t u, v;
+			load(u, a.data() + i);
+			load(v, b.data() + i);
+			store(out.data() + i, op(u, v));
+		}
+		if (i < size)
+		{
+			const int count = static_cast<int>(size - i);
+			vector_t u, v;
+			load_n(u, a.data() + i, count);
+			load_n(v, b.data() + i, count);
+			store_n(out.data() + i, op(u, v), count);
+		}
+	}
+
+	/*!
+	 *	\brief Prefix sum, 'out[i] = in[0] + ... + in[i]'
+	 *
+	 *	The prefix sum of a vector is computed in log2(Width) shift-and-add steps,
+	 *	the running total is carried from one vector to the next.
+	 *	'in' and 'out' may be the same.
+	 */
+	template<int Width = 0, typename T, typename U>
+	void inclusive_scan(stdext::span<T> in, stdext::span<U> out)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		VclRequire(out.size() >= in.size(), "Output is large enough.");
+
+		const size_t size = in.size();
+		scalar_t carry = 0;
+		size_t i = 0;
+		for (; i + width <= size; i += width)
+		{
+			vector_t v;
+			load(v, in.data() + i);
+			v = Details::scan_lanes(v) + vector_t(carry);
+
+			store(out.data() + i, v);
+			carry = v[width - 1];
+		}
+		if (i < size)
+		{
+			const int count = static_cast<int>(size - i);
+
+			vector_t v;
+			load_n(v, in.data() + i, count);
+			v = Details::scan_lanes(v) + vector_t(carry);
+
+			store_n(out.data() + i, v, count);
+		}
+	}
+
+	/*!
+	 *	\brief Prefix sum excluding the current entry, 'out[i] = init + in[0] + ... + in[i - 1]'
+	 *
+	 *	'in' and 'out' may be the same.
+	 */
+	template<int Width = 0, typename T, typename U>
+	void exclusive_scan(stdext::span<T> in, stdext::span<U> out, std::remove_const_t<T> init = 0)
+	{
+		using scalar_t = std::remove_const_t<T>;
+		using vector_t = VectorScalar<scalar_t, Details::AlgorithmWidth<scalar_t, Width>::value>;
+		const int width = Details::AlgorithmWidth<scalar_t, Width>::value;
+
+		VclRequire(out.size() >= in.size(), "Output is large enough.");
+
+		const size_t size = in.size();
+		scalar_t carry = init;
+		size_t i = 0;
+		for (; i + width <= size; i += width)
+		{
+			vector_t v;
+			load(v, in.data() + i);
+			v = Details::scan_lanes(v);
+
+			// Shifting the inclusive sums by one lane excludes the current entry
+			const scalar_t total = v[width - 1];
+			store(out.data() + i, Details::shift_lanes<1>(v) + vector_t(carry));
+			carry += total;
+		}
+		if (i < size)
+		{
+			const int count = static_cast<int>(size - i);
+
+			vector_t v;
+			load_n(v, in.data() + i, count);
+			v = Details::shift_lanes<1>(Details::scan_lanes(v)) + vector_t(carry);
+
+			store_n(out.data() + i, v, count);
+		}
+	}
+}}}
@@ -79,6 +79,22 @@ namespace Vcl { namespace Core { namespace Simd {
 		}
 	};
 	template<>
+	struct SimdRegister<double, SimdExt::None>
+	{
+		using Scalar = double;
+		using Type = double;
+		static const int Width = 1;
+
+		VCL_STRONG_INLINE static Type set(Scalar s0) noexcept
+		{
+			return s0;
+		}
+		VCL_STRONG_INLINE static Scalar get(Type vec, int) noexcept
+		{
+			return vec;
+		}
+	};
+	template<>
 	struct SimdRegister<int, SimdExt::None>
 	{
 		using Scalar = int;
@@ -137,6 +153,30 @@ namespace Vcl { namespace Core { namespace Simd {
 		}
 	};
 	template<>
+	struct SimdRegister<double, SimdExt::SSE>
+	{
+		using Scalar = double;
+		using Type = __m128d;
+		static const int Width = 2;
+
+		VCL_STRONG_INLINE static Type set(Scalar s0) noexcept
+		{
+			return _mm_set1_pd(s0);
+		}
+		VCL_STRONG_INLINE static Type set(Scalar s0, Scalar s1) noexcept
+		{
+			return _mm_set_pd(s1, s0);
+		}
+		VCL_STRONG_INLINE static Type set(Type vec) noexcept
+		{
+			return vec;
+		}
+		VCL_STRONG_INLINE static Scalar get(Type vec, int i) noexcept
+		{
+			return _mmVCL_extract_pd(vec, i);
+		}
+	};
+	template<>
 	struct SimdRegister<int, SimdExt::SSE>
 	{
 		using Scalar = int;
@@ -225,6 +265,30 @@ namespace Vcl { namespace Core { namespace Simd {
 		}
 	};
 	template<>
+	struct SimdRegister<double, SimdExt::AVX>
+	{
+		using Scalar = double;
+		using Type = __m256d;
+		static const int Width = 4;
+
+		VCL_STRONG_INLINE static Type set(Scalar s0) noexcept
+		{
+			return _mm256_set1_pd(s0);
+		}
+		VCL_STRONG_INLINE static Type set(Scalar s0, Scalar s1, Scalar s2, Scalar s3) noexcept
+		{
+			return _mm256_set_pd(s3, s2, s1, s0);
+		}
+		VCL_STRONG_INLINE static Type set(Type vec) noexcept
+		{
+			return vec;
+		}
+		VCL_STRONG_INLINE static Scalar get(Type vec, int i) noexcept
+		{
+			return _mmVCL_extract_pd(vec, i);
+		}
+	};
+	template<>
 	struct SimdRegister<int, SimdExt::AVX>
 	{
 		using Scalar = int;
@@ -341,6 +405,38 @@ namespace Vcl { namespace Core { namespace Simd {
 		}
 	};
 	template<>
+	struct SimdRegister<double, SimdExt::AVX512>
+	{
+		using Scalar = double;
+		using Type = __m512d;
+		static const int Width = 8;
+
+		VCL_STRONG_INLINE static Type set(Scalar s0)
+		{
+			return _mm512_set1_pd(s0);
+		}
+		VCL_STRONG_INLINE static Type set(
+			Scalar s0,
+			Scalar s1,
+			Scalar s2,
+			Scalar s3,
+			Scalar s4,
+			Scalar s5,
+			Scalar s6,
+			Scalar s7)
+		{
+			return _mm512_set_pd(s7, s6, s5, s4, s3, s2, s1, s0);
+		}
+		VCL_STRONG_INLINE static Type set(Type vec)
+		{
+			return vec;
+		}
+		VCL_STRONG_INLINE static Scalar get(Type vec, int i)
+		{
+			return _mmVCL_extract_pd(vec, i);
+		}
+	};
+	template<>
 	struct SimdRegister<int, SimdExt::AVX512>
 	{
 		using Scalar = int;
@@ -613,6 +709,18 @@ namespace Vcl { namespace Core { namespace Simd {
 		struct SimdWidthTag
 		{};
 
+		VCL_STRONG_INLINE void setImpl(SimdWidthTag<2>, int i, Scalar s0, Scalar s1) noexcept
+		{
+			_data[i] = SimdRegister<Scalar, Type>::set(s0, s1);
+		}
+
+		template<typename... T>
+		VCL_STRONG_INLINE void setImpl(SimdWidthTag<2> tag, int i, Scalar s0, Scalar s1, T... vals) noexcept
+		{
+			_data[i] = SimdRegister<Scalar, Type>::set(s0, s1);
+			setImpl(tag, i + 1, vals...);
+		}
+
 		VCL_STRONG_INLINE void setImpl(SimdWidthTag<4>, int i, Scalar s0, Scalar s1, Scalar s2, Scalar s3) noexcept
 		{
 			_data[i] = SimdRegister<Scalar, Type>::set(s0, s1, s2, s3);
@@ -732,6 +840,13 @@ namespace Vcl { namespace Core { namespace Simd {
 		{
 			return a / b;
 		}
+		//! Multiply-add without intermediate fusing
+		//! \returns a * b + c
+		template<typename T>
+		VCL_STRONG_INLINE T madd(T a, T b, T c) noexcept
+		{
+			return a * b + c;
+		}
 
 		template<typename T>
 		VCL_STRONG_INLINE bool cmpeq(T a, T b) noexcept
@@ -821,6 +936,12 @@ namespace Vcl { namespace Core { namespace Simd {
 #define VCL_SIMD_P2_8(op, i) VCL_SIMD_P2_4(op, i), VCL_SIMD_P2_4(op, i + 4)
 #define VCL_SIMD_P2_16(op, i) VCL_SIMD_P2_8(op, i), VCL_SIMD_P2_8(op, i + 8)
 
+#define VCL_SIMD_P3_1(op, i) op(get(i), b.get(i), c.get(i))
+#define VCL_SIMD_P3_2(op, i) VCL_SIMD_P3_1(op, i), VCL_SIMD_P3_1(op, i + 1)
+#define VCL_SIMD_P3_4(op, i) VCL_SIMD_P3_2(op, i), VCL_SIMD_P3_2(op, i + 2)
+#define VCL_SIMD_P3_8(op, i) VCL_SIMD_P3_4(op, i), VCL_SIMD_P3_4(op, i + 4)
+#define VCL_SIMD_P3_16(op, i) VCL_SIMD_P3_8(op, i), VCL_SIMD_P3_8(op, i + 8)
+
 #define VCL_SIMD_RED_P1_1(op1, op2, i) op1(get(i))
 #define VCL_SIMD_RED_P1_2(op1, op2, i) op2(VCL_SIMD_RED_P1_1(op1, op2, i), VCL_SIMD_RED_P1_1(op1, op2, i + 1))
 #define VCL_SIMD_RED_P1_4(op1, op2, i) op2(VCL_SIMD_RED_P1_2(op1, op2, i), VCL_SIMD_RED_P1_2(op1, op2, i + 2))
@@ -837,6 +958,8 @@ namespace Vcl { namespace Core { namespace Simd {
 	VCL_STRONG_INLINE Self name() const noexcept { return Self{ VCL_PP_JOIN_2(VCL_SIMD_P1_, N)(op, 0) }; }
 #define VCL_SIMD_BINARY_OP(name, op, N) \
 	VCL_STRONG_INLINE Self name(const Self& rhs) const noexcept { return Self{ VCL_PP_JOIN_2(VCL_SIMD_P2_, N)(op, 0) }; }
+#define VCL_SIMD_TERNARY_OP(name, op, N) \
+	VCL_STRONG_INLINE Self name(const Self& b, const Self& c) const noexcept { return Self{ VCL_PP_JOIN_2(VCL_SIMD_P3_, N)(op, 0) }; }
 #define VCL_SIMD_ASSIGN_OP(name, op, N)                    \
 	VCL_STRONG_INLINE Self& name(const Self& rhs) noexcept \
 	{                                                      \
@@ -845,8 +968,12 @@ namespace Vcl { namespace Core { namespace Simd {
 	}
 #define VCL_SIMD_COMP_OP(name, op, N) \
 	VCL_STRONG_INLINE Bool name(const Self& rhs) const noexcept { return Bool{ VCL_PP_JOIN_2(VCL_SIMD_P2_, N)(op, 0) }; }
+#define VCL_SIMD_COMP_CVT_OP(name, op, cvt, N) \
+	VCL_STRONG_INLINE Bool name(const Self& rhs) const noexcept { return cvt(VCL_PP_JOIN_2(VCL_SIMD_P2_, N)(op, 0)); }
 #define VCL_SIMD_QUERY_OP(name, op, N) \
 	VCL_STRONG_INLINE Bool name() const noexcept { return Bool{ VCL_PP_JOIN_2(VCL_SIMD_P1_, N)(op, 0) }; }
+#define VCL_SIMD_QUERY_CVT_OP(name, op, cvt, N) \
+	VCL_STRONG_INLINE Bool name() const noexcept { return cvt(VCL_PP_JOIN_2(VCL_SIMD_P1_, N)(op, 0)); }
 #define VCL_SIMD_UNARY_REDUCTION_OP(name, op1, op2, N) \
 	VCL_STRONG_INLINE Scalar name() const noexcept { return Scalar{ VCL_PP_JOIN_2(VCL_SIMD_RED_P1_, N)(op1, op2, 0) }; }
 #define VCL_SIMD_BINARY_REDUCTION_OP(name, op1, op2, N) \
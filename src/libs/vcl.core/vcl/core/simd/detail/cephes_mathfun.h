@@ -0,0 +1,272 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <limits>
+
+/*
+ * Single precision elementary functions ported from the Cephes math library
+ * (http://www.netlib.org/cephes/) by Stephen L. Moshier.
+ *
+ * The algorithms are written once against an operation policy 'Ops' which
+ * wraps the intrinsics of a single SIMD register type. A policy provides the
+ * types 'Float', 'Int' and 'Mask' and the operations used below. Polynomials
+ * are evaluated using 'Ops::fmadd' which maps to a fused multiply-add where
+ * the target supports it.
+ *
+ * The stated error bounds were measured against the double precision
+ * standard library over the documented input ranges.
+ */
+namespace Vcl { namespace Core { namespace Simd { namespace Cephes {
+	//! Tangent
+	//! Max. error: 3.5 ulp for |x| <= 100. For larger arguments the accuracy
+	//! close to the zeros and poles is limited by the argument reduction.
+	//! The reduction is valid up to |x| = 8192.
+	template<typename Ops>
+	typename Ops::Float tan(typename Ops::Float x)
+	{
+		using Float = typename Ops::Float;
+
+		const Float sign = Ops::and_(x, Ops::set(-0.0f));
+		const Float ax = Ops::abs(x);
+
+		// Octant of the argument, rounded up to an even number
+		Float j = Ops::floor(Ops::mul(ax, Ops::set(1.27323954473516f)));
+		const Float j_half = Ops::floor(Ops::mul(j, Ops::set(0.5f)));
+		j = Ops::add(j, Ops::sub(j, Ops::add(j_half, j_half)));
+
+		// Extended precision modular arithmetic
+		Float z = Ops::fmadd(j, Ops::set(-0.78515625f), ax);
+		z = Ops::fmadd(j, Ops::set(-2.4187564849853515625e-4f), z);
+		z = Ops::fmadd(j, Ops::set(-3.77489497744594108e-8f), z);
+
+		const Float zz = Ops::mul(z, z);
+		Float p = Ops::set(9.38540185543e-3f);
+		p = Ops::fmadd(p, zz, Ops::set(3.11992232697e-3f));
+		p = Ops::fmadd(p, zz, Ops::set(2.44301354525e-2f));
+		p = Ops::fmadd(p, zz, Ops::set(5.34112807005e-2f));
+		p = Ops::fmadd(p, zz, Ops::set(1.33387994085e-1f));
+		p = Ops::fmadd(p, zz, Ops::set(3.33331568548e-1f));
+		p = Ops::fmadd(Ops::mul(p, zz), z, z);
+
+		// Octants 2 and 6 (mod 8) map to the cotangent
+		const Float j_quarter = Ops::floor(Ops::mul(j, Ops::set(0.25f)));
+		const Float q = Ops::fmadd(j_quarter, Ops::set(-4.0f), j);
+		p = Ops::select(Ops::cmpeq(q, Ops::set(2.0f)), Ops::div(Ops::set(-1.0f), p), p);
+
+		return Ops::xor_(p, sign);
+	}
+
+	//! Inverse tangent
+	//! Max. error: 2 ulp
+	template<typename Ops>
+	typename Ops::Float atan(typename Ops::Float x)
+	{
+		using Float = typename Ops::Float;
+		using Mask = typename Ops::Mask;
+
+		const Float sign = Ops::and_(x, Ops::set(-0.0f));
+		const Float ax = Ops::abs(x);
+
+		// Range reduction:
+		// x > tan(3pi/8): atan(x) = pi/2 + atan(-1/x)
+		// x > tan(pi/8):  atan(x) = pi/4 + atan((x-1)/(x+1))
+		const Mask big = Ops::cmpgt(ax, Ops::set(2.414213562373095f));
+		const Mask mid = Ops::cmpgt(ax, Ops::set(0.4142135623730950f));
+		const Float one = Ops::set(1.0f);
+
+		const Float y0 = Ops::select(big, Ops::set(1.5707963267948966f), Ops::select(mid, Ops::set(0.7853981633974483f), Ops::set(0.0f)));
+		const Float num = Ops::select(big, Ops::set(-1.0f), Ops::select(mid, Ops::sub(ax, one), ax));
+		const Float den = Ops::select(big, ax, Ops::select(mid, Ops::add(ax, one), one));
+		const Float xr = Ops::div(num, den);
+
+		const Float z = Ops::mul(xr, xr);
+		Float p = Ops::set(8.05374449538e-2f);
+		p = Ops::fmadd(p, z, Ops::set(-1.38776856032e-1f));
+		p = Ops::fmadd(p, z, Ops::set(1.99777106478e-1f));
+		p = Ops::fmadd(p, z, Ops::set(-3.33329491539e-1f));
+		p = Ops::fmadd(Ops::mul(p, z), xr, xr);
+
+		return Ops::xor_(Ops::add(y0, p), sign);
+	}
+
+	//! Four quadrant inverse tangent of y/x
+	//! Max. error: 3.5 ulp
+	//! Both arguments being infinite results in NaN.
+	template<typename Ops>
+	typename Ops::Float atan2(typename Ops::Float y, typename Ops::Float x)
+	{
+		using Float = typename Ops::Float;
+		using Mask = typename Ops::Mask;
+
+		const Float zero = Ops::set(0.0f);
+		const Float sign_mask = Ops::set(-0.0f);
+		const Float y_sign = Ops::and_(y, sign_mask);
+
+		// Move the result to the second or third quadrant if the sign of x is
+		// set. Testing the sign bit instead of x < 0 handles x = -0.
+		const Mask x_neg = Ops::cmplt(Ops::or_(Ops::set(1.0f), Ops::and_(x, sign_mask)), zero);
+		const Float offset = Ops::or_(Ops::select(x_neg, Ops::set(3.14159265358979f), zero), y_sign);
+		const Float r = Ops::add(atan<Ops>(Ops::div(y, x)), offset);
+
+		// y/x is undefined if both are zero, the result is the offset alone
+		const Mask both_zero = Ops::mask_and(Ops::cmpeq(x, zero), Ops::cmpeq(y, zero));
+		return Ops::select(both_zero, offset, r);
+	}
+
+	//! Inverse sine
+	//! Max. error: 2.5 ulp
+	//! Returns NaN for |x| > 1.
+	template<typename Ops>
+	typename Ops::Float asin(typename Ops::Float x)
+	{
+		using Float = typename Ops::Float;
+		using Mask = typename Ops::Mask;
+
+		const Float sign = Ops::and_(x, Ops::set(-0.0f));
+		const Float ax = Ops::abs(x);
+
+		// For |x| > 0.5: asin(x) = pi/2 - 2 asin(sqrt((1-x)/2))
+		const Mask big = Ops::cmpgt(ax, Ops::set(0.5f));
+		const Float z_big = Ops::mul(Ops::sub(Ops::set(1.0f), ax), Ops::set(0.5f));
+		const Float z = Ops::select(big, z_big, Ops::mul(ax, ax));
+		const Float xr = Ops::select(big, Ops::sqrt(z_big), ax);
+
+		Float p = Ops::set(4.2163199048e-2f);
+		p = Ops::fmadd(p, z, Ops::set(2.4181311049e-2f));
+		p = Ops::fmadd(p, z, Ops::set(4.5470025998e-2f));
+		p = Ops::fmadd(p, z, Ops::set(7.4953002686e-2f));
+		p = Ops::fmadd(p, z, Ops::set(1.6666752422e-1f));
+		p = Ops::fmadd(Ops::mul(p, z), xr, xr);
+
+		const Float r = Ops::select(big, Ops::sub(Ops::set(1.5707963267948966f), Ops::add(p, p)), p);
+		return Ops::xor_(r, sign);
+	}
+
+	//! Base 2 exponential
+	//! Max. error: 1.5 ulp for results in the normalized range
+	template<typename Ops>
+	typename Ops::Float exp2(typename Ops::Float x)
+	{
+		using Float = typename Ops::Float;
+		using Int = typename Ops::Int;
+
+		const Float xc = Ops::min(Ops::max(x, Ops::set(-151.0f)), Ops::set(129.0f));
+
+		// x = n + f, with |f| <= 0.5
+		const Float n = Ops::floor(Ops::add(xc, Ops::set(0.5f)));
+		const Float f = Ops::sub(xc, n);
+
+		Float p = Ops::set(1.535336188319500e-4f);
+		p = Ops::fmadd(p, f, Ops::set(1.339887440266574e-3f));
+		p = Ops::fmadd(p, f, Ops::set(9.618437357674640e-3f));
+		p = Ops::fmadd(p, f, Ops::set(5.550332471162809e-2f));
+		p = Ops::fmadd(p, f, Ops::set(2.402264791363012e-1f));
+		p = Ops::fmadd(p, f, Ops::set(6.931472028550421e-1f));
+		p = Ops::fmadd(p, f, Ops::set(1.0f));
+
+		// Scale by 2^n in two steps to cover the range of n
+		const Int ni = Ops::cvtt(n);
+		const Int n1 = Ops::template srai<1>(ni);
+		const Int n2 = Ops::sub_i(ni, n1);
+		const Int bias = Ops::set_i(127);
+		const Float s1 = Ops::cast_f(Ops::template slli<23>(Ops::add_i(n1, bias)));
+		const Float s2 = Ops::cast_f(Ops::template slli<23>(Ops::add_i(n2, bias)));
+		const Float r = Ops::mul(Ops::mul(p, s1), s2);
+
+		// The clamping does not preserve NaN
+		return Ops::select(Ops::cmpeq(x, x), r, x);
+	}
+
+	//! Base 2 logarithm
+	//! Max. error: 1.5 ulp
+	//! Returns -inf for 0 and NaN for negative numbers.
+	template<typename Ops>
+	typename Ops::Float log2(typename Ops::Float x)
+	{
+		using Float = typename Ops::Float;
+		using Int = typename Ops::Int;
+		using Mask = typename Ops::Mask;
+
+		// Scale denormalized numbers into the normalized range
+		const Mask denormal = Ops::cmplt(x, Ops::set(1.17549435e-38f));
+		const Float xs = Ops::select(denormal, Ops::mul(x, Ops::set(8388608.0f)), x);
+
+		// Split into exponent and mantissa in [0.5, 1)
+		const Int bits = Ops::cast_i(xs);
+		Float e = Ops::cvt(Ops::sub_i(Ops::template srli<23>(bits), Ops::set_i(126)));
+		e = Ops::select(denormal, Ops::sub(e, Ops::set(23.0f)), e);
+		Float m = Ops::cast_f(Ops::or_i(Ops::and_i(bits, Ops::set_i(0x007fffff)), Ops::set_i(0x3f000000)));
+
+		// Move the mantissa to [sqrt(0.5), sqrt(2))
+		const Mask small = Ops::cmplt(m, Ops::set(0.707106781186547524f));
+		e = Ops::select(small, Ops::sub(e, Ops::set(1.0f)), e);
+		m = Ops::sub(Ops::select(small, Ops::add(m, m), m), Ops::set(1.0f));
+
+		const Float z = Ops::mul(m, m);
+		Float p = Ops::set(7.0376836292e-2f);
+		p = Ops::fmadd(p, m, Ops::set(-1.1514610310e-1f));
+		p = Ops::fmadd(p, m, Ops::set(1.1676998740e-1f));
+		p = Ops::fmadd(p, m, Ops::set(-1.2420140846e-1f));
+		p = Ops::fmadd(p, m, Ops::set(1.4249322787e-1f));
+		p = Ops::fmadd(p, m, Ops::set(-1.6668057665e-1f));
+		p = Ops::fmadd(p, m, Ops::set(2.0000714765e-1f));
+		p = Ops::fmadd(p, m, Ops::set(-2.4999993993e-1f));
+		p = Ops::fmadd(p, m, Ops::set(3.3333331174e-1f));
+		Float y = Ops::mul(Ops::mul(p, m), z);
+		y = Ops::fmadd(z, Ops::set(-0.5f), y);
+
+		// log2(x) = e + (m + y) * log2(e), with log2(e) = 1 + LOG2EA
+		const Float log2ea = Ops::set(0.44269504088896340736f);
+		Float r = Ops::mul(y, log2ea);
+		r = Ops::fmadd(m, log2ea, r);
+		r = Ops::add(Ops::add(Ops::add(r, y), m), e);
+
+		// Special values
+		const Float inf = Ops::set(std::numeric_limits<float>::infinity());
+		r = Ops::select(Ops::cmpge(x, Ops::set(0.0f)), r, Ops::set(std::numeric_limits<float>::quiet_NaN()));
+		r = Ops::select(Ops::cmpeq(x, Ops::set(0.0f)), Ops::sub(Ops::set(0.0f), inf), r);
+		r = Ops::select(Ops::cmpeq(x, inf), inf, r);
+		return r;
+	}
+
+	//! Power function computed as exp2(y log2(x))
+	//! The relative error of log2 is amplified by the magnitude of y log2(x).
+	//! Max. error: 2 + |y log2(x)| ulp
+	//! Negative bases result in NaN.
+	template<typename Ops>
+	typename Ops::Float pow(typename Ops::Float x, typename Ops::Float y)
+	{
+		using Float = typename Ops::Float;
+
+		const Float one = Ops::set(1.0f);
+		const Float r = exp2<Ops>(Ops::mul(y, log2<Ops>(x)));
+		return Ops::select(Ops::mask_or(Ops::cmpeq(y, Ops::set(0.0f)), Ops::cmpeq(x, one)), one, r);
+	}
+}}}}
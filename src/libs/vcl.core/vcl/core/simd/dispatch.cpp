@@ -0,0 +1,220 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/core/simd/dispatch.h>
+
+// C++ standard library
+#include <cstdlib>
+#include <cstring>
+
+#if defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)
+#	if defined(VCL_COMPILER_MSVC)
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif
+
+namespace Vcl { namespace Core { namespace Simd {
+	namespace {
+#if defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)
+		void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) noexcept
+		{
+#	if defined(VCL_COMPILER_MSVC)
+			int r[4];
+			__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+			std::memcpy(regs, r, sizeof(r));
+#	else
+			if (!__get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]))
+				regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#	endif
+		}
+
+		unsigned long long xgetbv() noexcept
+		{
+#	if defined(VCL_COMPILER_MSVC)
+			return _xgetbv(0);
+#	else
+			unsigned int eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<unsigned long long>(edx) << 32) | eax;
+#	endif
+		}
+
+		bool bit(unsigned int reg, unsigned int b) noexcept
+		{
+			return (reg & (1u << b)) != 0;
+		}
+#endif
+
+		CpuFeatures detectCpuFeatures() noexcept
+		{
+			CpuFeatures features;
+
+#if defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)
+			unsigned int regs[4] = {};
+			cpuid(0, 0, regs);
+			const unsigned int max_leaf = regs[0];
+			if (max_leaf < 1)
+				return features;
+
+			cpuid(1, 0, regs);
+			const unsigned int ecx1 = regs[2];
+			const unsigned int edx1 = regs[3];
+			features.SSE2 = bit(edx1, 26);
+			features.SSE3 = bit(ecx1, 0);
+			features.SSSE3 = bit(ecx1, 9);
+			features.SSE4_1 = bit(ecx1, 19);
+			features.SSE4_2 = bit(ecx1, 20);
+			features.POPCNT = bit(ecx1, 23);
+
+			// Extended register state needs to be enabled by the OS
+			bool os_avx = false;
+			bool os_avx512 = false;
+			if (bit(ecx1, 27))
+			{
+				const unsigned long long xcr0 = xgetbv();
+				os_avx = (xcr0 & 0x6) == 0x6;
+				os_avx512 = (xcr0 & 0xe6) == 0xe6;
+			}
+
+			features.AVX = os_avx && bit(ecx1, 28);
+			features.FMA = features.AVX && bit(ecx1, 12);
+			features.F16C = features.AVX && bit(ecx1, 29);
+
+			if (max_leaf >= 7)
+			{
+				cpuid(7, 0, regs);
+				const unsigned int ebx7 = regs[1];
+				features.AVX2 = features.AVX && bit(ebx7, 5);
+				features.BMI2 = bit(ebx7, 8);
+				features.AVX512F = os_avx512 && bit(ebx7, 16);
+				features.AVX512DQ = features.AVX512F && bit(ebx7, 17);
+				features.AVX512BW = features.AVX512F && bit(ebx7, 30);
+				features.AVX512VL = features.AVX512F && bit(ebx7, 31);
+			}
+#elif defined(VCL_ARCH_ARM64) || defined(VCL_VECTORIZE_NEON)
+			features.NEON = true;
+#endif
+			return features;
+		}
+
+		SimdExt supportedSimdExt() noexcept
+		{
+			const auto& f = cpuFeatures();
+			if (f.AVX512F && f.AVX512VL && f.AVX512DQ)
+				return SimdExt::AVX512;
+			if (f.AVX)
+				return SimdExt::AVX;
+			if (f.SSE2)
+				return SimdExt::SSE;
+			if (f.NEON)
+				return SimdExt::NEON;
+			return SimdExt::None;
+		}
+
+		SimdExt detectActiveSimdExt() noexcept
+		{
+			const SimdExt supported = supportedSimdExt();
+
+			// Allow to restrict the used extension, e.g., for testing
+			const char* env = std::getenv("VCL_SIMD_EXT");
+			if (!env)
+				return supported;
+
+			SimdExt requested = supported;
+			if (std::strcmp(env, "None") == 0)
+				requested = SimdExt::None;
+			else if (std::strcmp(env, "SSE") == 0)
+				requested = SimdExt::SSE;
+			else if (std::strcmp(env, "AVX") == 0)
+				requested = SimdExt::AVX;
+			else if (std::strcmp(env, "AVX512") == 0)
+				requested = SimdExt::AVX512;
+			else if (std::strcmp(env, "NEON") == 0)
+				requested = SimdExt::NEON;
+
+			if (requested == SimdExt::None)
+				return SimdExt::None;
+			if (requested == SimdExt::NEON || supported == SimdExt::NEON)
+				return requested == supported ? supported : SimdExt::None;
+
+			return static_cast<int>(requested) < static_cast<int>(supported) ? requested : supported;
+		}
+	}
+
+	const CpuFeatures& cpuFeatures() noexcept
+	{
+		static const CpuFeatures features = detectCpuFeatures();
+		return features;
+	}
+
+	SimdExt compiledSimdExt() noexcept
+	{
+#if defined(VCL_VECTORIZE_AVX512)
+		return SimdExt::AVX512;
+#elif defined(VCL_VECTORIZE_AVX)
+		return SimdExt::AVX;
+#elif defined(VCL_VECTORIZE_SSE)
+		return SimdExt::SSE;
+#elif defined(VCL_VECTORIZE_NEON)
+		return SimdExt::NEON;
+#else
+		return SimdExt::None;
+#endif
+	}
+
+	SimdExt activeSimdExt() noexcept
+	{
+		static const SimdExt ext = detectActiveSimdExt();
+		return ext;
+	}
+
+	bool isSupported(SimdExt ext) noexcept
+	{
+		const SimdExt active = activeSimdExt();
+		switch (ext)
+		{
+		case SimdExt::None: return true;
+		case SimdExt::SSE: return active == SimdExt::SSE || active == SimdExt::AVX || active == SimdExt::AVX512;
+		case SimdExt::AVX: return active == SimdExt::AVX || active == SimdExt::AVX512;
+		case SimdExt::AVX512: return active == SimdExt::AVX512;
+		case SimdExt::NEON: return active == SimdExt::NEON;
+		}
+		return false;
+	}
+
+	const char* name(SimdExt ext) noexcept
+	{
+		switch (ext)
+		{
+		case SimdExt::None: return "None";
+		case SimdExt::SSE: return "SSE";
+		case SimdExt::AVX: return "AVX";
+		case SimdExt::AVX512: return "AVX512";
+		case SimdExt::NEON: return "NEON";
+		}
+		return "Unknown";
+	}
+}}}
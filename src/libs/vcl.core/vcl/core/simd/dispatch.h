@@ -0,0 +1,142 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <initializer_list>
+#include <utility>
+
+// VCL
+#include <vcl/core/contract.h>
+#include <vcl/core/simd/common.h>
+
+namespace Vcl { namespace Core { namespace Simd {
+	//! Instruction set features of the executing processor
+	struct CpuFeatures
+	{
+		bool SSE2{ false };
+		bool SSE3{ false };
+		bool SSSE3{ false };
+		bool SSE4_1{ false };
+		bool SSE4_2{ false };
+		bool POPCNT{ false };
+		bool AVX{ false };
+		bool AVX2{ false };
+		bool FMA{ false };
+		bool F16C{ false };
+		bool BMI2{ false };
+		bool AVX512F{ false };
+		bool AVX512DQ{ false };
+		bool AVX512BW{ false };
+		bool AVX512VL{ false };
+		bool NEON{ false };
+	};
+
+	/*!
+	 *	\brief Query the features of the executing processor
+	 *
+	 *	The features are determined once using 'cpuid'. Extensions requiring
+	 *	additional register state (AVX, AVX-512) are only reported if the
+	 *	operating system saves the corresponding registers.
+	 */
+	const CpuFeatures& cpuFeatures() noexcept;
+
+	//! \returns the vectorization extension the library was configured with
+	SimdExt compiledSimdExt() noexcept;
+
+	/*!
+	 *	\brief Widest vectorization extension used by runtime dispatched code
+	 *
+	 *	The extension is the widest one supported by the executing processor.
+	 *	It can be restricted by setting the environment variable 'VCL_SIMD_EXT'
+	 *	to one of 'None', 'SSE', 'AVX', 'AVX512' before the process starts.
+	 */
+	SimdExt activeSimdExt() noexcept;
+
+	//! \returns true if code compiled for \p ext can run on the executing processor
+	bool isSupported(SimdExt ext) noexcept;
+
+	//! \returns a readable name of \p ext
+	const char* name(SimdExt ext) noexcept;
+
+	/*!
+	 *	\brief Select one of multiple implementations of an entry point
+	 *
+	 *	Implementations are registered per vectorization extension. On construction,
+	 *	the widest implementation supported by 'activeSimdExt' is selected.
+	 *	Entries without implementation (nullptr) are ignored, which allows to register
+	 *	implementations that were not compiled in the current configuration.
+	 */
+	template<typename Func>
+	class Dispatcher
+	{
+	public:
+		using Entry = std::pair<SimdExt, Func>;
+
+		Dispatcher(std::initializer_list<Entry> impls) noexcept
+		{
+			for (const auto& impl : impls)
+			{
+				if (impl.second && isSupported(impl.first) && (!_func || rank(impl.first) > rank(_ext)))
+				{
+					_func = impl.second;
+					_ext = impl.first;
+				}
+			}
+		}
+
+		//! \returns the selected implementation
+		Func get() const noexcept { return _func; }
+
+		//! \returns the extension of the selected implementation
+		SimdExt simdExt() const noexcept { return _ext; }
+
+		//! \returns true if an implementation was selected
+		explicit operator bool() const noexcept { return _func != nullptr; }
+
+	private:
+		static int rank(SimdExt ext) noexcept
+		{
+			switch (ext)
+			{
+			case SimdExt::None: return 0;
+			case SimdExt::SSE: return 1;
+			case SimdExt::NEON: return 1;
+			case SimdExt::AVX: return 2;
+			case SimdExt::AVX512: return 3;
+			}
+			return 0;
+		}
+
+		//! Selected implementation
+		Func _func{ nullptr };
+
+		//! Extension of the selected implementation
+		SimdExt _ext{ SimdExt::None };
+	};
+}}}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// VCL
+#include <vcl/core/simd/bool4_sse.h>
+#include <vcl/core/simd/common.h>
+#include <vcl/core/simd/intrinsics_avx.h>
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl {
+	template<>
+	class alignas(32) VectorScalar<double, 4> : protected Core::Simd::VectorScalarBase<double, 4, Core::Simd::SimdExt::AVX>
+	{
+	public:
+		VCL_SIMD_VECTORSCALAR_SETUP(AVX)
+
+	public:
+		VCL_SIMD_BINARY_OP(operator+, _mm256_add_pd, 1)
+		VCL_SIMD_BINARY_OP(operator-, _mm256_sub_pd, 1)
+		VCL_SIMD_BINARY_OP(operator*, _mm256_mul_pd, 1)
+		VCL_SIMD_BINARY_OP(operator/, _mm256_div_pd, 1)
+
+	public:
+		VCL_SIMD_ASSIGN_OP(operator+=, _mm256_add_pd, 1)
+		VCL_SIMD_ASSIGN_OP(operator-=, _mm256_sub_pd, 1)
+		VCL_SIMD_ASSIGN_OP(operator*=, _mm256_mul_pd, 1)
+		VCL_SIMD_ASSIGN_OP(operator/=, _mm256_div_pd, 1)
+
+	public:
+		VCL_SIMD_COMP_CVT_OP(operator==, _mm256_cmpeq_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator!=, _mm256_cmpneq_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator<, _mm256_cmplt_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator<=, _mm256_cmple_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator>, _mm256_cmpgt_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator>=, _mm256_cmpge_pd, toBool, 1)
+
+	public:
+		VCL_SIMD_UNARY_OP(abs, _mm256_abs_pd, 1)
+		VCL_SIMD_UNARY_OP(sgn, _mm256_sgn_pd, 1)
+
+		VCL_SIMD_UNARY_OP(sqrt, _mm256_sqrt_pd, 1)
+		VCL_SIMD_UNARY_OP(rcp, _mmVCL_rcp_pd, 1)
+		VCL_SIMD_UNARY_OP(rsqrt, _mmVCL_rsqrt_pd, 1)
+
+		VCL_SIMD_QUERY_CVT_OP(isinf, _mm256_isinf_pd, toBool, 1)
+
+	public:
+		VCL_SIMD_BINARY_OP(min, _mm256_min_pd, 1)
+		VCL_SIMD_BINARY_OP(max, _mm256_max_pd, 1)
+
+		VCL_SIMD_TERNARY_OP(fma, _mmVCL_fmadd_pd, 1)
+
+		VCL_SIMD_BINARY_REDUCTION_OP(dot, _mmVCL_dp_pd, VCL_UNUSED, 1)
+
+		VCL_SIMD_UNARY_REDUCTION_OP(min, _mmVCL_hmin_pd, VCL_UNUSED, 1)
+		VCL_SIMD_UNARY_REDUCTION_OP(max, _mmVCL_hmax_pd, VCL_UNUSED, 1)
+
+	private:
+		//! Convert the comparison results to the lane layout of the mask type
+		VCL_STRONG_INLINE static Bool toBool(__m256d m0) noexcept
+		{
+			return Bool{ _mm256VCL_pack_mask_pd(m0) };
+		}
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b) noexcept
+	{
+		return VectorScalar<double, 4>(_mm256_blendv_pd(b.get(0), a.get(0), _mm256VCL_unpack_mask_pd(mask.get(0))));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<<(std::ostream& s, const VectorScalar<double, 4>& rhs)
+	{
+		alignas(32) double vars[4];
+		_mm256_store_pd(vars + 0, rhs.get(0));
+
+		s << "'" << vars[0];
+		for (int i = 1; i < 4; i++)
+			s << ", " << vars[i];
+		s << "'";
+
+		return s;
+	}
+}
@@ -0,0 +1,112 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// VCL
+#include <vcl/core/simd/bool4_sse.h>
+#include <vcl/core/simd/common.h>
+#include <vcl/core/simd/intrinsics_sse.h>
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl {
+	template<>
+	class alignas(16) VectorScalar<double, 4> : protected Core::Simd::VectorScalarBase<double, 4, Core::Simd::SimdExt::SSE>
+	{
+	public:
+		VCL_SIMD_VECTORSCALAR_SETUP(SSE)
+
+	public:
+		VCL_SIMD_BINARY_OP(operator+, _mm_add_pd, 2)
+		VCL_SIMD_BINARY_OP(operator-, _mm_sub_pd, 2)
+		VCL_SIMD_BINARY_OP(operator*, _mm_mul_pd, 2)
+		VCL_SIMD_BINARY_OP(operator/, _mm_div_pd, 2)
+
+	public:
+		VCL_SIMD_ASSIGN_OP(operator+=, _mm_add_pd, 2)
+		VCL_SIMD_ASSIGN_OP(operator-=, _mm_sub_pd, 2)
+		VCL_SIMD_ASSIGN_OP(operator*=, _mm_mul_pd, 2)
+		VCL_SIMD_ASSIGN_OP(operator/=, _mm_div_pd, 2)
+
+	public:
+		VCL_SIMD_COMP_CVT_OP(operator==, _mm_cmpeq_pd, toBool, 2)
+		VCL_SIMD_COMP_CVT_OP(operator!=, _mm_cmpneq_pd, toBool, 2)
+		VCL_SIMD_COMP_CVT_OP(operator<, _mm_cmplt_pd, toBool, 2)
+		VCL_SIMD_COMP_CVT_OP(operator<=, _mm_cmple_pd, toBool, 2)
+		VCL_SIMD_COMP_CVT_OP(operator>, _mm_cmpgt_pd, toBool, 2)
+		VCL_SIMD_COMP_CVT_OP(operator>=, _mm_cmpge_pd, toBool, 2)
+
+	public:
+		VCL_SIMD_UNARY_OP(abs, Core::Simd::SSE::abs_f64, 2)
+		VCL_SIMD_UNARY_OP(sgn, Core::Simd::SSE::sgn_f64, 2)
+
+		VCL_SIMD_UNARY_OP(sqrt, _mm_sqrt_pd, 2)
+		VCL_SIMD_UNARY_OP(rcp, _mmVCL_rcp_pd, 2)
+		VCL_SIMD_UNARY_OP(rsqrt, _mmVCL_rsqrt_pd, 2)
+
+		VCL_SIMD_QUERY_CVT_OP(isinf, _mm_isinf_pd, toBool, 2)
+
+	public:
+		VCL_SIMD_BINARY_OP(min, _mm_min_pd, 2)
+		VCL_SIMD_BINARY_OP(max, _mm_max_pd, 2)
+
+		VCL_SIMD_TERNARY_OP(fma, _mmVCL_fmadd_pd, 2)
+
+		VCL_SIMD_BINARY_REDUCTION_OP(dot, _mmVCL_dp_pd, Core::Simd::Details::add, 2)
+
+		VCL_SIMD_UNARY_REDUCTION_OP(min, _mmVCL_hmin_pd, Mathematics::min, 2)
+		VCL_SIMD_UNARY_REDUCTION_OP(max, _mmVCL_hmax_pd, Mathematics::max, 2)
+
+	private:
+		//! Convert the comparison results to the lane layout of the mask type
+		VCL_STRONG_INLINE static Bool toBool(__m128d m0, __m128d m1) noexcept
+		{
+			return Bool{ Core::Simd::SSE::pack_mask_f64(m0, m1) };
+		}
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> select(const VectorScalar<bool, 4>& mask, const VectorScalar<double, 4>& a, const VectorScalar<double, 4>& b) noexcept
+	{
+		return VectorScalar<double, 4>(
+			Core::Simd::SSE::blend_f64(b.get(0), a.get(0), Core::Simd::SSE::unpacklo_mask_f64(mask.get(0))),
+			Core::Simd::SSE::blend_f64(b.get(1), a.get(1), Core::Simd::SSE::unpackhi_mask_f64(mask.get(0))));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<<(std::ostream& s, const VectorScalar<double, 4>& rhs)
+	{
+		alignas(16) double vars[4];
+		_mm_store_pd(vars + 0, rhs.get(0));
+		_mm_store_pd(vars + 2, rhs.get(1));
+
+		s << "'" << vars[0];
+		for (int i = 1; i < 4; i++)
+			s << ", " << vars[i];
+		s << "'";
+
+		return s;
+	}
+}
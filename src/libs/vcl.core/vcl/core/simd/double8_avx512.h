@@ -0,0 +1,109 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// VCL
+#include <vcl/core/simd/bool8_avx.h>
+#include <vcl/core/simd/common.h>
+#include <vcl/core/simd/intrinsics_avx512.h>
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl {
+	template<>
+	class alignas(64) VectorScalar<double, 8> : protected Core::Simd::VectorScalarBase<double, 8, Core::Simd::SimdExt::AVX512>
+	{
+	public:
+		VCL_SIMD_VECTORSCALAR_SETUP(AVX512)
+
+	public:
+		VCL_SIMD_BINARY_OP(operator+, _mm512_add_pd, 1)
+		VCL_SIMD_BINARY_OP(operator-, _mm512_sub_pd, 1)
+		VCL_SIMD_BINARY_OP(operator*, _mm512_mul_pd, 1)
+		VCL_SIMD_BINARY_OP(operator/, _mm512_div_pd, 1)
+
+	public:
+		VCL_SIMD_ASSIGN_OP(operator+=, _mm512_add_pd, 1)
+		VCL_SIMD_ASSIGN_OP(operator-=, _mm512_sub_pd, 1)
+		VCL_SIMD_ASSIGN_OP(operator*=, _mm512_mul_pd, 1)
+		VCL_SIMD_ASSIGN_OP(operator/=, _mm512_div_pd, 1)
+
+	public:
+		VCL_SIMD_COMP_CVT_OP(operator==, _mm512_cmpeq_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator!=, _mm512_cmpneq_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator<, _mm512_cmplt_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator<=, _mm512_cmple_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator>, _mm512_cmpgt_pd, toBool, 1)
+		VCL_SIMD_COMP_CVT_OP(operator>=, _mm512_cmpge_pd, toBool, 1)
+
+	public:
+		VCL_SIMD_UNARY_OP(abs, _mm512_abs_pd, 1)
+		VCL_SIMD_UNARY_OP(sgn, _mm512_sgn_pd, 1)
+
+		VCL_SIMD_UNARY_OP(sqrt, _mm512_sqrt_pd, 1)
+		VCL_SIMD_UNARY_OP(rcp, _mmVCL_rcp_pd, 1)
+		VCL_SIMD_UNARY_OP(rsqrt, _mmVCL_rsqrt_pd, 1)
+
+		VCL_SIMD_QUERY_CVT_OP(isinf, _mm512_isinf_pd, toBool, 1)
+
+	public:
+		VCL_SIMD_BINARY_OP(min, _mm512_min_pd, 1)
+		VCL_SIMD_BINARY_OP(max, _mm512_max_pd, 1)
+
+		VCL_SIMD_TERNARY_OP(fma, _mmVCL_fmadd_pd, 1)
+
+		VCL_SIMD_BINARY_REDUCTION_OP(dot, _mmVCL_dp_pd, VCL_UNUSED, 1)
+
+		VCL_SIMD_UNARY_REDUCTION_OP(min, _mmVCL_hmin_pd, VCL_UNUSED, 1)
+		VCL_SIMD_UNARY_REDUCTION_OP(max, _mmVCL_hmax_pd, VCL_UNUSED, 1)
+
+	private:
+		//! Convert the comparison results to the lane layout of the mask type
+		VCL_STRONG_INLINE static Bool toBool(__mmask8 m0) noexcept
+		{
+			return Bool{ _mm512VCL_mask_to_ps(m0) };
+		}
+	};
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> select(const VectorScalar<bool, 8>& mask, const VectorScalar<double, 8>& a, const VectorScalar<double, 8>& b) noexcept
+	{
+		return VectorScalar<double, 8>(_mm512_mask_blend_pd(_mm512VCL_ps_to_mask(mask.get(0)), b.get(0), a.get(0)));
+	}
+
+	VCL_STRONG_INLINE std::ostream& operator<<(std::ostream& s, const VectorScalar<double, 8>& rhs)
+	{
+		alignas(64) double vars[8];
+		_mm512_store_pd(vars + 0, rhs.get(0));
+
+		s << "'" << vars[0];
+		for (int i = 1; i < 8; i++)
+			s << ", " << vars[i];
+		s << "'";
+
+		return s;
+	}
+}
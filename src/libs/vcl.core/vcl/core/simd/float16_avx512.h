@@ -65,9 +65,14 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(sin, _mm512_sin_ps, 1)
 		VCL_SIMD_UNARY_OP(cos, _mm512_cos_ps, 1)
 		VCL_SIMD_UNARY_OP(acos, _mm512_acos_ps, 1)
+		VCL_SIMD_UNARY_OP(tan, _mm512_tan_ps, 1)
+		VCL_SIMD_UNARY_OP(asin, _mm512_asin_ps, 1)
+		VCL_SIMD_UNARY_OP(atan, _mm512_atan_ps, 1)
 
 		VCL_SIMD_UNARY_OP(exp, _mm512_exp_ps, 1)
 		VCL_SIMD_UNARY_OP(log, _mm512_log_ps, 1)
+		VCL_SIMD_UNARY_OP(exp2, _mm512_exp2_ps, 1)
+		VCL_SIMD_UNARY_OP(log2, _mm512_log2_ps, 1)
 		VCL_SIMD_UNARY_OP(sqrt, _mm512_sqrt_ps, 1)
 		VCL_SIMD_UNARY_OP(rcp, _mmVCL_rcp_ps, 1)
 		VCL_SIMD_UNARY_OP(rsqrt, _mmVCL_rsqrt_ps, 1)
@@ -78,6 +83,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, _mm512_min_ps, 1)
 		VCL_SIMD_BINARY_OP(max, _mm512_max_ps, 1)
 
+		VCL_SIMD_BINARY_OP(atan2, _mm512_atan2_ps, 1)
+		VCL_SIMD_BINARY_OP(pow, _mm512_pow_ps, 1)
+		VCL_SIMD_TERNARY_OP(fma, _mmVCL_fmadd_ps, 1)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, _mmVCL_dp_ps, VCL_UNUSED, 1)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, _mmVCL_hmin_ps, VCL_UNUSED, 1)
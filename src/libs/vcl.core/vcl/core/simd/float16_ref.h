@@ -73,9 +73,14 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(sin, std::sin, 16)
 		VCL_SIMD_UNARY_OP(cos, std::cos, 16)
 		VCL_SIMD_UNARY_OP(acos, std::acos, 16)
+		VCL_SIMD_UNARY_OP(tan, std::tan, 16)
+		VCL_SIMD_UNARY_OP(asin, std::asin, 16)
+		VCL_SIMD_UNARY_OP(atan, std::atan, 16)
 
 		VCL_SIMD_UNARY_OP(exp, std::exp, 16)
 		VCL_SIMD_UNARY_OP(log, std::log, 16)
+		VCL_SIMD_UNARY_OP(exp2, std::exp2, 16)
+		VCL_SIMD_UNARY_OP(log2, std::log2, 16)
 		VCL_SIMD_UNARY_OP(sqrt, std::sqrt, 16)
 		VCL_SIMD_UNARY_OP(rcp, Vcl::Mathematics::rcp, 16)
 		VCL_SIMD_UNARY_OP(rsqrt, Vcl::Mathematics::rsqrt, 16)
@@ -86,6 +91,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, std::min, 16)
 		VCL_SIMD_BINARY_OP(max, std::max, 16)
 
+		VCL_SIMD_BINARY_OP(atan2, std::atan2, 16)
+		VCL_SIMD_BINARY_OP(pow, std::pow, 16)
+		VCL_SIMD_TERNARY_OP(fma, Core::Simd::Details::madd, 16)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, Core::Simd::Details::mul, Core::Simd::Details::add, 16)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, Core::Simd::Details::nop, std::min, 16)
@@ -73,9 +73,14 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(sin, std::sin, 4)
 		VCL_SIMD_UNARY_OP(cos, std::cos, 4)
 		VCL_SIMD_UNARY_OP(acos, std::acos, 4)
+		VCL_SIMD_UNARY_OP(tan, std::tan, 4)
+		VCL_SIMD_UNARY_OP(asin, std::asin, 4)
+		VCL_SIMD_UNARY_OP(atan, std::atan, 4)
 
 		VCL_SIMD_UNARY_OP(exp, std::exp, 4)
 		VCL_SIMD_UNARY_OP(log, std::log, 4)
+		VCL_SIMD_UNARY_OP(exp2, std::exp2, 4)
+		VCL_SIMD_UNARY_OP(log2, std::log2, 4)
 		VCL_SIMD_UNARY_OP(sqrt, std::sqrt, 4)
 		VCL_SIMD_UNARY_OP(rcp, Vcl::Mathematics::rcp, 4)
 		VCL_SIMD_UNARY_OP(rsqrt, Vcl::Mathematics::rsqrt, 4)
@@ -86,6 +91,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, std::min, 4)
 		VCL_SIMD_BINARY_OP(max, std::max, 4)
 
+		VCL_SIMD_BINARY_OP(atan2, std::atan2, 4)
+		VCL_SIMD_BINARY_OP(pow, std::pow, 4)
+		VCL_SIMD_TERNARY_OP(fma, Core::Simd::Details::madd, 4)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, Core::Simd::Details::mul, Core::Simd::Details::add, 4)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, Core::Simd::Details::nop, std::min, 4)
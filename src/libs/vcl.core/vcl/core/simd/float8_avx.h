@@ -67,9 +67,14 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(sin, _mm256_sin_ps, 1)
 		VCL_SIMD_UNARY_OP(cos, _mm256_cos_ps, 1)
 		VCL_SIMD_UNARY_OP(acos, _mm256_acos_ps, 1)
+		VCL_SIMD_UNARY_OP(tan, _mm256_tan_ps, 1)
+		VCL_SIMD_UNARY_OP(asin, _mm256_asin_ps, 1)
+		VCL_SIMD_UNARY_OP(atan, _mm256_atan_ps, 1)
 
 		VCL_SIMD_UNARY_OP(exp, _mm256_exp_ps, 1)
 		VCL_SIMD_UNARY_OP(log, _mm256_log_ps, 1)
+		VCL_SIMD_UNARY_OP(exp2, _mm256_exp2_ps, 1)
+		VCL_SIMD_UNARY_OP(log2, _mm256_log2_ps, 1)
 		VCL_SIMD_UNARY_OP(sqrt, _mm256_sqrt_ps, 1)
 		VCL_SIMD_UNARY_OP(rcp, _mmVCL_rcp_ps, 1)
 		VCL_SIMD_UNARY_OP(rsqrt, _mmVCL_rsqrt_ps, 1)
@@ -80,6 +85,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, _mm256_min_ps, 1)
 		VCL_SIMD_BINARY_OP(max, _mm256_max_ps, 1)
 
+		VCL_SIMD_BINARY_OP(atan2, _mm256_atan2_ps, 1)
+		VCL_SIMD_BINARY_OP(pow, _mm256_pow_ps, 1)
+		VCL_SIMD_TERNARY_OP(fma, _mmVCL_fmadd_ps, 1)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, _mmVCL_dp_ps, VCL_UNUSED, 1)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, _mmVCL_hmin_ps, VCL_UNUSED, 1)
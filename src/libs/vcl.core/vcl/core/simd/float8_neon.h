@@ -66,12 +66,17 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(cos, vcosq_f32, 2)
 		VCL_SIMD_UNARY_OP(exp, vexpq_f32, 2)
 		VCL_SIMD_UNARY_OP(log, vlogq_f32, 2)
+		VCL_SIMD_UNARY_OP(exp2, vexp2q_f32, 2)
+		VCL_SIMD_UNARY_OP(log2, vlog2q_f32, 2)
 		VCL_SIMD_UNARY_OP(sgn, vsgnq_f32, 2)
 		VCL_SIMD_UNARY_OP(sqrt, vsqrtq_f32, 2)
 		VCL_SIMD_UNARY_OP(rcp, vrcpq_f32, 2)
 		VCL_SIMD_UNARY_OP(rsqrt, vrsqrtq_f32, 2)
 
 		VCL_SIMD_UNARY_OP(acos, vacosq_f32, 2)
+		VCL_SIMD_UNARY_OP(tan, vtanq_f32, 2)
+		VCL_SIMD_UNARY_OP(asin, vasinq_f32, 2)
+		VCL_SIMD_UNARY_OP(atan, vatanq_f32, 2)
 
 		VCL_SIMD_QUERY_OP(isinf, visinfq_f32, 2)
 
@@ -79,6 +84,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, vminq_f32, 2)
 		VCL_SIMD_BINARY_OP(max, vmaxq_f32, 2)
 
+		VCL_SIMD_BINARY_OP(atan2, vatan2q_f32, 2)
+		VCL_SIMD_BINARY_OP(pow, vpowq_f32, 2)
+		VCL_SIMD_TERNARY_OP(fma, vmaddq_f32, 2)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, vdotq_f32, Core::Simd::Details::add, 2)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, vpminq_f32, Mathematics::min, 2)
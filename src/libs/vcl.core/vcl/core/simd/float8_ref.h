@@ -73,9 +73,14 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(sin, std::sin, 8)
 		VCL_SIMD_UNARY_OP(cos, std::cos, 8)
 		VCL_SIMD_UNARY_OP(acos, std::acos, 8)
+		VCL_SIMD_UNARY_OP(tan, std::tan, 8)
+		VCL_SIMD_UNARY_OP(asin, std::asin, 8)
+		VCL_SIMD_UNARY_OP(atan, std::atan, 8)
 
 		VCL_SIMD_UNARY_OP(exp, std::exp, 8)
 		VCL_SIMD_UNARY_OP(log, std::log, 8)
+		VCL_SIMD_UNARY_OP(exp2, std::exp2, 8)
+		VCL_SIMD_UNARY_OP(log2, std::log2, 8)
 		VCL_SIMD_UNARY_OP(sqrt, std::sqrt, 8)
 		VCL_SIMD_UNARY_OP(rcp, Vcl::Mathematics::rcp, 8)
 		VCL_SIMD_UNARY_OP(rsqrt, Vcl::Mathematics::rsqrt, 8)
@@ -86,6 +91,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, std::min, 8)
 		VCL_SIMD_BINARY_OP(max, std::max, 8)
 
+		VCL_SIMD_BINARY_OP(atan2, std::atan2, 8)
+		VCL_SIMD_BINARY_OP(pow, std::pow, 8)
+		VCL_SIMD_TERNARY_OP(fma, Core::Simd::Details::madd, 8)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, Core::Simd::Details::mul, Core::Simd::Details::add, 8)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, Core::Simd::Details::nop, std::min, 8)
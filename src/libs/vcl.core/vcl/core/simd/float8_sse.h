@@ -67,9 +67,14 @@ namespace Vcl {
 		VCL_SIMD_UNARY_OP(sin, _mm_sin_ps, 2)
 		VCL_SIMD_UNARY_OP(cos, _mm_cos_ps, 2)
 		VCL_SIMD_UNARY_OP(acos, _mm_acos_ps, 2)
+		VCL_SIMD_UNARY_OP(tan, _mm_tan_ps, 2)
+		VCL_SIMD_UNARY_OP(asin, _mm_asin_ps, 2)
+		VCL_SIMD_UNARY_OP(atan, _mm_atan_ps, 2)
 
 		VCL_SIMD_UNARY_OP(exp, _mm_exp_ps, 2)
 		VCL_SIMD_UNARY_OP(log, _mm_log_ps, 2)
+		VCL_SIMD_UNARY_OP(exp2, _mm_exp2_ps, 2)
+		VCL_SIMD_UNARY_OP(log2, _mm_log2_ps, 2)
 		VCL_SIMD_UNARY_OP(sqrt, _mm_sqrt_ps, 2)
 		VCL_SIMD_UNARY_OP(rcp, _mmVCL_rcp_ps, 2)
 		VCL_SIMD_UNARY_OP(rsqrt, _mmVCL_rsqrt_ps, 2)
@@ -80,6 +85,10 @@ namespace Vcl {
 		VCL_SIMD_BINARY_OP(min, _mm_min_ps, 2)
 		VCL_SIMD_BINARY_OP(max, _mm_max_ps, 2)
 
+		VCL_SIMD_BINARY_OP(atan2, _mm_atan2_ps, 2)
+		VCL_SIMD_BINARY_OP(pow, _mm_pow_ps, 2)
+		VCL_SIMD_TERNARY_OP(fma, _mmVCL_fmadd_ps, 2)
+
 		VCL_SIMD_BINARY_REDUCTION_OP(dot, _mmVCL_dp_ps, Core::Simd::Details::add, 2)
 
 		VCL_SIMD_UNARY_REDUCTION_OP(min, _mmVCL_hmin_ps, Mathematics::min, 2)
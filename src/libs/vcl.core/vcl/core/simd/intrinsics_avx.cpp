@@ -33,11 +33,83 @@ VCL_BEGIN_EXTERNAL_HEADERS
 VCL_END_EXTERNAL_HEADERS
 
 // VCL
+#	include <vcl/core/simd/detail/cephes_mathfun.h>
 #	include <vcl/core/simd/vectorscalar.h>
 #	include <vcl/core/simd/bool8_avx.h>
 #	include <vcl/core/simd/float8_avx.h>
 
 namespace Vcl {
+	namespace {
+		//! Operation policy for the Cephes based functions
+		struct AvxMathOps
+		{
+			using Float = __m256;
+			using Int = __m256i;
+			using Mask = __m256;
+
+			static VCL_STRONG_INLINE Float set(float s) { return _mm256_set1_ps(s); }
+			static VCL_STRONG_INLINE Int set_i(int s) { return _mm256_set1_epi32(s); }
+
+			static VCL_STRONG_INLINE Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+			static VCL_STRONG_INLINE Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+			static VCL_STRONG_INLINE Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+			static VCL_STRONG_INLINE Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+			static VCL_STRONG_INLINE Float fmadd(Float a, Float b, Float c) { return _mmVCL_fmadd_ps(a, b, c); }
+			static VCL_STRONG_INLINE Float sqrt(Float a) { return _mm256_sqrt_ps(a); }
+			static VCL_STRONG_INLINE Float abs(Float a) { return _mm256_abs_ps(a); }
+			static VCL_STRONG_INLINE Float min(Float a, Float b) { return _mm256_min_ps(a, b); }
+			static VCL_STRONG_INLINE Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+			static VCL_STRONG_INLINE Float floor(Float a) { return _mm256_floor_ps(a); }
+
+			static VCL_STRONG_INLINE Float and_(Float a, Float b) { return _mm256_and_ps(a, b); }
+			static VCL_STRONG_INLINE Float or_(Float a, Float b) { return _mm256_or_ps(a, b); }
+			static VCL_STRONG_INLINE Float xor_(Float a, Float b) { return _mm256_xor_ps(a, b); }
+
+			static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) { return _mm256_cmpeq_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) { return _mm256_cmplt_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmpgt(Float a, Float b) { return _mm256_cmpgt_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmpge(Float a, Float b) { return _mm256_cmpge_ps(a, b); }
+			static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+			static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+			static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) { return _mm256_blendv_ps(b, a, m); }
+
+			static VCL_STRONG_INLINE Int cvtt(Float a) { return _mm256_cvttps_epi32(a); }
+			static VCL_STRONG_INLINE Float cvt(Int a) { return _mm256_cvtepi32_ps(a); }
+			static VCL_STRONG_INLINE Float cast_f(Int a) { return _mm256_castsi256_ps(a); }
+			static VCL_STRONG_INLINE Int cast_i(Float a) { return _mm256_castps_si256(a); }
+
+			static VCL_STRONG_INLINE Int add_i(Int a, Int b) { return _mmVCL_add_epi32(a, b); }
+			static VCL_STRONG_INLINE Int sub_i(Int a, Int b) { return _mmVCL_sub_epi32(a, b); }
+			static VCL_STRONG_INLINE Int and_i(Int a, Int b) { return _mmVCL_and_si256(a, b); }
+			static VCL_STRONG_INLINE Int or_i(Int a, Int b) { return _mmVCL_or_si256(a, b); }
+
+#	ifdef VCL_VECTORIZE_AVX2
+			template<int N>
+			static VCL_STRONG_INLINE Int slli(Int a) { return _mm256_slli_epi32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srli(Int a) { return _mm256_srli_epi32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srai(Int a) { return _mm256_srai_epi32(a, N); }
+#	else
+			template<int N>
+			static VCL_STRONG_INLINE Int slli(Int a)
+			{
+				return _mm256_set_m128i(_mm_slli_epi32(_mm256_extractf128_si256(a, 1), N), _mm_slli_epi32(_mm256_castsi256_si128(a), N));
+			}
+			template<int N>
+			static VCL_STRONG_INLINE Int srli(Int a)
+			{
+				return _mm256_set_m128i(_mm_srli_epi32(_mm256_extractf128_si256(a, 1), N), _mm_srli_epi32(_mm256_castsi256_si128(a), N));
+			}
+			template<int N>
+			static VCL_STRONG_INLINE Int srai(Int a)
+			{
+				return _mm256_set_m128i(_mm_srai_epi32(_mm256_extractf128_si256(a, 1), N), _mm_srai_epi32(_mm256_castsi256_si128(a), N));
+			}
+#	endif
+		};
+	}
+
 	__m256 _mm256_sin_ps(__m256 v)
 	{
 		return sin256_ps(v);
@@ -58,6 +130,26 @@ namespace Vcl {
 		return exp256_ps(v);
 	}
 
+	__m256 _mm256_tan_ps(__m256 v)
+	{
+		return Core::Simd::Cephes::tan<AvxMathOps>(v);
+	}
+
+	__m256 _mm256_log2_ps(__m256 v)
+	{
+		return Core::Simd::Cephes::log2<AvxMathOps>(v);
+	}
+
+	__m256 _mm256_exp2_ps(__m256 v)
+	{
+		return Core::Simd::Cephes::exp2<AvxMathOps>(v);
+	}
+
+	__m256 _mm256_pow_ps(__m256 x, __m256 y)
+	{
+		return Core::Simd::Cephes::pow<AvxMathOps>(x, y);
+	}
+
 	// Handbook of Mathematical Functions
 	// M. Abramowitz and I.A. Stegun, Ed.
 	__m256 _mm256_acos_ps(__m256 v)
@@ -81,59 +173,20 @@ namespace Vcl {
 		return (negate * 3.14159265358979f + ret).get(0);
 	}
 
-	// Handbook of Mathematical Functions
-	// M. Abramowitz and I.A. Stegun, Ed.
 	__m256 _mm256_asin_ps(__m256 v)
 	{
-		float8 x{ v };
-
-		float8 negate = select(x < 0, float8{ 1 }, float8{ 0 });
-
-		x = abs(x);
-		float8 ret = -0.0187293f;
-		ret *= x;
-		ret += 0.0742610f;
-		ret *= x;
-		ret -= 0.2121144f;
-		ret *= x;
-		ret += 1.5707288f;
-		ret = 3.14159265358979f * 0.5f - sqrt(1.0f - x) * ret;
-		return (ret - 2.0f * negate * ret).get(0);
+		return Core::Simd::Cephes::asin<AvxMathOps>(v);
 	}
 
-	__m256 _mm256_atan2_ps(__m256 in_y, __m256 in_x)
+	__m256 _mm256_atan_ps(__m256 v)
 	{
-		float8 t0, t1, t3, t4;
-
-		float8 x{ in_x };
-		float8 y{ in_y };
-
-		t3 = abs(x);
-		t1 = abs(y);
-		t0 = max(t3, t1);
-		t1 = min(t3, t1);
-		t3 = 1.0f / t0;
-		t3 = t1 * t3;
-
-		t4 = t3 * t3;
-		t0 = -0.013480470f;
-		t0 = t0 * t4 + 0.057477314f;
-		t0 = t0 * t4 - 0.121239071f;
-		t0 = t0 * t4 + 0.195635925f;
-		t0 = t0 * t4 - 0.332994597f;
-		t0 = t0 * t4 + 0.999995630f;
-		t3 = t0 * t3;
-
-		t3 = select(abs(y) > abs(x), 1.570796327f - t3, t3);
-		t3 = select(x < 0, 3.141592654f - t3, t3);
-		t3 = select(y < 0, -t3, t3);
-
-		return t3.get(0);
+		return Core::Simd::Cephes::atan<AvxMathOps>(v);
 	}
 
-	__m256 _mm256_pow_ps(__m256 x, __m256 y)
+	__m256 _mm256_atan2_ps(__m256 y, __m256 x)
 	{
-		return _mm256_exp_ps(_mm256_mul_ps(_mm256_log_ps(x), y));
+		return Core::Simd::Cephes::atan2<AvxMathOps>(y, x);
 	}
+
 }
 #endif // VCL_VECTORIZE_AVX
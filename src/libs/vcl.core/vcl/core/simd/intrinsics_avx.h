@@ -49,6 +49,7 @@
 
 #	define VCL_M256I_SIGNBIT _mm256_set1_epi32(int(0x80000000))
 #	define VCL_M256I_ALLBITS _mm256_set1_epi32(int(0xffffffff))
+#	define VCL_M256I_SIGNBIT_64 _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull))
 
 namespace Vcl {
 	VCL_STRONG_INLINE __m256 _mm256_abs_ps(__m256 v)
@@ -60,6 +61,58 @@ namespace Vcl {
 		return _mm256_and_ps(_mm256_or_ps(_mm256_and_ps(v, _mm256_castsi256_ps(VCL_M256I_SIGNBIT)), _mm256_set1_ps(1.0f)), _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_NEQ_OQ));
 	}
 
+	VCL_STRONG_INLINE __m256d _mm256_abs_pd(__m256d v)
+	{
+		return _mm256_andnot_pd(_mm256_castsi256_pd(VCL_M256I_SIGNBIT_64), v);
+	}
+	VCL_STRONG_INLINE __m256d _mm256_sgn_pd(__m256d v)
+	{
+		return _mm256_and_pd(_mm256_or_pd(_mm256_and_pd(v, _mm256_castsi256_pd(VCL_M256I_SIGNBIT_64)), _mm256_set1_pd(1.0)), _mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_NEQ_OQ));
+	}
+
+	//! Combine the 64-bit lane mask to a 32-bit lane mask
+	VCL_STRONG_INLINE __m128 _mm256VCL_pack_mask_pd(__m256d mask)
+	{
+		const __m128 lo = _mm_castpd_ps(_mm256_castpd256_pd128(mask));
+		const __m128 hi = _mm_castpd_ps(_mm256_extractf128_pd(mask, 1));
+		return _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	//! Widen a 32-bit lane mask to a 64-bit lane mask
+	VCL_STRONG_INLINE __m256d _mm256VCL_unpack_mask_pd(__m128 mask)
+	{
+		return _mm256_castps_pd(_mm256_set_m128(_mm_unpackhi_ps(mask, mask), _mm_unpacklo_ps(mask, mask)));
+	}
+
+	//! Load the lanes set in 'mask' and keep the lanes of 'src' otherwise
+	VCL_STRONG_INLINE __m128 _mmVCL_maskload_ps(const float* base, __m128 src, __m128 mask)
+	{
+		return _mm_blendv_ps(src, _mm_maskload_ps(base, _mm_castps_si128(mask)), mask);
+	}
+
+	VCL_STRONG_INLINE __m256 _mmVCL_maskload_ps(const float* base, __m256 src, __m256 mask)
+	{
+		return _mm256_blendv_ps(src, _mm256_maskload_ps(base, _mm256_castps_si256(mask)), mask);
+	}
+
+	VCL_STRONG_INLINE __m256d _mmVCL_maskload_pd(const double* base, __m256d src, __m128 mask)
+	{
+		const __m256d m = _mm256VCL_unpack_mask_pd(mask);
+		return _mm256_blendv_pd(src, _mm256_maskload_pd(base, _mm256_castpd_si256(m)), m);
+	}
+
+	VCL_STRONG_INLINE __m128i _mmVCL_maskload_epi32(const int* base, __m128i src, __m128 mask)
+	{
+		const float* p = reinterpret_cast<const float*>(base);
+		return _mm_castps_si128(_mmVCL_maskload_ps(p, _mm_castsi128_ps(src), mask));
+	}
+
+	VCL_STRONG_INLINE __m256i _mmVCL_maskload_epi32(const int* base, __m256i src, __m256 mask)
+	{
+		const float* p = reinterpret_cast<const float*>(base);
+		return _mm256_castps_si256(_mmVCL_maskload_ps(p, _mm256_castsi256_ps(src), mask));
+	}
+
 #	ifdef VCL_VECTORIZE_AVX2
 	VCL_STRONG_INLINE __m256i _mm256_cmplt_epi32(__m256i a, __m256i b)
 	{
@@ -84,9 +137,13 @@ namespace Vcl {
 	__m256 _mm256_cos_ps(__m256 v);
 	__m256 _mm256_log_ps(__m256 v);
 	__m256 _mm256_exp_ps(__m256 v);
+	__m256 _mm256_tan_ps(__m256 v);
+	__m256 _mm256_log2_ps(__m256 v);
+	__m256 _mm256_exp2_ps(__m256 v);
 
 	__m256 _mm256_acos_ps(__m256 v);
 	__m256 _mm256_asin_ps(__m256 v);
+	__m256 _mm256_atan_ps(__m256 v);
 	__m256 _mm256_atan2_ps(__m256 y, __m256 x);
 
 	__m256 _mm256_pow_ps(__m256 x, __m256 y);
@@ -136,6 +193,52 @@ namespace Vcl {
 		return result;
 	}
 
+	VCL_STRONG_INLINE __m256 _mmVCL_fmadd_ps(__m256 a, __m256 b, __m256 c)
+	{
+#	ifdef VCL_VECTORIZE_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+	}
+
+	VCL_STRONG_INLINE __m256d _mm256_cmpeq_pd(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+	VCL_STRONG_INLINE __m256d _mm256_cmpneq_pd(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_OQ); }
+	VCL_STRONG_INLINE __m256d _mm256_cmplt_pd(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+	VCL_STRONG_INLINE __m256d _mm256_cmple_pd(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+	VCL_STRONG_INLINE __m256d _mm256_cmpgt_pd(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+	VCL_STRONG_INLINE __m256d _mm256_cmpge_pd(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+
+	VCL_STRONG_INLINE __m256d _mm256_isinf_pd(__m256d x)
+	{
+		const __m256d sign_mask = _mm256_set1_pd(-0.0);
+		const __m256d inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+
+		x = _mm256_andnot_pd(sign_mask, x);
+		return _mm256_cmpeq_pd(x, inf);
+	}
+
+	// There is no fast approximation for double precision. Compute the exact result.
+	VCL_STRONG_INLINE __m256d _mmVCL_rsqrt_pd(__m256d v)
+	{
+		return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(v));
+	}
+
+	// There is no fast approximation for double precision. Compute the exact result.
+	VCL_STRONG_INLINE __m256d _mmVCL_rcp_pd(__m256d v)
+	{
+		return _mm256_div_pd(_mm256_set1_pd(1.0), v);
+	}
+
+	VCL_STRONG_INLINE __m256d _mmVCL_fmadd_pd(__m256d a, __m256d b, __m256d c)
+	{
+#	ifdef VCL_VECTORIZE_FMA
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+	}
+
 	VCL_STRONG_INLINE __m256i _mmVCL_add_epi32(__m256i x, __m256i y)
 	{
 #	ifdef VCL_VECTORIZE_AVX2
@@ -443,6 +546,36 @@ namespace Vcl {
 		return F32{ dp }.a[0] + F32{ dp }.a[4];
 	}
 
+	VCL_STRONG_INLINE double _mmVCL_hmin_pd(__m256d v)
+	{
+		const __m128d redux = _mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+		return _mm_cvtsd_f64(_mm_min_sd(redux, _mm_unpackhi_pd(redux, redux)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmax_pd(__m256d v)
+	{
+		const __m128d redux = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+		return _mm_cvtsd_f64(_mm_max_sd(redux, _mm_unpackhi_pd(redux, redux)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_dp_pd(__m256d a, __m256d b)
+	{
+		const __m256d ab = _mm256_mul_pd(a, b);
+		const __m128d redux = _mm_add_pd(_mm256_castpd256_pd128(ab), _mm256_extractf128_pd(ab, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(redux, _mm_unpackhi_pd(redux, redux)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_extract_pd(__m256d v, int i)
+	{
+		typedef union
+		{
+			__m256d x;
+			double a[4];
+		} F64;
+
+		return F64{ v }.a[i];
+	}
+
 	VCL_STRONG_INLINE float _mmVCL_extract_ps(__m256 v, int i)
 	{
 #	if 1
@@ -33,12 +33,65 @@ VCL_BEGIN_EXTERNAL_HEADERS
 VCL_END_EXTERNAL_HEADERS
 
 // VCL
+#	include <vcl/core/simd/detail/cephes_mathfun.h>
 #	include <vcl/core/simd/vectorscalar.h>
 #	include <vcl/core/simd/bool16_avx512.h>
 #	include <vcl/core/simd/float16_avx512.h>
 
 namespace Vcl {
 #	if !defined(VCL_COMPILER_MSVC)
+	namespace {
+		//! Operation policy for the Cephes based functions
+		struct Avx512MathOps
+		{
+			using Float = __m512;
+			using Int = __m512i;
+			using Mask = __mmask16;
+
+			static VCL_STRONG_INLINE Float set(float s) { return _mm512_set1_ps(s); }
+			static VCL_STRONG_INLINE Int set_i(int s) { return _mm512_set1_epi32(s); }
+
+			static VCL_STRONG_INLINE Float add(Float a, Float b) { return _mm512_add_ps(a, b); }
+			static VCL_STRONG_INLINE Float sub(Float a, Float b) { return _mm512_sub_ps(a, b); }
+			static VCL_STRONG_INLINE Float mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+			static VCL_STRONG_INLINE Float div(Float a, Float b) { return _mm512_div_ps(a, b); }
+			static VCL_STRONG_INLINE Float fmadd(Float a, Float b, Float c) { return _mmVCL_fmadd_ps(a, b, c); }
+			static VCL_STRONG_INLINE Float sqrt(Float a) { return _mm512_sqrt_ps(a); }
+			static VCL_STRONG_INLINE Float abs(Float a) { return _mm512_abs_ps(a); }
+			static VCL_STRONG_INLINE Float min(Float a, Float b) { return _mm512_min_ps(a, b); }
+			static VCL_STRONG_INLINE Float max(Float a, Float b) { return _mm512_max_ps(a, b); }
+			static VCL_STRONG_INLINE Float floor(Float a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+			static VCL_STRONG_INLINE Float and_(Float a, Float b) { return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+			static VCL_STRONG_INLINE Float or_(Float a, Float b) { return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+			static VCL_STRONG_INLINE Float xor_(Float a, Float b) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b))); }
+
+			static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) { return _mm512_cmpeq_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) { return _mm512_cmplt_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmpgt(Float a, Float b) { return _mm512_cmpgt_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmpge(Float a, Float b) { return _mm512_cmpge_ps(a, b); }
+			static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) { return static_cast<Mask>(a & b); }
+			static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) { return static_cast<Mask>(a | b); }
+			static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) { return _mm512_mask_blend_ps(m, b, a); }
+
+			static VCL_STRONG_INLINE Int cvtt(Float a) { return _mm512_cvttps_epi32(a); }
+			static VCL_STRONG_INLINE Float cvt(Int a) { return _mm512_cvtepi32_ps(a); }
+			static VCL_STRONG_INLINE Float cast_f(Int a) { return _mm512_castsi512_ps(a); }
+			static VCL_STRONG_INLINE Int cast_i(Float a) { return _mm512_castps_si512(a); }
+
+			static VCL_STRONG_INLINE Int add_i(Int a, Int b) { return _mm512_add_epi32(a, b); }
+			static VCL_STRONG_INLINE Int sub_i(Int a, Int b) { return _mm512_sub_epi32(a, b); }
+			static VCL_STRONG_INLINE Int and_i(Int a, Int b) { return _mm512_and_si512(a, b); }
+			static VCL_STRONG_INLINE Int or_i(Int a, Int b) { return _mm512_or_si512(a, b); }
+			template<int N>
+			static VCL_STRONG_INLINE Int slli(Int a) { return _mm512_slli_epi32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srli(Int a) { return _mm512_srli_epi32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srai(Int a) { return _mm512_srai_epi32(a, N); }
+		};
+	}
+
 	__m512 _mm512_sin_ps(__m512 v)
 	{
 		return sin512_ps(v);
@@ -59,6 +112,26 @@ namespace Vcl {
 		return exp512_ps(v);
 	}
 
+	__m512 _mm512_tan_ps(__m512 v)
+	{
+		return Core::Simd::Cephes::tan<Avx512MathOps>(v);
+	}
+
+	__m512 _mm512_log2_ps(__m512 v)
+	{
+		return Core::Simd::Cephes::log2<Avx512MathOps>(v);
+	}
+
+	__m512 _mm512_exp2_ps(__m512 v)
+	{
+		return Core::Simd::Cephes::exp2<Avx512MathOps>(v);
+	}
+
+	__m512 _mm512_pow_ps(__m512 x, __m512 y)
+	{
+		return Core::Simd::Cephes::pow<Avx512MathOps>(x, y);
+	}
+
 	// Handbook of Mathematical Functions
 	// M. Abramowitz and I.A. Stegun, Ed.
 	__m512 _mm512_acos_ps(__m512 v)
@@ -82,60 +155,21 @@ namespace Vcl {
 		return (negate * 3.14159265358979f + ret).get(0);
 	}
 
-	// Handbook of Mathematical Functions
-	// M. Abramowitz and I.A. Stegun, Ed.
 	__m512 _mm512_asin_ps(__m512 v)
 	{
-		float16 x{ v };
-
-		float16 negate = select(x < 0, float16{ 1 }, float16{ 0 });
-
-		x = abs(x);
-		float16 ret = -0.0187293f;
-		ret *= x;
-		ret += 0.0742610f;
-		ret *= x;
-		ret -= 0.2121144f;
-		ret *= x;
-		ret += 1.5707288f;
-		ret = 3.14159265358979f * 0.5f - sqrt(1.0f - x) * ret;
-		return (ret - 2.0f * negate * ret).get(0);
+		return Core::Simd::Cephes::asin<Avx512MathOps>(v);
 	}
 
-	__m512 _mm512_atan2_ps(__m512 in_y, __m512 in_x)
+	__m512 _mm512_atan_ps(__m512 v)
 	{
-		float16 t0, t1, t3, t4;
-
-		float16 x{ in_x };
-		float16 y{ in_y };
-
-		t3 = abs(x);
-		t1 = abs(y);
-		t0 = max(t3, t1);
-		t1 = min(t3, t1);
-		t3 = 1.0f / t0;
-		t3 = t1 * t3;
-
-		t4 = t3 * t3;
-		t0 = -0.013480470f;
-		t0 = t0 * t4 + 0.057477314f;
-		t0 = t0 * t4 - 0.121239071f;
-		t0 = t0 * t4 + 0.195635925f;
-		t0 = t0 * t4 - 0.332994597f;
-		t0 = t0 * t4 + 0.999995630f;
-		t3 = t0 * t3;
-
-		t3 = select(abs(y) > abs(x), 1.570796327f - t3, t3);
-		t3 = select(x < 0, 3.141592654f - t3, t3);
-		t3 = select(y < 0, -t3, t3);
-
-		return t3.get(0);
+		return Core::Simd::Cephes::atan<Avx512MathOps>(v);
 	}
 
-	__m512 _mm512_pow_ps(__m512 x, __m512 y)
+	__m512 _mm512_atan2_ps(__m512 y, __m512 x)
 	{
-		return _mm512_exp_ps(_mm512_mul_ps(_mm512_log_ps(x), y));
+		return Core::Simd::Cephes::atan2<Avx512MathOps>(y, x);
 	}
+
 #	endif
 }
 #endif // VCL_VECTORIZE_AVX
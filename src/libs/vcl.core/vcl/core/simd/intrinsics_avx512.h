@@ -53,9 +53,13 @@ namespace Vcl {
 	__m512 _mm512_cos_ps(__m512 v);
 	__m512 _mm512_log_ps(__m512 v);
 	__m512 _mm512_exp_ps(__m512 v);
+	__m512 _mm512_tan_ps(__m512 v);
+	__m512 _mm512_log2_ps(__m512 v);
+	__m512 _mm512_exp2_ps(__m512 v);
 
 	__m512 _mm512_acos_ps(__m512 v);
 	__m512 _mm512_asin_ps(__m512 v);
+	__m512 _mm512_atan_ps(__m512 v);
 	__m512 _mm512_atan2_ps(__m512 y, __m512 x);
 
 	__m512 _mm512_pow_ps(__m512 x, __m512 y);
@@ -103,6 +107,91 @@ namespace Vcl {
 		return result;
 	}
 
+	VCL_STRONG_INLINE __m512 _mmVCL_fmadd_ps(__m512 a, __m512 b, __m512 c)
+	{
+		return _mm512_fmadd_ps(a, b, c);
+	}
+
+	VCL_STRONG_INLINE __m512d _mm512_sgn_pd(__m512d v)
+	{
+		const __m512d one = _mm512_castsi512_pd(_mm512_or_epi64(
+			_mm512_and_epi64(_mm512_castpd_si512(v), _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull))),
+			_mm512_castpd_si512(_mm512_set1_pd(1.0))));
+		const __mmask8 is_neq_zero = _mm512_cmp_pd_mask(v, _mm512_setzero_pd(), _CMP_NEQ_OQ);
+		return _mm512_maskz_mov_pd(is_neq_zero, one);
+	}
+
+	VCL_STRONG_INLINE __mmask8 _mm512_cmpeq_pd(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+	VCL_STRONG_INLINE __mmask8 _mm512_cmpneq_pd(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_OQ); }
+	VCL_STRONG_INLINE __mmask8 _mm512_cmplt_pd(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+	VCL_STRONG_INLINE __mmask8 _mm512_cmple_pd(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+	VCL_STRONG_INLINE __mmask8 _mm512_cmpgt_pd(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+	VCL_STRONG_INLINE __mmask8 _mm512_cmpge_pd(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+
+	VCL_STRONG_INLINE __mmask8 _mm512_isinf_pd(__m512d x)
+	{
+		const __m512d sign_mask = _mm512_set1_pd(-0.0);
+		const __m512d inf = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+
+		x = _mm512_andnot_pd(sign_mask, x);
+		return _mm512_cmpeq_pd(x, inf);
+	}
+
+	// There is no fast approximation for double precision. Compute the exact result.
+	VCL_STRONG_INLINE __m512d _mmVCL_rsqrt_pd(__m512d v)
+	{
+		return _mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(v));
+	}
+
+	// There is no fast approximation for double precision. Compute the exact result.
+	VCL_STRONG_INLINE __m512d _mmVCL_rcp_pd(__m512d v)
+	{
+		return _mm512_div_pd(_mm512_set1_pd(1.0), v);
+	}
+
+	VCL_STRONG_INLINE __m512d _mmVCL_fmadd_pd(__m512d a, __m512d b, __m512d c)
+	{
+		return _mm512_fmadd_pd(a, b, c);
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmin_pd(__m512d v)
+	{
+		return _mm512_reduce_min_pd(v);
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmax_pd(__m512d v)
+	{
+		return _mm512_reduce_max_pd(v);
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_dp_pd(__m512d a, __m512d b)
+	{
+		return _mm512_reduce_add_pd(_mm512_mul_pd(a, b));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_extract_pd(__m512d v, int i)
+	{
+		typedef union
+		{
+			__m512d x;
+			double a[8];
+		} F64;
+
+		return F64{ v }.a[i];
+	}
+
+	//! Convert a register mask to a 32-bit lane mask
+	VCL_STRONG_INLINE __m256 _mm512VCL_mask_to_ps(__mmask8 mask)
+	{
+		return _mm256_castsi256_ps(_mm256_movm_epi32(mask));
+	}
+
+	//! Convert a 32-bit lane mask to a register mask
+	VCL_STRONG_INLINE __mmask8 _mm512VCL_ps_to_mask(__m256 mask)
+	{
+		return _mm256_movepi32_mask(_mm256_castps_si256(mask));
+	}
+
 	VCL_STRONG_INLINE float _mmVCL_hmin_ps(__m512 v)
 	{
 		return _mm512_reduce_min_ps(v);
@@ -30,9 +30,67 @@ VCL_BEGIN_EXTERNAL_HEADERS
 VCL_END_EXTERNAL_HEADERS
 
 // VCL
+#	include <vcl/core/simd/detail/cephes_mathfun.h>
 #	include <vcl/core/simd/vectorscalar.h>
 
 namespace Vcl {
+	namespace {
+		//! Operation policy for the Cephes based functions
+		struct NeonMathOps
+		{
+			using Float = float32x4_t;
+			using Int = int32x4_t;
+			using Mask = uint32x4_t;
+
+			static VCL_STRONG_INLINE Float set(float s) { return vdupq_n_f32(s); }
+			static VCL_STRONG_INLINE Int set_i(int s) { return vdupq_n_s32(s); }
+
+			static VCL_STRONG_INLINE Float add(Float a, Float b) { return vaddq_f32(a, b); }
+			static VCL_STRONG_INLINE Float sub(Float a, Float b) { return vsubq_f32(a, b); }
+			static VCL_STRONG_INLINE Float mul(Float a, Float b) { return vmulq_f32(a, b); }
+			static VCL_STRONG_INLINE Float div(Float a, Float b) { return vdivq_f32(a, b); }
+			static VCL_STRONG_INLINE Float fmadd(Float a, Float b, Float c) { return vmaddq_f32(a, b, c); }
+			static VCL_STRONG_INLINE Float sqrt(Float a) { return vsqrtq_f32(a); }
+			static VCL_STRONG_INLINE Float abs(Float a) { return vabsq_f32(a); }
+			static VCL_STRONG_INLINE Float min(Float a, Float b) { return vminq_f32(a, b); }
+			static VCL_STRONG_INLINE Float max(Float a, Float b) { return vmaxq_f32(a, b); }
+			static VCL_STRONG_INLINE Float floor(Float a)
+			{
+				// Truncate and correct the negative numbers
+				const Float t = vcvtq_f32_s32(vcvtq_s32_f32(a));
+				return vsubq_f32(t, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(t, a), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+			}
+
+			static VCL_STRONG_INLINE Float and_(Float a, Float b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+			static VCL_STRONG_INLINE Float or_(Float a, Float b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+			static VCL_STRONG_INLINE Float xor_(Float a, Float b) { return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+
+			static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) { return vceqq_f32(a, b); }
+			static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) { return vcltq_f32(a, b); }
+			static VCL_STRONG_INLINE Mask cmpgt(Float a, Float b) { return vcgtq_f32(a, b); }
+			static VCL_STRONG_INLINE Mask cmpge(Float a, Float b) { return vcgeq_f32(a, b); }
+			static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) { return vandq_u32(a, b); }
+			static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) { return vorrq_u32(a, b); }
+			static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) { return vbslq_f32(m, a, b); }
+
+			static VCL_STRONG_INLINE Int cvtt(Float a) { return vcvtq_s32_f32(a); }
+			static VCL_STRONG_INLINE Float cvt(Int a) { return vcvtq_f32_s32(a); }
+			static VCL_STRONG_INLINE Float cast_f(Int a) { return vreinterpretq_f32_s32(a); }
+			static VCL_STRONG_INLINE Int cast_i(Float a) { return vreinterpretq_s32_f32(a); }
+
+			static VCL_STRONG_INLINE Int add_i(Int a, Int b) { return vaddq_s32(a, b); }
+			static VCL_STRONG_INLINE Int sub_i(Int a, Int b) { return vsubq_s32(a, b); }
+			static VCL_STRONG_INLINE Int and_i(Int a, Int b) { return vandq_s32(a, b); }
+			static VCL_STRONG_INLINE Int or_i(Int a, Int b) { return vorrq_s32(a, b); }
+			template<int N>
+			static VCL_STRONG_INLINE Int slli(Int a) { return vshlq_n_s32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srli(Int a) { return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a), N)); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srai(Int a) { return vshrq_n_s32(a, N); }
+		};
+	}
+
 
 	float32x4_t vsinq_f32(float32x4_t v)
 	{
@@ -54,9 +112,24 @@ namespace Vcl {
 		return exp_ps(v);
 	}
 
+	float32x4_t vtanq_f32(float32x4_t v)
+	{
+		return Core::Simd::Cephes::tan<NeonMathOps>(v);
+	}
+
+	float32x4_t vlog2q_f32(float32x4_t v)
+	{
+		return Core::Simd::Cephes::log2<NeonMathOps>(v);
+	}
+
+	float32x4_t vexp2q_f32(float32x4_t v)
+	{
+		return Core::Simd::Cephes::exp2<NeonMathOps>(v);
+	}
+
 	float32x4_t vpowq_f32(float32x4_t x, float32x4_t y)
 	{
-		return vexpq_f32(vmulq_f32(vlogq_f32(x), y));
+		return Core::Simd::Cephes::pow<NeonMathOps>(x, y);
 	}
 
 	// Handbook of Mathematical Functions
@@ -84,58 +157,19 @@ namespace Vcl {
 		return (negate * 3.14159265358979f + ret).get(0);
 	}
 
-	// Handbook of Mathematical Functions
-	// M. Abramowitz and I.A. Stegun, Ed.
 	float32x4_t vasinq_f32(float32x4_t v)
 	{
-		using float4 = VectorScalar<float, 4>;
-
-		float4 x{ v };
-
-		float4 negate = select(x < 0, float4{ 1 }, float4{ 0 });
-
-		x = abs(x);
-		float4 ret = -0.0187293f;
-		ret *= x;
-		ret += 0.0742610f;
-		ret *= x;
-		ret -= 0.2121144f;
-		ret *= x;
-		ret += 1.5707288f;
-		ret = 3.14159265358979f * 0.5f - sqrt(1.0f - x) * ret;
-		return (ret - 2.0f * negate * ret).get(0);
+		return Core::Simd::Cephes::asin<NeonMathOps>(v);
 	}
 
-	float32x4_t vatan2q_f32(float32x4_t in_y, float32x4_t in_x)
+	float32x4_t vatanq_f32(float32x4_t v)
 	{
-		using float4 = VectorScalar<float, 4>;
-
-		float4 t0, t1, t3, t4;
-
-		float4 x{ in_x };
-		float4 y{ in_y };
-
-		t3 = abs(x);
-		t1 = abs(y);
-		t0 = max(t3, t1);
-		t1 = min(t3, t1);
-		t3 = 1.0f / t0;
-		t3 = t1 * t3;
-
-		t4 = t3 * t3;
-		t0 = -0.013480470f;
-		t0 = t0 * t4 + 0.057477314f;
-		t0 = t0 * t4 - 0.121239071f;
-		t0 = t0 * t4 + 0.195635925f;
-		t0 = t0 * t4 - 0.332994597f;
-		t0 = t0 * t4 + 0.999995630f;
-		t3 = t0 * t3;
-
-		t3 = select(abs(y) > abs(x), 1.570796327f - t3, t3);
-		t3 = select(x < 0, 3.141592654f - t3, t3);
-		t3 = select(y < 0, -t3, t3);
+		return Core::Simd::Cephes::atan<NeonMathOps>(v);
+	}
 
-		return t3.get(0);
+	float32x4_t vatan2q_f32(float32x4_t y, float32x4_t x)
+	{
+		return Core::Simd::Cephes::atan2<NeonMathOps>(y, x);
 	}
 
 	float32x4_t vsqrtq_f32(float32x4_t x)
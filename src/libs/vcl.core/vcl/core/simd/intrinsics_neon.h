@@ -37,9 +37,13 @@ namespace Vcl {
 	float32x4_t vcosq_f32(float32x4_t v);
 	float32x4_t vlogq_f32(float32x4_t v);
 	float32x4_t vexpq_f32(float32x4_t v);
+	float32x4_t vtanq_f32(float32x4_t v);
+	float32x4_t vlog2q_f32(float32x4_t v);
+	float32x4_t vexp2q_f32(float32x4_t v);
 
 	float32x4_t vacosq_f32(float32x4_t v);
 	float32x4_t vasinq_f32(float32x4_t v);
+	float32x4_t vatanq_f32(float32x4_t v);
 
 	float32x4_t vatan2q_f32(float32x4_t y, float32x4_t x);
 	float32x4_t vpowq_f32(float32x4_t x, float32x4_t y);
@@ -121,6 +125,16 @@ namespace Vcl {
 
 	float32x4_t vsqrtq_f32(float32x4_t x);
 
+	//! Computes a * b + c, fused if the target supports it
+	VCL_STRONG_INLINE float32x4_t vmaddq_f32(float32x4_t a, float32x4_t b, float32x4_t c)
+	{
+#	if defined(__ARM_FEATURE_FMA)
+		return vfmaq_f32(c, a, b);
+#	else
+		return vmlaq_f32(c, a, b);
+#	endif
+	}
+
 	VCL_STRONG_INLINE uint32x4_t vcneqq_f32(float32x4_t x, float32x4_t y)
 	{
 		return vmvnq_u32(vceqq_f32(x, y));
@@ -32,10 +32,63 @@ VCL_BEGIN_EXTERNAL_HEADERS
 VCL_END_EXTERNAL_HEADERS
 
 // VCL
+#	include <vcl/core/simd/detail/cephes_mathfun.h>
 #	include <vcl/core/simd/vectorscalar.h>
 
 namespace Vcl {
 #	if !defined(VCL_COMPILER_MSVC) || _MSC_VER < 1920
+	namespace {
+		//! Operation policy for the Cephes based functions
+		struct SseMathOps
+		{
+			using Float = __m128;
+			using Int = __m128i;
+			using Mask = __m128;
+
+			static VCL_STRONG_INLINE Float set(float s) noexcept { return _mm_set1_ps(s); }
+			static VCL_STRONG_INLINE Int set_i(int s) noexcept { return _mm_set1_epi32(s); }
+
+			static VCL_STRONG_INLINE Float add(Float a, Float b) noexcept { return _mm_add_ps(a, b); }
+			static VCL_STRONG_INLINE Float sub(Float a, Float b) noexcept { return _mm_sub_ps(a, b); }
+			static VCL_STRONG_INLINE Float mul(Float a, Float b) noexcept { return _mm_mul_ps(a, b); }
+			static VCL_STRONG_INLINE Float div(Float a, Float b) noexcept { return _mm_div_ps(a, b); }
+			static VCL_STRONG_INLINE Float fmadd(Float a, Float b, Float c) noexcept { return _mmVCL_fmadd_ps(a, b, c); }
+			static VCL_STRONG_INLINE Float sqrt(Float a) noexcept { return _mm_sqrt_ps(a); }
+			static VCL_STRONG_INLINE Float abs(Float a) noexcept { return Core::Simd::SSE::abs_f32(a); }
+			static VCL_STRONG_INLINE Float min(Float a, Float b) noexcept { return _mm_min_ps(a, b); }
+			static VCL_STRONG_INLINE Float max(Float a, Float b) noexcept { return _mm_max_ps(a, b); }
+			static VCL_STRONG_INLINE Float floor(Float a) noexcept { return _mmVCL_floor_ps(a); }
+
+			static VCL_STRONG_INLINE Float and_(Float a, Float b) noexcept { return _mm_and_ps(a, b); }
+			static VCL_STRONG_INLINE Float or_(Float a, Float b) noexcept { return _mm_or_ps(a, b); }
+			static VCL_STRONG_INLINE Float xor_(Float a, Float b) noexcept { return _mm_xor_ps(a, b); }
+
+			static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) noexcept { return _mm_cmpeq_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) noexcept { return _mm_cmplt_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmpgt(Float a, Float b) noexcept { return _mm_cmpgt_ps(a, b); }
+			static VCL_STRONG_INLINE Mask cmpge(Float a, Float b) noexcept { return _mm_cmpge_ps(a, b); }
+			static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) noexcept { return _mm_and_ps(a, b); }
+			static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) noexcept { return _mm_or_ps(a, b); }
+			static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) noexcept { return Core::Simd::SSE::blend_f32(b, a, m); }
+
+			static VCL_STRONG_INLINE Int cvtt(Float a) noexcept { return _mm_cvttps_epi32(a); }
+			static VCL_STRONG_INLINE Float cvt(Int a) noexcept { return _mm_cvtepi32_ps(a); }
+			static VCL_STRONG_INLINE Float cast_f(Int a) noexcept { return _mm_castsi128_ps(a); }
+			static VCL_STRONG_INLINE Int cast_i(Float a) noexcept { return _mm_castps_si128(a); }
+
+			static VCL_STRONG_INLINE Int add_i(Int a, Int b) noexcept { return _mm_add_epi32(a, b); }
+			static VCL_STRONG_INLINE Int sub_i(Int a, Int b) noexcept { return _mm_sub_epi32(a, b); }
+			static VCL_STRONG_INLINE Int and_i(Int a, Int b) noexcept { return _mm_and_si128(a, b); }
+			static VCL_STRONG_INLINE Int or_i(Int a, Int b) noexcept { return _mm_or_si128(a, b); }
+			template<int N>
+			static VCL_STRONG_INLINE Int slli(Int a) noexcept { return _mm_slli_epi32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srli(Int a) noexcept { return _mm_srli_epi32(a, N); }
+			template<int N>
+			static VCL_STRONG_INLINE Int srai(Int a) noexcept { return _mm_srai_epi32(a, N); }
+		};
+	}
+
 	__m128 _mm_sin_ps(__m128 v) noexcept
 	{
 		return sin_ps(v);
@@ -56,9 +109,24 @@ namespace Vcl {
 		return exp_ps(v);
 	}
 
+	__m128 _mm_tan_ps(__m128 v) noexcept
+	{
+		return Core::Simd::Cephes::tan<SseMathOps>(v);
+	}
+
+	__m128 _mm_log2_ps(__m128 v) noexcept
+	{
+		return Core::Simd::Cephes::log2<SseMathOps>(v);
+	}
+
+	__m128 _mm_exp2_ps(__m128 v) noexcept
+	{
+		return Core::Simd::Cephes::exp2<SseMathOps>(v);
+	}
+
 	__m128 _mm_pow_ps(__m128 x, __m128 y) noexcept
 	{
-		return _mm_exp_ps(_mm_mul_ps(_mm_log_ps(x), y));
+		return Core::Simd::Cephes::pow<SseMathOps>(x, y);
 	}
 
 	// Handbook of Mathematical Functions
@@ -84,55 +152,21 @@ namespace Vcl {
 		return (negate * 3.14159265358979f + ret).get(0);
 	}
 
-	// Handbook of Mathematical Functions
-	// M. Abramowitz and I.A. Stegun, Ed.
 	__m128 _mm_asin_ps(__m128 v) noexcept
 	{
-		float4 x{ v };
-
-		const float4 negate = select(x < 0, float4{ 1 }, float4{ 0 });
+		return Core::Simd::Cephes::asin<SseMathOps>(v);
+	}
 
-		x = abs(x);
-		float4 ret = -0.0187293f;
-		ret *= x;
-		ret += 0.0742610f;
-		ret *= x;
-		ret -= 0.2121144f;
-		ret *= x;
-		ret += 1.5707288f;
-		ret = 3.14159265358979f * 0.5f - sqrt(1.0f - x) * ret;
-		return (ret - 2.0f * negate * ret).get(0);
+	__m128 _mm_atan_ps(__m128 v) noexcept
+	{
+		return Core::Simd::Cephes::atan<SseMathOps>(v);
 	}
 
-	__m128 _mm_atan2_ps(__m128 in_y, __m128 in_x) noexcept
+	__m128 _mm_atan2_ps(__m128 y, __m128 x) noexcept
 	{
-		float4 t0, t1, t3, t4;
-
-		float4 x{ in_x };
-		float4 y{ in_y };
-
-		t3 = abs(x);
-		t1 = abs(y);
-		t0 = max(t3, t1);
-		t1 = min(t3, t1);
-		t3 = 1.0f / t0;
-		t3 = t1 * t3;
-
-		t4 = t3 * t3;
-		t0 = -0.013480470f;
-		t0 = t0 * t4 + 0.057477314f;
-		t0 = t0 * t4 - 0.121239071f;
-		t0 = t0 * t4 + 0.195635925f;
-		t0 = t0 * t4 - 0.332994597f;
-		t0 = t0 * t4 + 0.999995630f;
-		t3 = t0 * t3;
-
-		t3 = select(abs(y) > abs(x), 1.570796327f - t3, t3);
-		t3 = select(x < 0, 3.141592654f - t3, t3);
-		t3 = select(y < 0, -t3, t3);
-
-		return t3.get(0);
+		return Core::Simd::Cephes::atan2<SseMathOps>(y, x);
 	}
+
 #	endif
 
 	__m128 _mmVCL_floor_ps(__m128 x) noexcept
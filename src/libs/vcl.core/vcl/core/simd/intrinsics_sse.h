@@ -35,6 +35,7 @@
 
 #	define VCL_M128I_SIGNBIT _mm_set1_epi32(int(0x80000000))
 #	define VCL_M128I_ALLBITS _mm_set1_epi32(int(0xffffffff))
+#	define VCL_M128I_SIGNBIT_64 _mm_set1_epi64x(static_cast<long long>(0x8000000000000000ull))
 
 namespace Vcl {
 	namespace Core { namespace Simd { namespace SSE {
@@ -116,6 +117,45 @@ namespace Vcl {
 		{
 			return _mm_and_ps(_mm_or_ps(_mm_and_ps(v, _mm_castsi128_ps(VCL_M128I_SIGNBIT)), _mm_set1_ps(1.0f)), _mm_cmpneq_ps(v, _mm_setzero_ps()));
 		}
+
+		/// Per element absolut value
+		VCL_STRONG_INLINE __m128d abs_f64(__m128d a) noexcept
+		{
+			return _mm_andnot_pd(_mm_castsi128_pd(VCL_M128I_SIGNBIT_64), a);
+		}
+
+		VCL_STRONG_INLINE __m128d blend_f64(__m128d a, __m128d b, __m128d mask) noexcept
+		{
+#	ifdef VCL_VECTORIZE_SSE4_1
+			return _mm_blendv_pd(a, b, mask);
+#	else
+			// (a & ~mask) | (b & mask)
+			return _mm_or_pd(_mm_andnot_pd(mask, a), _mm_and_pd(mask, b));
+#	endif
+		}
+
+		VCL_STRONG_INLINE __m128d sgn_f64(__m128d v) noexcept
+		{
+			return _mm_and_pd(_mm_or_pd(_mm_and_pd(v, _mm_castsi128_pd(VCL_M128I_SIGNBIT_64)), _mm_set1_pd(1.0)), _mm_cmpneq_pd(v, _mm_setzero_pd()));
+		}
+
+		/// Combine the 64-bit lane masks of two registers to a 32-bit lane mask
+		VCL_STRONG_INLINE __m128 pack_mask_f64(__m128d lo, __m128d hi) noexcept
+		{
+			return _mm_shuffle_ps(_mm_castpd_ps(lo), _mm_castpd_ps(hi), _MM_SHUFFLE(2, 0, 2, 0));
+		}
+
+		/// Widen the lower two 32-bit lane masks to 64-bit lane masks
+		VCL_STRONG_INLINE __m128d unpacklo_mask_f64(__m128 mask) noexcept
+		{
+			return _mm_castps_pd(_mm_unpacklo_ps(mask, mask));
+		}
+
+		/// Widen the upper two 32-bit lane masks to 64-bit lane masks
+		VCL_STRONG_INLINE __m128d unpackhi_mask_f64(__m128 mask) noexcept
+		{
+			return _mm_castps_pd(_mm_unpackhi_ps(mask, mask));
+		}
 	}}}
 
 	VCL_STRONG_INLINE __m128i _mm_cmpneq_epi32(__m128i a, __m128i b) noexcept
@@ -146,9 +186,13 @@ namespace Vcl {
 	__m128 _mm_cos_ps(__m128 v) noexcept;
 	__m128 _mm_log_ps(__m128 v) noexcept;
 	__m128 _mm_exp_ps(__m128 v) noexcept;
+	__m128 _mm_tan_ps(__m128 v) noexcept;
+	__m128 _mm_log2_ps(__m128 v) noexcept;
+	__m128 _mm_exp2_ps(__m128 v) noexcept;
 
 	__m128 _mm_acos_ps(__m128 v) noexcept;
 	__m128 _mm_asin_ps(__m128 v) noexcept;
+	__m128 _mm_atan_ps(__m128 v) noexcept;
 	__m128 _mm_atan2_ps(__m128 in_y, __m128 in_x) noexcept;
 
 	__m128 _mm_pow_ps(__m128 x, __m128 y) noexcept;
@@ -193,6 +237,75 @@ namespace Vcl {
 		return result;
 	}
 
+	//! Fused multiply-add, computes a * b + c
+	//! Without hardware support the product is rounded before the addition
+	VCL_STRONG_INLINE __m128 _mmVCL_fmadd_ps(__m128 a, __m128 b, __m128 c) noexcept
+	{
+#	ifdef VCL_VECTORIZE_FMA
+		return _mm_fmadd_ps(a, b, c);
+#	else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#	endif
+	}
+
+	VCL_STRONG_INLINE __m128d _mm_isinf_pd(__m128d x) noexcept
+	{
+		const __m128d sign_mask = _mm_set1_pd(-0.0);
+		const __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+
+		x = _mm_andnot_pd(sign_mask, x);
+		x = _mm_cmpeq_pd(x, inf);
+		return x;
+	}
+
+	// There is no fast approximation for double precision. Compute the exact result.
+	VCL_STRONG_INLINE __m128d _mmVCL_rsqrt_pd(__m128d v) noexcept
+	{
+		return _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(v));
+	}
+
+	// There is no fast approximation for double precision. Compute the exact result.
+	VCL_STRONG_INLINE __m128d _mmVCL_rcp_pd(__m128d v) noexcept
+	{
+		return _mm_div_pd(_mm_set1_pd(1.0), v);
+	}
+
+	VCL_STRONG_INLINE __m128d _mmVCL_fmadd_pd(__m128d a, __m128d b, __m128d c) noexcept
+	{
+#	ifdef VCL_VECTORIZE_FMA
+		return _mm_fmadd_pd(a, b, c);
+#	else
+		return _mm_add_pd(_mm_mul_pd(a, b), c);
+#	endif
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmin_pd(__m128d v) noexcept
+	{
+		return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_hmax_pd(__m128d v) noexcept
+	{
+		return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_dp_pd(__m128d a, __m128d b) noexcept
+	{
+		const __m128d ab = _mm_mul_pd(a, b);
+		return _mm_cvtsd_f64(_mm_add_sd(ab, _mm_unpackhi_pd(ab, ab)));
+	}
+
+	VCL_STRONG_INLINE double _mmVCL_extract_pd(__m128d v, int i) noexcept
+	{
+		using F64 = union
+		{
+			__m128d x;
+			double a[2];
+		};
+
+		return F64{ v }.a[i];
+	}
+
 	VCL_STRONG_INLINE float _mmVCL_hmin_ps(__m128 v) noexcept
 	{
 		const __m128 data = v;                                                              /* [0, 1, 2, 3] */
@@ -29,8 +29,13 @@
 
 // C++ standard library
 #include <array>
+#include <type_traits>
+
+// Abseil
+#include <absl/utility/utility.h>
 
 // VCL
+#include <vcl/core/simd/storage.h>
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/interleavedarray.h>
 
@@ -69,59 +74,158 @@ namespace Vcl {
 		return *(base + vindex * 1);
 	}
 
-	template<typename Scalar, int Width, int Rows, int Cols>
-	Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather(
-		const Eigen::Matrix<Scalar, Rows, Cols>* base,
-		VectorScalar<int, Width>& vindex)
+	template<typename T, int Width>
+	VectorScalar<T, Width> gather(T const* base, VectorScalar<int, Width> vindex)
 	{
-		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
-		static_assert(sizeof(Eigen::Matrix<Scalar, Rows, Cols>) == Rows * Cols * sizeof(Scalar), "Size of matrix type does not contain any padding.");
+		alignas(64) T gathered[Width];
+		for (int i = 0; i < Width; i++)
+			gathered[i] = *(base + vindex[i]);
 
-		using wideint_t = VectorScalar<int, Width>;
+		VectorScalar<T, Width> value;
+		load(value, gathered);
+		return value;
+	}
 
-		Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> res;
+	namespace Core { namespace Simd { namespace Details {
+		//! Gathering small matrices is implemented by copying the matrices to a
+		//! consecutive buffer and transposing them using vector loads on targets
+		//! without hardware gather instructions.
+		template<typename Scalar, int Size>
+		struct GatherByTransposition : std::integral_constant<
+			bool,
+#if (defined(VCL_VECTORIZE_SSE) || defined(VCL_VECTORIZE_NEON)) && !defined(VCL_VECTORIZE_AVX2)
+			(std::is_same<Scalar, float>::value || std::is_same<Scalar, int>::value) && 2 <= Size && Size <= 4
+#else
+			false
+#endif
+			>
+		{
+		};
 
-		for (int c = 0; c < Cols; c++)
+		template<typename Scalar, int Width, int Rows, int Cols>
+		VCL_STRONG_INLINE Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather_matrices(
+			const Eigen::Matrix<Scalar, Rows, Cols>* base,
+			const VectorScalar<int, Width>& vindex,
+			std::false_type)
 		{
-			for (int r = 0; r < Rows; r++)
+			using wideint_t = VectorScalar<int, Width>;
+
+			// Offset to the first entry of each matrix, the entries are addressed by the base pointer
+			const wideint_t idx = vindex * wideint_t(Rows * Cols);
+
+			Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> res;
+			for (int c = 0; c < Cols; c++)
 			{
-				const wideint_t scale = wideint_t(Rows * Cols);
-				const wideint_t offset = wideint_t(Rows * c + r);
-				const wideint_t idx = scale * vindex + offset;
-				res(r, c) = gather(base->data(), idx);
+				for (int r = 0; r < Rows; r++)
+				{
+					res(r, c) = gather(base->data() + Rows * c + r, idx);
+				}
 			}
+
+			return res;
 		}
 
-		return res;
+		template<typename Scalar, int Width, int Rows, int Cols>
+		VCL_STRONG_INLINE Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather_matrices(
+			const Eigen::Matrix<Scalar, Rows, Cols>* base,
+			const VectorScalar<int, Width>& vindex,
+			std::true_type)
+		{
+			using flat_t = Eigen::Matrix<Scalar, Rows * Cols, 1>;
+
+			flat_t buffer[Width];
+			for (int i = 0; i < Width; i++)
+				buffer[i] = Eigen::Map<const flat_t>(base[vindex[i]].data());
+
+			Eigen::Matrix<VectorScalar<Scalar, Width>, Rows * Cols, 1> transposed;
+			load(transposed, buffer);
+
+			Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> res;
+			for (int c = 0; c < Cols; c++)
+			{
+				for (int r = 0; r < Rows; r++)
+				{
+					res(r, c) = transposed(Rows * c + r);
+				}
+			}
+
+			return res;
+		}
+
+		//! Compute the offsets to the first scalar of the entries 'vindex' in an
+		//! interleaved array as well as the distance between two consecutive
+		//! scalars of the same entry.
+		template<typename Scalar, int Width, int Rows, int Cols, int Stride, typename Alloc>
+		VCL_STRONG_INLINE VectorScalar<int, Width> interleaved_offsets(
+			const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>& base,
+			const VectorScalar<int, Width>& vindex,
+			int& scalar_stride)
+		{
+			using wideint_t = VectorScalar<int, Width>;
+			using array_t = Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>;
+
+			if (array_t::Stride == Vcl::Core::DynamicStride)
+			{
+				scalar_stride = static_cast<int>(base.capacity());
+				return vindex;
+			} else if (array_t::Stride == 1)
+			{
+				scalar_stride = 1;
+				return vindex * wideint_t(Rows * Cols);
+			} else
+			{
+				scalar_stride = array_t::Stride;
+
+				alignas(64) int offsets[Width];
+				for (int i = 0; i < Width; i++)
+				{
+					const int entry = vindex[i] % array_t::Stride;
+					offsets[i] = (vindex[i] - entry) * Rows * Cols + entry;
+				}
+
+				wideint_t offset;
+				load(offset, offsets);
+				return offset;
+			}
+		}
+	}}}
+
+	template<typename Scalar, int Width, int Rows, int Cols>
+	Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather(
+		const Eigen::Matrix<Scalar, Rows, Cols>* base,
+		VectorScalar<int, Width>& vindex)
+	{
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+		static_assert(sizeof(Eigen::Matrix<Scalar, Rows, Cols>) == Rows * Cols * sizeof(Scalar), "Size of matrix type does not contain any padding.");
+
+		using transpose_t = Core::Simd::Details::GatherByTransposition<Scalar, Rows * Cols>;
+		return Core::Simd::Details::gather_matrices(base, vindex, transpose_t{});
 	}
 
-	template<typename Scalar, int Width, int Rows, int Cols, int Stride>
+	template<typename Scalar, int Width, int Rows, int Cols, int Stride, typename Alloc>
 	Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> gather(
-		const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base,
+		const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>& base,
 		VectorScalar<int, Width>& vindex)
 	{
 		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
 
+		int scalar_stride = 0;
+		const VectorScalar<int, Width> offset = Core::Simd::Details::interleaved_offsets(base, vindex, scalar_stride);
+
 		Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols> res;
 		for (int c = 0; c < Cols; c++)
 		{
 			for (int r = 0; r < Rows; r++)
 			{
-				VectorScalar<Scalar, Width> tmp;
-				for (int i = 0; i < Width; i++)
-				{
-					tmp[i] = base.template at<Scalar>(vindex[i] * 1)(r, c);
-				}
-
-				res(r, c) = tmp;
+				res(r, c) = gather(base.data() + (Rows * c + r) * scalar_stride, offset);
 			}
 		}
 
 		return res;
 	}
 
-	template<typename Scalar, int Rows, int Cols, int Stride>
-	Eigen::Matrix<Scalar, Rows, Cols> gather(const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base, int vindex)
+	template<typename Scalar, int Rows, int Cols, int Stride, typename Alloc>
+	Eigen::Matrix<Scalar, Rows, Cols> gather(const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>& base, int vindex)
 	{
 		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
 
@@ -158,26 +262,49 @@ namespace Vcl {
 		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
 
 		using intN_t = VectorScalar<int, Width>;
+
+		const intN_t idx = vindex * intN_t(Rows * Cols);
 		for (int c = 0; c < Cols; c++)
 		{
 			for (int r = 0; r < Rows; r++)
 			{
-				const intN_t scale = intN_t(Rows * Cols);
-				const intN_t offset = intN_t(Rows * c + r);
-				const intN_t idx = scale * vindex + offset;
-				scatter(value(r, c), base->data(), idx);
+				scatter(value(r, c), base->data() + Rows * c + r, idx);
 			}
 		}
 	}
 
-	template<typename Scalar, int Rows, int Cols, int Stride>
-	void scatter(const Eigen::Matrix<Scalar, Rows, Cols>& value, Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride>& base, int vindex)
+	template<typename Scalar, int Rows, int Cols, int Stride, typename Alloc>
+	void scatter(const Eigen::Matrix<Scalar, Rows, Cols>& value, Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>& base, int vindex)
 	{
 		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
 
 		base.template at<Scalar>(vindex * 1) = value;
 	}
 
+	//! Scatter the matrices of 'value' to the entries 'vindex' of 'base'.
+	//! The matrix entries are written using one scatter per matrix coefficient, which
+	//! never overlap between coefficients. Duplicated indices are resolved in lane order
+	//! for every coefficient, such that an entry is never assembled from different lanes.
+	template<typename Scalar, int Width, int Rows, int Cols, int Stride, typename Alloc>
+	void scatter(
+		const Eigen::Matrix<VectorScalar<Scalar, Width>, Rows, Cols>& value,
+		Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>& base,
+		const VectorScalar<int, Width>& vindex)
+	{
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+
+		int scalar_stride = 0;
+		const VectorScalar<int, Width> offset = Core::Simd::Details::interleaved_offsets(base, vindex, scalar_stride);
+
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				scatter(value(r, c), base.data() + (Rows * c + r) * scalar_stride, offset);
+			}
+		}
+	}
+
 #if !defined(VCL_VECTORIZE_SSE) && !defined(VCL_VECTORIZE_AVX) && !defined(VCL_VECTORIZE_NEON)
 	template<typename T, int Width>
 	VCL_STRONG_INLINE void load(VectorScalar<T, Width>& value, const T* base)
@@ -185,6 +312,22 @@ namespace Vcl {
 		value = VectorScalar<T, Width>(base, 1);
 	}
 
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void store(T* base, const VectorScalar<T, Width>& value)
+	{
+		for (int i = 0; i < Width; i++)
+			base[i] = value[i];
+	}
+
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void load(
+		Eigen::Matrix<VectorScalar<T, Width>, 2, 1>& loaded,
+		const Eigen::Matrix<T, 2, 1>* base)
+	{
+		loaded(0) = VectorScalar<T, Width>(base->data() + 0, 2);
+		loaded(1) = VectorScalar<T, Width>(base->data() + 1, 2);
+	}
+
 	template<typename T, int Width>
 	VCL_STRONG_INLINE void load(
 		Eigen::Matrix<VectorScalar<T, Width>, 3, 1>& loaded,
@@ -206,16 +349,6 @@ namespace Vcl {
 		loaded(3) = VectorScalar<T, Width>(base->data() + 3, 4);
 	}
 
-	template<typename T, int Width>
-	VectorScalar<T, Width> gather(T const* base, VectorScalar<int, Width> vindex)
-	{
-		VectorScalar<T, Width> gathered;
-		for (size_t i = 0; i < Width; i++)
-			gathered[i] = *(base + vindex[i]);
-
-		return gathered;
-	}
-
 	template<typename T, int Width>
 	VCL_STRONG_INLINE std::array<VectorScalar<T, Width>, 2> interleave(const VectorScalar<T, Width>& a, const VectorScalar<T, Width>& b)
 	{
@@ -236,4 +369,329 @@ namespace Vcl {
 		return { low, high };
 	}
 #endif
+
+#if defined(VCL_VECTORIZE_NEON)
+	// The double types use the reference implementation on NEON
+	template<int Width>
+	VCL_STRONG_INLINE void load(VectorScalar<double, Width>& value, const double* base)
+	{
+		value = VectorScalar<double, Width>(base, 1);
+	}
+
+	template<int Width>
+	VectorScalar<double, Width> gather(double const* base, VectorScalar<int, Width> vindex)
+	{
+		VectorScalar<double, Width> gathered;
+		for (int i = 0; i < Width; i++)
+			gathered[i] = *(base + vindex[i]);
+
+		return gathered;
+	}
+#endif
+
+	//! Load the entries of 'base' whose lane is set in 'mask'.
+	//! Lanes not set in 'mask' keep their current value in 'value'
+	//! and their memory location is never accessed.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void load(VectorScalar<T, Width>& value, const T* base, const VectorScalar<bool, Width>& mask)
+	{
+		VclRequire(base, "Load memory location is not null");
+
+		alignas(64) T merged[Width];
+		for (int i = 0; i < Width; i++)
+			merged[i] = mask[i] ? base[i] : value[i];
+
+		load(value, merged);
+	}
+
+	//! Store the entries of 'value' whose lane is set in 'mask'.
+	//! Memory locations of lanes not set in 'mask' are never accessed.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void store(T* base, const VectorScalar<T, Width>& value, const VectorScalar<bool, Width>& mask)
+	{
+		VclRequire(base, "Store memory location is not null");
+
+		for (int i = 0; i < Width; i++)
+		{
+			if (mask[i])
+				base[i] = value[i];
+		}
+	}
+
+	//! Select the entries of 'a' in memory where 'mask' is set, otherwise the entries of 'b'.
+	//! Equivalent to 'select(mask, load(a), b)' without touching the memory of masked-off lanes.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE VectorScalar<T, Width> select(const VectorScalar<bool, Width>& mask, const T* a, const VectorScalar<T, Width>& b)
+	{
+		VectorScalar<T, Width> selected = b;
+		load(selected, a, mask);
+		return selected;
+	}
+
+	namespace Core { namespace Simd { namespace Details {
+		//! Create a mask with the first 'count' lanes set
+		template<int Width>
+		VCL_STRONG_INLINE VectorScalar<bool, Width> prefix_mask(int count)
+		{
+			alignas(64) static const int lanes[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+			VectorScalar<int, Width> idx;
+			load(idx, lanes);
+			return idx < VectorScalar<int, Width>(count);
+		}
+	}}}
+
+	//! Load the first 'count' entries of 'base', the remaining lanes are set to zero.
+	//! Memory beyond 'base + count' is never accessed.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void load_n(VectorScalar<T, Width>& value, const T* base, int count)
+	{
+		VclRequire(0 <= count && count <= Width, "Number of loaded entries is valid");
+
+		value = VectorScalar<T, Width>(T(0));
+		load(value, base, Core::Simd::Details::prefix_mask<Width>(count));
+	}
+
+	//! Store the first 'count' lanes of 'value' to 'base'.
+	//! Memory beyond 'base + count' is never accessed.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void store_n(T* base, const VectorScalar<T, Width>& value, int count)
+	{
+		VclRequire(0 <= count && count <= Width, "Number of stored entries is valid");
+
+		store(base, value, Core::Simd::Details::prefix_mask<Width>(count));
+	}
+
+	//! Load the first 'count' vectors of 'base', the remaining lanes are set to zero.
+	//! The vectors are staged through a local buffer, such that memory beyond
+	//! 'base + count' is never accessed.
+	template<typename T, int Width, int Rows>
+	VCL_STRONG_INLINE void load_n(
+		Eigen::Matrix<VectorScalar<T, Width>, Rows, 1>& loaded,
+		const Eigen::Matrix<T, Rows, 1>* base,
+		int count)
+	{
+		VclRequire(0 <= count && count <= Width, "Number of loaded entries is valid");
+
+		alignas(64) Eigen::Matrix<T, Rows, 1> buffer[Width];
+		for (int i = 0; i < count; i++)
+			buffer[i] = base[i];
+		for (int i = count; i < Width; i++)
+			buffer[i].setZero();
+
+		load(loaded, buffer);
+	}
+
+	//! Store the first 'count' vectors of 'value' to 'base'.
+	//! Memory beyond 'base + count' is never accessed.
+	template<typename T, int Width, int Rows>
+	VCL_STRONG_INLINE void store_n(
+		Eigen::Matrix<T, Rows, 1>* base,
+		const Eigen::Matrix<VectorScalar<T, Width>, Rows, 1>& value,
+		int count)
+	{
+		VclRequire(0 <= count && count <= Width, "Number of stored entries is valid");
+
+		alignas(64) Eigen::Matrix<T, Rows, 1> buffer[Width];
+		store(buffer, value);
+		for (int i = 0; i < count; i++)
+			base[i] = buffer[i];
+	}
+
+	//! Gather the entries of 'base' indexed by the lanes set in 'mask'.
+	//! Lanes not set in 'mask' are zero and their indices are never dereferenced.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE VectorScalar<T, Width> gather(T const* base, const VectorScalar<int, Width>& vindex, const VectorScalar<bool, Width>& mask)
+	{
+		alignas(64) T gathered[Width];
+		for (int i = 0; i < Width; i++)
+			gathered[i] = mask[i] ? base[vindex[i]] : T(0);
+
+		VectorScalar<T, Width> value;
+		load(value, gathered);
+		return value;
+	}
+
+	//! Scatter the lanes of 'value' set in 'mask' to the entries of 'base' indexed by 'vindex'.
+	//! Conflicting indices are resolved in lane order, the highest active lane is written last.
+	template<typename T, int Width>
+	VCL_STRONG_INLINE void scatter(const VectorScalar<T, Width>& value, T* base, const VectorScalar<int, Width>& vindex, const VectorScalar<bool, Width>& mask)
+	{
+		for (int i = 0; i < Width; i++)
+		{
+			if (mask[i])
+				base[vindex[i]] = value[i];
+		}
+	}
+
+	namespace Core { namespace Simd { namespace Details {
+		//! Register type and number of registers of a vector
+		template<typename T, int Width>
+		struct VectorRegisters
+		{
+			using type = decltype(std::declval<const VectorScalar<T, Width>&>().get(0));
+			static const int count = Width * static_cast<int>(sizeof(T)) / static_cast<int>(sizeof(type));
+		};
+
+		template<typename T, int Width, typename Storage, size_t... Is>
+		VCL_STRONG_INLINE void load_storage(VectorScalar<T, Width>& value, const Storage* base, absl::index_sequence<Is...>)
+		{
+			using reg_t = typename VectorRegisters<T, Width>::type;
+			const int lanes = Width / VectorRegisters<T, Width>::count;
+
+			value = VectorScalar<T, Width>(widen(base + Is * lanes, static_cast<reg_t*>(nullptr))...);
+		}
+
+		template<typename T, int Width, typename Storage>
+		VCL_STRONG_INLINE void load_storage(VectorScalar<T, Width>& value, const Storage* base, std::true_type)
+		{
+			alignas(64) T values[Width];
+			widen_n(values, base);
+			load(value, values);
+		}
+		template<typename T, int Width, typename Storage>
+		VCL_STRONG_INLINE void load_storage(VectorScalar<T, Width>& value, const Storage* base, std::false_type)
+		{
+			load_storage(value, base, absl::make_index_sequence<VectorRegisters<T, Width>::count>{});
+		}
+
+		template<typename T, int Width, typename Storage, size_t... Is>
+		VCL_STRONG_INLINE void store_storage(Storage* base, const VectorScalar<T, Width>& value, absl::index_sequence<Is...>)
+		{
+			const int lanes = Width / VectorRegisters<T, Width>::count;
+
+			const int expand[] = { (narrow(base + Is * lanes, value.get(Is)), 0)... };
+			(void)expand;
+		}
+
+		//! Offset to the first scalar of entry 'idx' and the distance between two scalars of the same entry
+		template<typename Scalar, int Rows, int Cols, int Stride, typename Alloc>
+		VCL_STRONG_INLINE size_t interleaved_offset(
+			const Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>& base,
+			size_t idx,
+			size_t& scalar_stride)
+		{
+			using array_t = Vcl::Core::InterleavedArray<Scalar, Rows, Cols, Stride, Alloc>;
+
+			if (array_t::Stride == Vcl::Core::DynamicStride)
+			{
+				scalar_stride = base.capacity();
+				return idx;
+			} else
+			{
+				scalar_stride = array_t::Stride;
+
+				const size_t entry = idx % array_t::Stride;
+				return (idx - entry) * Rows * Cols + entry;
+			}
+		}
+	}}}
+
+	//! Load 'Width' consecutive entries of a storage-only type and widen them
+	//! to the scalar type of the vector. Integers are sign or zero extended,
+	//! half-precision values are converted to single precision.
+	template<typename T, int Width, typename Storage>
+	VCL_STRONG_INLINE std::enable_if_t<Core::Simd::IsStorageOf<Storage, T>::value> load(VectorScalar<T, Width>& value, const Storage* base)
+	{
+		VclRequire(base, "Load memory location is not null");
+
+		// The reference implementation stores a scalar per register
+		using registers_t = Core::Simd::Details::VectorRegisters<T, Width>;
+		Core::Simd::Details::load_storage(value, base, std::integral_constant<bool, registers_t::count == Width>{});
+	}
+
+	//! Narrow the entries of 'value' to a storage-only type and store them to
+	//! 'Width' consecutive entries. Integers saturate to the range of the storage
+	//! type, floating point values are rounded to nearest, ties to even.
+	template<typename T, int Width, typename Storage>
+	VCL_STRONG_INLINE std::enable_if_t<Core::Simd::IsStorageOf<Storage, T>::value> store(Storage* base, const VectorScalar<T, Width>& value)
+	{
+		VclRequire(base, "Store memory location is not null");
+
+		using registers_t = Core::Simd::Details::VectorRegisters<T, Width>;
+		Core::Simd::Details::store_storage(base, value, absl::make_index_sequence<registers_t::count>{});
+	}
+
+	//! Load the first 'count' entries of a storage-only type, the remaining lanes are set to zero.
+	//! Memory beyond 'base + count' is never accessed.
+	template<typename T, int Width, typename Storage>
+	VCL_STRONG_INLINE std::enable_if_t<Core::Simd::IsStorageOf<Storage, T>::value> load_n(VectorScalar<T, Width>& value, const Storage* base, int count)
+	{
+		VclRequire(0 <= count && count <= Width, "Number of loaded entries is valid");
+
+		alignas(64) Storage buffer[Width] = {};
+		for (int i = 0; i < count; i++)
+			buffer[i] = base[i];
+
+		load(value, buffer);
+	}
+
+	//! Narrow and store the first 'count' lanes of 'value' to 'base'.
+	//! Memory beyond 'base + count' is never accessed.
+	template<typename T, int Width, typename Storage>
+	VCL_STRONG_INLINE std::enable_if_t<Core::Simd::IsStorageOf<Storage, T>::value> store_n(Storage* base, const VectorScalar<T, Width>& value, int count)
+	{
+		VclRequire(0 <= count && count <= Width, "Number of stored entries is valid");
+
+		alignas(64) Storage buffer[Width];
+		store(buffer, value);
+		for (int i = 0; i < count; i++)
+			base[i] = buffer[i];
+	}
+
+	//! Load the entries 'idx' to 'idx + Width - 1' of an interleaved array.
+	//! The entries of a vector need to be consecutive in memory, thus the array
+	//! has either a dynamic stride or a stride which is a multiple of 'Width',
+	//! in which case 'idx' needs to be a multiple of 'Width'.
+	//! Storage-only scalar types are widened to the scalar type of the vector.
+	template<typename T, int Width, typename Storage, int Rows, int Cols, int Stride, typename Alloc>
+	VCL_STRONG_INLINE std::enable_if_t<std::is_same<Storage, T>::value || Core::Simd::IsStorageOf<Storage, T>::value> load(
+		Eigen::Matrix<VectorScalar<T, Width>, Rows, Cols>& loaded,
+		const Vcl::Core::InterleavedArray<Storage, Rows, Cols, Stride, Alloc>& base,
+		size_t idx)
+	{
+		using array_t = Vcl::Core::InterleavedArray<Storage, Rows, Cols, Stride, Alloc>;
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+		static_assert(array_t::Stride == Vcl::Core::DynamicStride || array_t::Stride % Width == 0, "Entries of a vector are consecutive in memory.");
+
+		VclRequire(array_t::Stride == Vcl::Core::DynamicStride || idx % Width == 0, "Entries of a vector are consecutive in memory.");
+		VclRequire(idx + Width <= base.capacity(), "Entries are allocated.");
+
+		size_t scalar_stride;
+		const Storage* data = base.data() + Core::Simd::Details::interleaved_offset(base, idx, scalar_stride);
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				load(loaded(r, c), data + (Rows * c + r) * scalar_stride);
+			}
+		}
+	}
+
+	//! Store 'value' to the entries 'idx' to 'idx + Width - 1' of an interleaved array.
+	//! The requirements on the layout are the same as for the corresponding 'load'.
+	//! Vectors are narrowed to storage-only scalar types of the array.
+	template<typename T, int Width, typename Storage, int Rows, int Cols, int Stride, typename Alloc>
+	VCL_STRONG_INLINE std::enable_if_t<std::is_same<Storage, T>::value || Core::Simd::IsStorageOf<Storage, T>::value> store(
+		Vcl::Core::InterleavedArray<Storage, Rows, Cols, Stride, Alloc>& base,
+		size_t idx,
+		const Eigen::Matrix<VectorScalar<T, Width>, Rows, Cols>& value)
+	{
+		using array_t = Vcl::Core::InterleavedArray<Storage, Rows, Cols, Stride, Alloc>;
+		static_assert(Rows != Vcl::Core::DynamicStride && Cols != Vcl::Core::DynamicStride, "Only fixed size matrices are supported.");
+		static_assert(array_t::Stride == Vcl::Core::DynamicStride || array_t::Stride % Width == 0, "Entries of a vector are consecutive in memory.");
+
+		VclRequire(array_t::Stride == Vcl::Core::DynamicStride || idx % Width == 0, "Entries of a vector are consecutive in memory.");
+		VclRequire(idx + Width <= base.capacity(), "Entries are allocated.");
+
+		size_t scalar_stride;
+		Storage* data = base.data() + Core::Simd::Details::interleaved_offset(base, idx, scalar_stride);
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				store(data + (Rows * c + r) * scalar_stride, value(r, c));
+			}
+		}
+	}
 }
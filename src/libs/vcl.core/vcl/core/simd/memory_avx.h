@@ -29,6 +29,7 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/simd/storage.h>
 
 #if defined(VCL_VECTORIZE_AVX)
 namespace Vcl {
@@ -98,6 +99,32 @@ namespace Vcl {
 	}
 #	endif
 
+#	ifdef VCL_VECTORIZE_AVX2
+	VCL_STRONG_INLINE VectorScalar<int, 4> gather(int const* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		return VectorScalar<int, 4>(_mm_i32gather_epi32(base, vindex.get(0), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<int, 8> gather(int const* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		return VectorScalar<int, 8>(_mm256_i32gather_epi32(base, vindex.get(0), 4));
+	}
+
+#		ifdef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE VectorScalar<int, 16> gather(int const* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		return VectorScalar<int, 16>(_mm512_i32gather_epi32(vindex.get(0), base, 4));
+	}
+#		else
+	VCL_STRONG_INLINE VectorScalar<int, 16> gather(int const* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		return VectorScalar<int, 16>(
+			_mm256_i32gather_epi32(base, vindex.get(0), 4),
+			_mm256_i32gather_epi32(base, vindex.get(1), 4));
+	}
+#		endif
+#	endif
+
 	VCL_STRONG_INLINE void load(float8& value, const float* base)
 	{
 		value = float8{ _mm256_loadu_ps(base) };
@@ -172,6 +199,521 @@ namespace Vcl {
 	}
 #	endif
 
+#	ifdef VCL_VECTORIZE_AVX2
+	VCL_STRONG_INLINE VectorScalar<double, 4> gather(double const* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		return VectorScalar<double, 4>(_mm256_i32gather_pd(base, vindex.get(0), 8));
+	}
+#	else
+	VCL_STRONG_INLINE VectorScalar<double, 4> gather(double const* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		const __m128i idx = vindex.get(0);
+		return VectorScalar<double, 4>(_mm256_set_pd(
+			base[_mmVCL_extract_epi32(idx, 3)],
+			base[_mmVCL_extract_epi32(idx, 2)],
+			base[_mmVCL_extract_epi32(idx, 1)],
+			base[_mmVCL_extract_epi32(idx, 0)]));
+	}
+#	endif
+
+#	ifdef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		return VectorScalar<double, 8>(_mm512_i32gather_pd(vindex.get(0), base, 8));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 16> gather(double const* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		const __m512i idx = vindex.get(0);
+		return VectorScalar<double, 16>(
+			_mm512_i32gather_pd(_mm512_castsi512_si256(idx), base, 8),
+			_mm512_i32gather_pd(_mm512_extracti64x4_epi64(idx, 1), base, 8));
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base) noexcept
+	{
+		value = double8{ _mm512_loadu_pd(base) };
+	}
+
+	VCL_STRONG_INLINE void load(double16& value, const double* base) noexcept
+	{
+		value = double16{
+			_mm512_loadu_pd(base + 0),
+			_mm512_loadu_pd(base + 8)
+		};
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double8& value) noexcept
+	{
+		_mm512_storeu_pd(base, value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double16& value) noexcept
+	{
+		_mm512_storeu_pd(base + 0, value.get(0));
+		_mm512_storeu_pd(base + 8, value.get(1));
+	}
+#	else
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		const __m256i idx = vindex.get(0);
+		return VectorScalar<double, 8>(
+			gather(base, VectorScalar<int, 4>(_mm256_castsi256_si128(idx))).get(0),
+			gather(base, VectorScalar<int, 4>(_mm256_extractf128_si256(idx, 1))).get(0));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 16> gather(double const* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		const VectorScalar<double, 8> lo = gather(base, VectorScalar<int, 8>(vindex.get(0)));
+		const VectorScalar<double, 8> hi = gather(base, VectorScalar<int, 8>(vindex.get(1)));
+		return VectorScalar<double, 16>(lo.get(0), lo.get(1), hi.get(0), hi.get(1));
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base) noexcept
+	{
+		value = double8{
+			_mm256_loadu_pd(base + 0),
+			_mm256_loadu_pd(base + 4)
+		};
+	}
+
+	VCL_STRONG_INLINE void load(double16& value, const double* base) noexcept
+	{
+		value = double16{
+			_mm256_loadu_pd(base + 0),
+			_mm256_loadu_pd(base + 4),
+			_mm256_loadu_pd(base + 8),
+			_mm256_loadu_pd(base + 12)
+		};
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double8& value) noexcept
+	{
+		_mm256_storeu_pd(base + 0, value.get(0));
+		_mm256_storeu_pd(base + 4, value.get(1));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double16& value) noexcept
+	{
+		_mm256_storeu_pd(base + 0, value.get(0));
+		_mm256_storeu_pd(base + 4, value.get(1));
+		_mm256_storeu_pd(base + 8, value.get(2));
+		_mm256_storeu_pd(base + 12, value.get(3));
+	}
+#	endif
+
+	VCL_STRONG_INLINE void load(double4& value, const double* base) noexcept
+	{
+		value = double4{ _mm256_loadu_pd(base) };
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double4& value) noexcept
+	{
+		_mm256_storeu_pd(base, value.get(0));
+	}
+
+	// Masked loads and stores. Lanes not set in the mask are neither read nor written.
+	// AVX-512 merges into the destination using the mask registers directly,
+	// AVX uses 'vmaskmov' followed by a blend with the previous value.
+#	ifdef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE void load(float4& value, const float* base, const bool4& mask) noexcept
+	{
+		const __mmask8 k = _mm_movepi32_mask(_mm_castps_si128(mask.get(0)));
+		value = float4{ _mm_mask_loadu_ps(value.get(0), k, base) };
+	}
+
+	VCL_STRONG_INLINE void load(int4& value, const int* base, const bool4& mask) noexcept
+	{
+		const __mmask8 k = _mm_movepi32_mask(_mm_castps_si128(mask.get(0)));
+		value = int4{ _mm_mask_loadu_epi32(value.get(0), k, base) };
+	}
+
+	VCL_STRONG_INLINE void load(double4& value, const double* base, const bool4& mask) noexcept
+	{
+		const __mmask8 k = _mm_movepi32_mask(_mm_castps_si128(mask.get(0)));
+		value = double4{ _mm256_mask_loadu_pd(value.get(0), k, base) };
+	}
+
+	VCL_STRONG_INLINE void load(float8& value, const float* base, const bool8& mask) noexcept
+	{
+		value = float8{ _mm256_mask_loadu_ps(value.get(0), _mm512VCL_ps_to_mask(mask.get(0)), base) };
+	}
+
+	VCL_STRONG_INLINE void load(int8& value, const int* base, const bool8& mask) noexcept
+	{
+		value = int8{ _mm256_mask_loadu_epi32(value.get(0), _mm512VCL_ps_to_mask(mask.get(0)), base) };
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base, const bool8& mask) noexcept
+	{
+		value = double8{ _mm512_mask_loadu_pd(value.get(0), _mm512VCL_ps_to_mask(mask.get(0)), base) };
+	}
+
+	VCL_STRONG_INLINE void load(float16& value, const float* base, const bool16& mask) noexcept
+	{
+		value = float16{ _mm512_mask_loadu_ps(value.get(0), mask.get(0), base) };
+	}
+
+	VCL_STRONG_INLINE void load(int16& value, const int* base, const bool16& mask) noexcept
+	{
+		value = int16{ _mm512_mask_loadu_epi32(value.get(0), mask.get(0), base) };
+	}
+
+	VCL_STRONG_INLINE void load(double16& value, const double* base, const bool16& mask) noexcept
+	{
+		const unsigned int k = _cvtmask16_u32(mask.get(0));
+		value = double16{
+			_mm512_mask_loadu_pd(value.get(0), static_cast<__mmask8>(k & 0xff), base + 0),
+			_mm512_mask_loadu_pd(value.get(1), static_cast<__mmask8>(k >> 8), base + 8)
+		};
+	}
+
+	VCL_STRONG_INLINE void store(float* base, const float4& value, const bool4& mask) noexcept
+	{
+		_mm_mask_storeu_ps(base, _mm_movepi32_mask(_mm_castps_si128(mask.get(0))), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(int* base, const int4& value, const bool4& mask) noexcept
+	{
+		_mm_mask_storeu_epi32(base, _mm_movepi32_mask(_mm_castps_si128(mask.get(0))), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double4& value, const bool4& mask) noexcept
+	{
+		_mm256_mask_storeu_pd(base, _mm_movepi32_mask(_mm_castps_si128(mask.get(0))), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(float* base, const float8& value, const bool8& mask) noexcept
+	{
+		_mm256_mask_storeu_ps(base, _mm512VCL_ps_to_mask(mask.get(0)), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(int* base, const int8& value, const bool8& mask) noexcept
+	{
+		_mm256_mask_storeu_epi32(base, _mm512VCL_ps_to_mask(mask.get(0)), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double8& value, const bool8& mask) noexcept
+	{
+		_mm512_mask_storeu_pd(base, _mm512VCL_ps_to_mask(mask.get(0)), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(float* base, const float16& value, const bool16& mask) noexcept
+	{
+		_mm512_mask_storeu_ps(base, mask.get(0), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(int* base, const int16& value, const bool16& mask) noexcept
+	{
+		_mm512_mask_storeu_epi32(base, mask.get(0), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double16& value, const bool16& mask) noexcept
+	{
+		const unsigned int k = _cvtmask16_u32(mask.get(0));
+		_mm512_mask_storeu_pd(base + 0, static_cast<__mmask8>(k & 0xff), value.get(0));
+		_mm512_mask_storeu_pd(base + 8, static_cast<__mmask8>(k >> 8), value.get(1));
+	}
+#	else
+	VCL_STRONG_INLINE void load(float4& value, const float* base, const bool4& mask) noexcept
+	{
+		value = float4{ _mmVCL_maskload_ps(base, value.get(0), mask.get(0)) };
+	}
+
+	VCL_STRONG_INLINE void load(int4& value, const int* base, const bool4& mask) noexcept
+	{
+		value = int4{ _mmVCL_maskload_epi32(base, value.get(0), mask.get(0)) };
+	}
+
+	VCL_STRONG_INLINE void load(double4& value, const double* base, const bool4& mask) noexcept
+	{
+		value = double4{ _mmVCL_maskload_pd(base, value.get(0), mask.get(0)) };
+	}
+
+	VCL_STRONG_INLINE void load(float8& value, const float* base, const bool8& mask) noexcept
+	{
+		value = float8{ _mmVCL_maskload_ps(base, value.get(0), mask.get(0)) };
+	}
+
+	VCL_STRONG_INLINE void load(int8& value, const int* base, const bool8& mask) noexcept
+	{
+		value = int8{ _mmVCL_maskload_epi32(base, value.get(0), mask.get(0)) };
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base, const bool8& mask) noexcept
+	{
+		const __m256 m = mask.get(0);
+		value = double8{
+			_mmVCL_maskload_pd(base + 0, value.get(0), _mm256_castps256_ps128(m)),
+			_mmVCL_maskload_pd(base + 4, value.get(1), _mm256_extractf128_ps(m, 1))
+		};
+	}
+
+	VCL_STRONG_INLINE void load(float16& value, const float* base, const bool16& mask) noexcept
+	{
+		value = float16{
+			_mmVCL_maskload_ps(base + 0, value.get(0), mask.get(0)),
+			_mmVCL_maskload_ps(base + 8, value.get(1), mask.get(1))
+		};
+	}
+
+	VCL_STRONG_INLINE void load(int16& value, const int* base, const bool16& mask) noexcept
+	{
+		value = int16{
+			_mmVCL_maskload_epi32(base + 0, value.get(0), mask.get(0)),
+			_mmVCL_maskload_epi32(base + 8, value.get(1), mask.get(1))
+		};
+	}
+
+	VCL_STRONG_INLINE void load(double16& value, const double* base, const bool16& mask) noexcept
+	{
+		const __m256 m0 = mask.get(0);
+		const __m256 m1 = mask.get(1);
+		value = double16{
+			_mmVCL_maskload_pd(base + 0, value.get(0), _mm256_castps256_ps128(m0)),
+			_mmVCL_maskload_pd(base + 4, value.get(1), _mm256_extractf128_ps(m0, 1)),
+			_mmVCL_maskload_pd(base + 8, value.get(2), _mm256_castps256_ps128(m1)),
+			_mmVCL_maskload_pd(base + 12, value.get(3), _mm256_extractf128_ps(m1, 1))
+		};
+	}
+
+	VCL_STRONG_INLINE void store(float* base, const float4& value, const bool4& mask) noexcept
+	{
+		_mm_maskstore_ps(base, _mm_castps_si128(mask.get(0)), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(int* base, const int4& value, const bool4& mask) noexcept
+	{
+		_mm_maskstore_ps(reinterpret_cast<float*>(base), _mm_castps_si128(mask.get(0)), _mm_castsi128_ps(value.get(0)));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double4& value, const bool4& mask) noexcept
+	{
+		_mm256_maskstore_pd(base, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(mask.get(0))), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(float* base, const float8& value, const bool8& mask) noexcept
+	{
+		_mm256_maskstore_ps(base, _mm256_castps_si256(mask.get(0)), value.get(0));
+	}
+
+	VCL_STRONG_INLINE void store(int* base, const int8& value, const bool8& mask) noexcept
+	{
+		_mm256_maskstore_ps(reinterpret_cast<float*>(base), _mm256_castps_si256(mask.get(0)), _mm256_castsi256_ps(value.get(0)));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double8& value, const bool8& mask) noexcept
+	{
+		const __m256 m = mask.get(0);
+		_mm256_maskstore_pd(base + 0, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(_mm256_castps256_ps128(m))), value.get(0));
+		_mm256_maskstore_pd(base + 4, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(_mm256_extractf128_ps(m, 1))), value.get(1));
+	}
+
+	VCL_STRONG_INLINE void store(float* base, const float16& value, const bool16& mask) noexcept
+	{
+		_mm256_maskstore_ps(base + 0, _mm256_castps_si256(mask.get(0)), value.get(0));
+		_mm256_maskstore_ps(base + 8, _mm256_castps_si256(mask.get(1)), value.get(1));
+	}
+
+	VCL_STRONG_INLINE void store(int* base, const int16& value, const bool16& mask) noexcept
+	{
+		float* p = reinterpret_cast<float*>(base);
+		_mm256_maskstore_ps(p + 0, _mm256_castps_si256(mask.get(0)), _mm256_castsi256_ps(value.get(0)));
+		_mm256_maskstore_ps(p + 8, _mm256_castps_si256(mask.get(1)), _mm256_castsi256_ps(value.get(1)));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double16& value, const bool16& mask) noexcept
+	{
+		const __m256 m0 = mask.get(0);
+		const __m256 m1 = mask.get(1);
+		_mm256_maskstore_pd(base + 0, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(_mm256_castps256_ps128(m0))), value.get(0));
+		_mm256_maskstore_pd(base + 4, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(_mm256_extractf128_ps(m0, 1))), value.get(1));
+		_mm256_maskstore_pd(base + 8, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(_mm256_castps256_ps128(m1))), value.get(2));
+		_mm256_maskstore_pd(base + 12, _mm256_castpd_si256(_mm256VCL_unpack_mask_pd(_mm256_extractf128_ps(m1, 1))), value.get(3));
+	}
+#	endif
+
+	// Masked gathers and scatters. Lanes not set in the mask are zero and their indices
+	// are never dereferenced. Scatters are only supported natively by AVX-512.
+#	ifdef VCL_VECTORIZE_AVX2
+	VCL_STRONG_INLINE VectorScalar<float, 4> gather(float const* base, const VectorScalar<int, 4>& vindex, const bool4& mask) noexcept
+	{
+		return VectorScalar<float, 4>(_mm_mask_i32gather_ps(_mm_setzero_ps(), base, vindex.get(0), mask.get(0), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<int, 4> gather(int const* base, const VectorScalar<int, 4>& vindex, const bool4& mask) noexcept
+	{
+		return VectorScalar<int, 4>(_mm_mask_i32gather_epi32(_mm_setzero_si128(), base, vindex.get(0), _mm_castps_si128(mask.get(0)), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> gather(double const* base, const VectorScalar<int, 4>& vindex, const bool4& mask) noexcept
+	{
+		return VectorScalar<double, 4>(_mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, vindex.get(0), _mm256VCL_unpack_mask_pd(mask.get(0)), 8));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 8> gather(float const* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		return VectorScalar<float, 8>(_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, vindex.get(0), mask.get(0), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<int, 8> gather(int const* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		return VectorScalar<int, 8>(_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, vindex.get(0), _mm256_castps_si256(mask.get(0)), 4));
+	}
+#	endif
+
+#	ifdef VCL_VECTORIZE_AVX512
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		return VectorScalar<double, 8>(_mm512_mask_i32gather_pd(_mm512_setzero_pd(), _mm512VCL_ps_to_mask(mask.get(0)), vindex.get(0), base, 8));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 16> gather(float const* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		return VectorScalar<float, 16>(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask.get(0), vindex.get(0), base, 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<int, 16> gather(int const* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		return VectorScalar<int, 16>(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.get(0), vindex.get(0), base, 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 16> gather(double const* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		const __m512i idx = vindex.get(0);
+		const unsigned int k = _cvtmask16_u32(mask.get(0));
+		return VectorScalar<double, 16>(
+			_mm512_mask_i32gather_pd(_mm512_setzero_pd(), static_cast<__mmask8>(k & 0xff), _mm512_castsi512_si256(idx), base, 8),
+			_mm512_mask_i32gather_pd(_mm512_setzero_pd(), static_cast<__mmask8>(k >> 8), _mm512_extracti64x4_epi64(idx, 1), base, 8));
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 4>& value, float* base, const VectorScalar<int, 4>& vindex, const bool4& mask) noexcept
+	{
+		_mm_mask_i32scatter_ps(base, _mm_movepi32_mask(_mm_castps_si128(mask.get(0))), vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<int, 4>& value, int* base, const VectorScalar<int, 4>& vindex, const bool4& mask) noexcept
+	{
+		_mm_mask_i32scatter_epi32(base, _mm_movepi32_mask(_mm_castps_si128(mask.get(0))), vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 4>& value, double* base, const VectorScalar<int, 4>& vindex, const bool4& mask) noexcept
+	{
+		_mm256_mask_i32scatter_pd(base, _mm_movepi32_mask(_mm_castps_si128(mask.get(0))), vindex.get(0), value.get(0), 8);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 8>& value, float* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		_mm256_mask_i32scatter_ps(base, _mm512VCL_ps_to_mask(mask.get(0)), vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<int, 8>& value, int* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		_mm256_mask_i32scatter_epi32(base, _mm512VCL_ps_to_mask(mask.get(0)), vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 8>& value, double* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		_mm512_mask_i32scatter_pd(base, _mm512VCL_ps_to_mask(mask.get(0)), vindex.get(0), value.get(0), 8);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 16>& value, float* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		_mm512_mask_i32scatter_ps(base, mask.get(0), vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<int, 16>& value, int* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		_mm512_mask_i32scatter_epi32(base, mask.get(0), vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 16>& value, double* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		const __m512i idx = vindex.get(0);
+		const unsigned int k = _cvtmask16_u32(mask.get(0));
+		_mm512_mask_i32scatter_pd(base, static_cast<__mmask8>(k & 0xff), _mm512_castsi512_si256(idx), value.get(0), 8);
+		_mm512_mask_i32scatter_pd(base, static_cast<__mmask8>(k >> 8), _mm512_extracti64x4_epi64(idx, 1), value.get(1), 8);
+	}
+
+	// Scatters with overlapping indices are written in lane order, such that the highest lane wins
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 4>& value, float* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		_mm_i32scatter_ps(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<int, 4>& value, int* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		_mm_i32scatter_epi32(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 4>& value, double* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		_mm256_i32scatter_pd(base, vindex.get(0), value.get(0), 8);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 8>& value, float* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		_mm256_i32scatter_ps(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<int, 8>& value, int* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		_mm256_i32scatter_epi32(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 8>& value, double* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		_mm512_i32scatter_pd(base, vindex.get(0), value.get(0), 8);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<float, 16>& value, float* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		_mm512_i32scatter_ps(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<int, 16>& value, int* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		_mm512_i32scatter_epi32(base, vindex.get(0), value.get(0), 4);
+	}
+
+	VCL_STRONG_INLINE void scatter(const VectorScalar<double, 16>& value, double* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		const __m512i idx = vindex.get(0);
+		_mm512_i32scatter_pd(base, _mm512_castsi512_si256(idx), value.get(0), 8);
+		_mm512_i32scatter_pd(base, _mm512_extracti64x4_epi64(idx, 1), value.get(1), 8);
+	}
+#	elif defined VCL_VECTORIZE_AVX2
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const* base, const VectorScalar<int, 8>& vindex, const bool8& mask) noexcept
+	{
+		const __m256i idx = vindex.get(0);
+		const __m256 m = mask.get(0);
+		return VectorScalar<double, 8>(
+			gather(base, VectorScalar<int, 4>(_mm256_castsi256_si128(idx)), bool4(_mm256_castps256_ps128(m))).get(0),
+			gather(base, VectorScalar<int, 4>(_mm256_extractf128_si256(idx, 1)), bool4(_mm256_extractf128_ps(m, 1))).get(0));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<float, 16> gather(float const* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		return VectorScalar<float, 16>(
+			_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, vindex.get(0), mask.get(0), 4),
+			_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, vindex.get(1), mask.get(1), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<int, 16> gather(int const* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		return VectorScalar<int, 16>(
+			_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, vindex.get(0), _mm256_castps_si256(mask.get(0)), 4),
+			_mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, vindex.get(1), _mm256_castps_si256(mask.get(1)), 4));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 16> gather(double const* base, const VectorScalar<int, 16>& vindex, const bool16& mask) noexcept
+	{
+		const VectorScalar<double, 8> lo = gather(base, VectorScalar<int, 8>(vindex.get(0)), bool8(mask.get(0)));
+		const VectorScalar<double, 8> hi = gather(base, VectorScalar<int, 8>(vindex.get(1)), bool8(mask.get(1)));
+		return VectorScalar<double, 16>(lo.get(0), lo.get(1), hi.get(0), hi.get(1));
+	}
+#	endif
+
 #	ifdef VCL_VECTORIZE_AVX512
 	VCL_STRONG_INLINE void load(
 		__m512& x,
@@ -956,5 +1498,147 @@ namespace Vcl {
 		return { l, h };
 	}
 #	endif
+
+	namespace Core { namespace Simd { namespace Details {
+#	ifdef VCL_VECTORIZE_AVX2
+		VCL_STRONG_INLINE __m256i widen(const int8_t* base, __m256i*) noexcept
+		{
+			return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(base)));
+		}
+		VCL_STRONG_INLINE __m256i widen(const uint8_t* base, __m256i*) noexcept
+		{
+			return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(base)));
+		}
+		VCL_STRONG_INLINE __m256i widen(const int16_t* base, __m256i*) noexcept
+		{
+			return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base)));
+		}
+		VCL_STRONG_INLINE __m256i widen(const uint16_t* base, __m256i*) noexcept
+		{
+			return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base)));
+		}
+#	else
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE __m256i widen(const Storage* base, __m256i*) noexcept
+		{
+			const __m128i lo = widen(base + 0, static_cast<__m128i*>(nullptr));
+			const __m128i hi = widen(base + 4, static_cast<__m128i*>(nullptr));
+			return _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+		}
+#	endif
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE __m256 widen(const Storage* base, __m256*) noexcept
+		{
+			return _mm256_cvtepi32_ps(widen(base, static_cast<__m256i*>(nullptr)));
+		}
+		VCL_STRONG_INLINE __m256 widen(const half* base, __m256*) noexcept
+		{
+#	ifdef VCL_VECTORIZE_F16C
+			return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base)));
+#	else
+			alignas(32) float values[8];
+			widen_n(values, base);
+			return _mm256_load_ps(values);
+#	endif
+		}
+
+		VCL_STRONG_INLINE void narrow(int8_t* base, __m256i value) noexcept
+		{
+			const __m128i v16 = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extractf128_si256(value, 1));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(base), _mm_packs_epi16(v16, v16));
+		}
+		VCL_STRONG_INLINE void narrow(uint8_t* base, __m256i value) noexcept
+		{
+			const __m128i v16 = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extractf128_si256(value, 1));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(base), _mm_packus_epi16(v16, v16));
+		}
+		VCL_STRONG_INLINE void narrow(int16_t* base, __m256i value) noexcept
+		{
+			const __m128i v16 = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extractf128_si256(value, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(base), v16);
+		}
+		VCL_STRONG_INLINE void narrow(uint16_t* base, __m256i value) noexcept
+		{
+			const __m128i v16 = _mm_packus_epi32(_mm256_castsi256_si128(value), _mm256_extractf128_si256(value, 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(base), v16);
+		}
+		template<typename Storage>
+		VCL_STRONG_INLINE std::enable_if_t<IsIntegerStorage<Storage>::value> narrow(Storage* base, __m256 value) noexcept
+		{
+			// Saturate before the conversion, out of range values would map to the lowest integer
+			const __m256 lo = _mm256_set1_ps(static_cast<float>(std::numeric_limits<Storage>::lowest()));
+			const __m256 hi = _mm256_set1_ps(static_cast<float>(std::numeric_limits<Storage>::max()));
+			narrow(base, _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(value, lo), hi)));
+		}
+		VCL_STRONG_INLINE void narrow(half* base, __m256 value) noexcept
+		{
+#	ifdef VCL_VECTORIZE_F16C
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(base), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+#	else
+			alignas(32) float values[8];
+			_mm256_store_ps(values, value);
+			narrow_n(base, values);
+#	endif
+		}
+
+#	ifdef VCL_VECTORIZE_AVX512
+		VCL_STRONG_INLINE __m512i widen(const int8_t* base, __m512i*) noexcept
+		{
+			return _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base)));
+		}
+		VCL_STRONG_INLINE __m512i widen(const uint8_t* base, __m512i*) noexcept
+		{
+			return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base)));
+		}
+		VCL_STRONG_INLINE __m512i widen(const int16_t* base, __m512i*) noexcept
+		{
+			return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(base)));
+		}
+		VCL_STRONG_INLINE __m512i widen(const uint16_t* base, __m512i*) noexcept
+		{
+			return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(base)));
+		}
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE __m512 widen(const Storage* base, __m512*) noexcept
+		{
+			return _mm512_cvtepi32_ps(widen(base, static_cast<__m512i*>(nullptr)));
+		}
+		VCL_STRONG_INLINE __m512 widen(const half* base, __m512*) noexcept
+		{
+			return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(base)));
+		}
+
+		VCL_STRONG_INLINE void narrow(int8_t* base, __m512i value) noexcept
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(base), _mm512_cvtsepi32_epi8(value));
+		}
+		VCL_STRONG_INLINE void narrow(uint8_t* base, __m512i value) noexcept
+		{
+			// The unsigned saturation interprets the input as unsigned, clamp negative values first
+			const __m512i clamped = _mm512_max_epi32(value, _mm512_setzero_si512());
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(base), _mm512_cvtusepi32_epi8(clamped));
+		}
+		VCL_STRONG_INLINE void narrow(int16_t* base, __m512i value) noexcept
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(base), _mm512_cvtsepi32_epi16(value));
+		}
+		VCL_STRONG_INLINE void narrow(uint16_t* base, __m512i value) noexcept
+		{
+			const __m512i clamped = _mm512_max_epi32(value, _mm512_setzero_si512());
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(base), _mm512_cvtusepi32_epi16(clamped));
+		}
+		template<typename Storage>
+		VCL_STRONG_INLINE std::enable_if_t<IsIntegerStorage<Storage>::value> narrow(Storage* base, __m512 value) noexcept
+		{
+			const __m512 lo = _mm512_set1_ps(static_cast<float>(std::numeric_limits<Storage>::lowest()));
+			const __m512 hi = _mm512_set1_ps(static_cast<float>(std::numeric_limits<Storage>::max()));
+			narrow(base, _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(value, lo), hi)));
+		}
+		VCL_STRONG_INLINE void narrow(half* base, __m512 value) noexcept
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(base), _mm512_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+		}
+#	endif // VCL_VECTORIZE_AVX512
+	}}}
 }
 #endif // VCL_VECTORIZE_AVX
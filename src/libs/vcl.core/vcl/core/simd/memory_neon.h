@@ -30,6 +30,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_neon.h>
+#include <vcl/core/simd/storage.h>
 
 #if defined VCL_VECTORIZE_NEON
 namespace Vcl {
@@ -766,5 +767,84 @@ namespace Vcl {
 			vreinterpretq_f32_s32(value(2).get(3)),
 			vreinterpretq_f32_s32(value(3).get(3)));
 	}
+
+	namespace Core { namespace Simd { namespace Details {
+		VCL_STRONG_INLINE int32x4_t widen(const int8_t* base, int32x4_t*) noexcept
+		{
+			uint32_t packed;
+			memcpy(&packed, base, sizeof(packed));
+			const int8x8_t v = vreinterpret_s8_u32(vdup_n_u32(packed));
+			return vmovl_s16(vget_low_s16(vmovl_s8(v)));
+		}
+		VCL_STRONG_INLINE int32x4_t widen(const uint8_t* base, int32x4_t*) noexcept
+		{
+			uint32_t packed;
+			memcpy(&packed, base, sizeof(packed));
+			const uint8x8_t v = vreinterpret_u8_u32(vdup_n_u32(packed));
+			return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(v))));
+		}
+		VCL_STRONG_INLINE int32x4_t widen(const int16_t* base, int32x4_t*) noexcept
+		{
+			return vmovl_s16(vld1_s16(base));
+		}
+		VCL_STRONG_INLINE int32x4_t widen(const uint16_t* base, int32x4_t*) noexcept
+		{
+			return vreinterpretq_s32_u32(vmovl_u16(vld1_u16(base)));
+		}
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE float32x4_t widen(const Storage* base, float32x4_t*) noexcept
+		{
+			return vcvtq_f32_s32(widen(base, static_cast<int32x4_t*>(nullptr)));
+		}
+		VCL_STRONG_INLINE float32x4_t widen(const half* base, float32x4_t*) noexcept
+		{
+#	if defined(__ARM_FP) && (__ARM_FP & 2)
+			return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const uint16_t*>(base))));
+#	else
+			float values[4];
+			widen_n(values, base);
+			return vld1q_f32(values);
+#	endif
+		}
+
+		VCL_STRONG_INLINE void narrow(int8_t* base, int32x4_t value) noexcept
+		{
+			const int16x4_t v16 = vqmovn_s32(value);
+			const uint32_t packed = vget_lane_u32(vreinterpret_u32_s8(vqmovn_s16(vcombine_s16(v16, v16))), 0);
+			memcpy(base, &packed, sizeof(packed));
+		}
+		VCL_STRONG_INLINE void narrow(uint8_t* base, int32x4_t value) noexcept
+		{
+			const int16x4_t v16 = vqmovn_s32(value);
+			const uint32_t packed = vget_lane_u32(vreinterpret_u32_u8(vqmovun_s16(vcombine_s16(v16, v16))), 0);
+			memcpy(base, &packed, sizeof(packed));
+		}
+		VCL_STRONG_INLINE void narrow(int16_t* base, int32x4_t value) noexcept
+		{
+			vst1_s16(base, vqmovn_s32(value));
+		}
+		VCL_STRONG_INLINE void narrow(uint16_t* base, int32x4_t value) noexcept
+		{
+			vst1_u16(base, vqmovun_s32(value));
+		}
+		template<typename Storage>
+		VCL_STRONG_INLINE std::enable_if_t<IsIntegerStorage<Storage>::value> narrow(Storage* base, float32x4_t value) noexcept
+		{
+			// The vector conversions truncate, use the rounding of the reference implementation
+			float values[4];
+			vst1q_f32(values, value);
+			narrow_n(base, values);
+		}
+		VCL_STRONG_INLINE void narrow(half* base, float32x4_t value) noexcept
+		{
+#	if defined(__ARM_FP) && (__ARM_FP & 2)
+			vst1_u16(reinterpret_cast<uint16_t*>(base), vreinterpret_u16_f16(vcvt_f16_f32(value)));
+#	else
+			float values[4];
+			vst1q_f32(values, value);
+			narrow_n(base, values);
+#	endif
+		}
+	}}}
 }
 #endif // defined VCL_VECTORIZE_NEON
@@ -30,6 +30,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/simd/intrinsics_sse.h>
+#include <vcl/core/simd/storage.h>
 
 namespace Vcl {
 #if !defined VCL_VECTORIZE_AVX2
@@ -403,7 +404,86 @@ namespace Vcl {
 
 	VCL_STRONG_INLINE void store(int* base, const int16& value) noexcept
 	{
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(base), value.get(0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(base + 0), value.get(0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(base + 4), value.get(1));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(base + 8), value.get(2));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(base + 12), value.get(3));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 4> gather(double const* base, const VectorScalar<int, 4>& vindex) noexcept
+	{
+		const __m128i idx = vindex.get(0);
+		return VectorScalar<double, 4>(
+			_mm_set_pd(base[_mmVCL_extract_epi32(idx, 1)], base[_mmVCL_extract_epi32(idx, 0)]),
+			_mm_set_pd(base[_mmVCL_extract_epi32(idx, 3)], base[_mmVCL_extract_epi32(idx, 2)]));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 8> gather(double const* base, const VectorScalar<int, 8>& vindex) noexcept
+	{
+		const VectorScalar<double, 4> lo = gather(base, VectorScalar<int, 4>(vindex.get(0)));
+		const VectorScalar<double, 4> hi = gather(base, VectorScalar<int, 4>(vindex.get(1)));
+		return VectorScalar<double, 8>(lo.get(0), lo.get(1), hi.get(0), hi.get(1));
+	}
+
+	VCL_STRONG_INLINE VectorScalar<double, 16> gather(double const* base, const VectorScalar<int, 16>& vindex) noexcept
+	{
+		const VectorScalar<double, 4> d0 = gather(base, VectorScalar<int, 4>(vindex.get(0)));
+		const VectorScalar<double, 4> d1 = gather(base, VectorScalar<int, 4>(vindex.get(1)));
+		const VectorScalar<double, 4> d2 = gather(base, VectorScalar<int, 4>(vindex.get(2)));
+		const VectorScalar<double, 4> d3 = gather(base, VectorScalar<int, 4>(vindex.get(3)));
+		return VectorScalar<double, 16>(
+			d0.get(0), d0.get(1), d1.get(0), d1.get(1),
+			d2.get(0), d2.get(1), d3.get(0), d3.get(1));
+	}
+
+	VCL_STRONG_INLINE void load(double4& value, const double* base) noexcept
+	{
+		value = double4{
+			_mm_loadu_pd(base + 0),
+			_mm_loadu_pd(base + 2)
+		};
+	}
+
+	VCL_STRONG_INLINE void load(double8& value, const double* base) noexcept
+	{
+		value = double8{
+			_mm_loadu_pd(base + 0),
+			_mm_loadu_pd(base + 2),
+			_mm_loadu_pd(base + 4),
+			_mm_loadu_pd(base + 6)
+		};
+	}
+
+	VCL_STRONG_INLINE void load(double16& value, const double* base) noexcept
+	{
+		value = double16{
+			_mm_loadu_pd(base + 0),
+			_mm_loadu_pd(base + 2),
+			_mm_loadu_pd(base + 4),
+			_mm_loadu_pd(base + 6),
+			_mm_loadu_pd(base + 8),
+			_mm_loadu_pd(base + 10),
+			_mm_loadu_pd(base + 12),
+			_mm_loadu_pd(base + 14)
+		};
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double4& value) noexcept
+	{
+		for (int i = 0; i < 2; i++)
+			_mm_storeu_pd(base + 2 * i, value.get(i));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double8& value) noexcept
+	{
+		for (int i = 0; i < 4; i++)
+			_mm_storeu_pd(base + 2 * i, value.get(i));
+	}
+
+	VCL_STRONG_INLINE void store(double* base, const double16& value) noexcept
+	{
+		for (int i = 0; i < 8; i++)
+			_mm_storeu_pd(base + 2 * i, value.get(i));
 	}
 
 	VCL_STRONG_INLINE void load(
@@ -793,4 +873,111 @@ namespace Vcl {
 		return { low, high };
 	}
 #endif // defined VCL_VECTORIZE_SSE && !defined VCL_VECTORIZE_AVX
+
+#if defined VCL_VECTORIZE_SSE
+	namespace Core { namespace Simd { namespace Details {
+		VCL_STRONG_INLINE __m128i widen(const int8_t* base, __m128i*) noexcept
+		{
+			int32_t packed;
+			memcpy(&packed, base, sizeof(packed));
+			const __m128i v = _mm_cvtsi32_si128(packed);
+#	ifdef VCL_VECTORIZE_SSE4_1
+			return _mm_cvtepi8_epi32(v);
+#	else
+			const __m128i v16 = _mm_unpacklo_epi8(v, v);
+			return _mm_srai_epi32(_mm_unpacklo_epi16(v16, v16), 24);
+#	endif
+		}
+		VCL_STRONG_INLINE __m128i widen(const uint8_t* base, __m128i*) noexcept
+		{
+			int32_t packed;
+			memcpy(&packed, base, sizeof(packed));
+			const __m128i v = _mm_cvtsi32_si128(packed);
+#	ifdef VCL_VECTORIZE_SSE4_1
+			return _mm_cvtepu8_epi32(v);
+#	else
+			const __m128i zero = _mm_setzero_si128();
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, zero), zero);
+#	endif
+		}
+		VCL_STRONG_INLINE __m128i widen(const int16_t* base, __m128i*) noexcept
+		{
+			const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(base));
+#	ifdef VCL_VECTORIZE_SSE4_1
+			return _mm_cvtepi16_epi32(v);
+#	else
+			return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+#	endif
+		}
+		VCL_STRONG_INLINE __m128i widen(const uint16_t* base, __m128i*) noexcept
+		{
+			const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(base));
+#	ifdef VCL_VECTORIZE_SSE4_1
+			return _mm_cvtepu16_epi32(v);
+#	else
+			return _mm_unpacklo_epi16(v, _mm_setzero_si128());
+#	endif
+		}
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE __m128 widen(const Storage* base, __m128*) noexcept
+		{
+			return _mm_cvtepi32_ps(widen(base, static_cast<__m128i*>(nullptr)));
+		}
+		VCL_STRONG_INLINE __m128 widen(const half* base, __m128*) noexcept
+		{
+#	ifdef VCL_VECTORIZE_F16C
+			return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(base)));
+#	else
+			alignas(16) float values[4];
+			widen_n(values, base);
+			return _mm_load_ps(values);
+#	endif
+		}
+
+		VCL_STRONG_INLINE void narrow(int8_t* base, __m128i value) noexcept
+		{
+			const __m128i v16 = _mm_packs_epi32(value, value);
+			const int32_t packed = _mm_cvtsi128_si32(_mm_packs_epi16(v16, v16));
+			memcpy(base, &packed, sizeof(packed));
+		}
+		VCL_STRONG_INLINE void narrow(uint8_t* base, __m128i value) noexcept
+		{
+			const __m128i v16 = _mm_packs_epi32(value, value);
+			const int32_t packed = _mm_cvtsi128_si32(_mm_packus_epi16(v16, v16));
+			memcpy(base, &packed, sizeof(packed));
+		}
+		VCL_STRONG_INLINE void narrow(int16_t* base, __m128i value) noexcept
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(base), _mm_packs_epi32(value, value));
+		}
+		VCL_STRONG_INLINE void narrow(uint16_t* base, __m128i value) noexcept
+		{
+#	ifdef VCL_VECTORIZE_SSE4_1
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(base), _mm_packus_epi32(value, value));
+#	else
+			alignas(16) int values[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(values), value);
+			narrow_n(base, values);
+#	endif
+		}
+		template<typename Storage>
+		VCL_STRONG_INLINE std::enable_if_t<IsIntegerStorage<Storage>::value> narrow(Storage* base, __m128 value) noexcept
+		{
+			// Saturate before the conversion, out of range values would map to the lowest integer
+			const __m128 lo = _mm_set1_ps(static_cast<float>(std::numeric_limits<Storage>::lowest()));
+			const __m128 hi = _mm_set1_ps(static_cast<float>(std::numeric_limits<Storage>::max()));
+			narrow(base, _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(value, lo), hi)));
+		}
+		VCL_STRONG_INLINE void narrow(half* base, __m128 value) noexcept
+		{
+#	ifdef VCL_VECTORIZE_F16C
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(base), _mm_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+#	else
+			alignas(16) float values[4];
+			_mm_store_ps(values, value);
+			narrow_n(base, values);
+#	endif
+		}
+	}}}
+#endif // defined VCL_VECTORIZE_SSE
 }
@@ -0,0 +1,431 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <array>
+#include <limits>
+#include <ostream>
+
+// VCL
+#include <vcl/core/simd/vectorscalar.h>
+
+#if defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)
+#	include <immintrin.h>
+#endif
+
+namespace Vcl { namespace Core { namespace Simd {
+	/*!
+	 *	\brief Mask of a \ref Packet
+	 *
+	 *	Lanes are combined using the logical operators. In contrast to
+	 *	'VectorScalar<bool, Width>', the mask does not depend on the
+	 *	configured vectorization extension.
+	 */
+	template<typename Ops>
+	class PacketMask
+	{
+	public:
+		using Register = typename Ops::Mask;
+		static const int Width = Ops::Width;
+
+	public:
+		PacketMask() = default;
+		PacketMask(bool b) noexcept
+		: _m(Ops::mask_set(b)) {}
+		explicit PacketMask(Register m) noexcept
+		: _m(m) {}
+
+		VCL_STRONG_INLINE Register get() const noexcept { return _m; }
+
+		//! \returns a bit per lane, starting with the lowest bit for the first lane
+		VCL_STRONG_INLINE unsigned int bits() const noexcept { return Ops::mask_bits(_m); }
+
+	public:
+		VCL_STRONG_INLINE PacketMask& operator&=(const PacketMask& rhs) noexcept
+		{
+			_m = Ops::mask_and(_m, rhs._m);
+			return *this;
+		}
+		VCL_STRONG_INLINE PacketMask& operator|=(const PacketMask& rhs) noexcept
+		{
+			_m = Ops::mask_or(_m, rhs._m);
+			return *this;
+		}
+
+		friend VCL_STRONG_INLINE PacketMask operator&&(const PacketMask& a, const PacketMask& b) noexcept { return PacketMask(Ops::mask_and(a._m, b._m)); }
+		friend VCL_STRONG_INLINE PacketMask operator||(const PacketMask& a, const PacketMask& b) noexcept { return PacketMask(Ops::mask_or(a._m, b._m)); }
+		friend VCL_STRONG_INLINE PacketMask operator!(const PacketMask& a) noexcept { return PacketMask(Ops::mask_not(a._m)); }
+
+		friend VCL_STRONG_INLINE bool any(const PacketMask& a) noexcept { return a.bits() != 0; }
+		friend VCL_STRONG_INLINE bool all(const PacketMask& a) noexcept { return a.bits() == (1u << Width) - 1; }
+		friend VCL_STRONG_INLINE bool none(const PacketMask& a) noexcept { return a.bits() == 0; }
+
+	private:
+		Register _m;
+	};
+
+	/*!
+	 *	\brief Vector of single precision values using a fixed instruction set
+	 *
+	 *	'VectorScalar' is implemented for the extension the library is configured
+	 *	with. Kernels selected at runtime (see \ref Dispatcher) are compiled with
+	 *	different compiler flags, and thus cannot share its inline functions.
+	 *	The packet implements the same interface on top of an operation policy
+	 *	'Ops' instead. As every policy is only used in the translation units
+	 *	compiled for its instruction set, all instances of the generic algorithms
+	 *	using a packet are distinct from each other.
+	 */
+	template<typename Ops>
+	class Packet
+	{
+	public:
+		using Scalar = float;
+		using Register = typename Ops::Float;
+		using Mask = PacketMask<Ops>;
+		static const int Width = Ops::Width;
+
+	public:
+		Packet() = default;
+		Packet(float s) noexcept
+		: _v(Ops::set(s)) {}
+		explicit Packet(Register v) noexcept
+		: _v(v) {}
+
+		//! Load from aligned memory
+		static VCL_STRONG_INLINE Packet load(const float* ptr) noexcept { return Packet(Ops::load(ptr)); }
+
+		//! Store to aligned memory
+		VCL_STRONG_INLINE void store(float* ptr) const noexcept { Ops::store(ptr, _v); }
+
+		VCL_STRONG_INLINE Register get() const noexcept { return _v; }
+
+	public:
+		VCL_STRONG_INLINE Packet& operator+=(const Packet& rhs) noexcept
+		{
+			_v = Ops::add(_v, rhs._v);
+			return *this;
+		}
+		VCL_STRONG_INLINE Packet& operator-=(const Packet& rhs) noexcept
+		{
+			_v = Ops::sub(_v, rhs._v);
+			return *this;
+		}
+		VCL_STRONG_INLINE Packet& operator*=(const Packet& rhs) noexcept
+		{
+			_v = Ops::mul(_v, rhs._v);
+			return *this;
+		}
+		VCL_STRONG_INLINE Packet& operator/=(const Packet& rhs) noexcept
+		{
+			_v = Ops::div(_v, rhs._v);
+			return *this;
+		}
+
+		// Operations are found by argument dependent lookup and
+		// allow implicit conversions of literals.
+		friend VCL_STRONG_INLINE Packet operator+(const Packet& a, const Packet& b) noexcept { return Packet(Ops::add(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Packet operator-(const Packet& a, const Packet& b) noexcept { return Packet(Ops::sub(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Packet operator*(const Packet& a, const Packet& b) noexcept { return Packet(Ops::mul(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Packet operator/(const Packet& a, const Packet& b) noexcept { return Packet(Ops::div(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Packet operator-(const Packet& a) noexcept { return Packet(Ops::neg(a._v)); }
+
+		friend VCL_STRONG_INLINE Mask operator==(const Packet& a, const Packet& b) noexcept { return Mask(Ops::cmpeq(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Mask operator!=(const Packet& a, const Packet& b) noexcept { return Mask(Ops::cmpneq(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Mask operator<(const Packet& a, const Packet& b) noexcept { return Mask(Ops::cmplt(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Mask operator<=(const Packet& a, const Packet& b) noexcept { return Mask(Ops::cmple(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Mask operator>(const Packet& a, const Packet& b) noexcept { return Mask(Ops::cmplt(b._v, a._v)); }
+		friend VCL_STRONG_INLINE Mask operator>=(const Packet& a, const Packet& b) noexcept { return Mask(Ops::cmple(b._v, a._v)); }
+
+		friend VCL_STRONG_INLINE Packet abs(const Packet& a) noexcept { return Packet(Ops::abs(a._v)); }
+		friend VCL_STRONG_INLINE Packet sqrt(const Packet& a) noexcept { return Packet(Ops::sqrt(a._v)); }
+		friend VCL_STRONG_INLINE Packet rcp(const Packet& a) noexcept { return Packet(Ops::rcp(a._v)); }
+		friend VCL_STRONG_INLINE Packet rsqrt(const Packet& a) noexcept { return Packet(Ops::rsqrt(a._v)); }
+		friend VCL_STRONG_INLINE Packet min(const Packet& a, const Packet& b) noexcept { return Packet(Ops::min(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Packet max(const Packet& a, const Packet& b) noexcept { return Packet(Ops::max(a._v, b._v)); }
+		friend VCL_STRONG_INLINE Mask isinf(const Packet& a) noexcept { return Mask(Ops::cmpeq(Ops::abs(a._v), Ops::set(std::numeric_limits<float>::infinity()))); }
+
+		friend VCL_STRONG_INLINE Packet select(const Mask& mask, const Packet& a, const Packet& b) noexcept { return Packet(Ops::select(mask.get(), a._v, b._v)); }
+		friend VCL_STRONG_INLINE void cswap(const Mask& mask, Packet& a, Packet& b) noexcept
+		{
+			const Packet c = select(mask, b, a);
+			b = select(mask, a, b);
+			a = c;
+		}
+
+		friend std::ostream& operator<<(std::ostream& s, const Packet& rhs)
+		{
+			alignas(64) float vars[Width];
+			rhs.store(vars);
+
+			s << "'" << vars[0];
+			for (int i = 1; i < Width; i++)
+				s << ", " << vars[i];
+			s << "'";
+			return s;
+		}
+
+	private:
+		Register _v;
+	};
+
+	template<typename Ops, int Rows, int Cols>
+	VCL_STRONG_INLINE Eigen::Matrix<Packet<Ops>, Rows, Cols> select(
+		const PacketMask<Ops>& mask,
+		const Eigen::Matrix<Packet<Ops>, Rows, Cols>& a,
+		const Eigen::Matrix<Packet<Ops>, Rows, Cols>& b)
+	{
+		Eigen::Matrix<Packet<Ops>, Rows, Cols> selected;
+		for (int c = 0; c < Cols; c++)
+		{
+			for (int r = 0; r < Rows; r++)
+			{
+				selected(r, c) = select(mask, a(r, c), b(r, c));
+			}
+		}
+
+		return selected;
+	}
+
+	template<typename Ops, size_t N>
+	VCL_STRONG_INLINE std::array<Packet<Ops>, N> select(
+		const PacketMask<Ops>& mask,
+		const std::array<Packet<Ops>, N>& a,
+		const std::array<Packet<Ops>, N>& b)
+	{
+		std::array<Packet<Ops>, N> selected;
+
+		for (size_t i = 0; i < N; i++)
+			selected[i] = select(mask, a[i], b[i]);
+
+		return selected;
+	}
+
+	/*
+	 *	Operation policies per instruction set. A policy must only be used in
+	 *	translation units compiled for the respective instruction set.
+	 */
+#if defined(__SSE2__) || defined(VCL_ARCH_X64)
+	//! SSE2 operations. Selecting does not use 'blendv' from SSE4.1.
+	struct SseOps
+	{
+		using Float = __m128;
+		using Mask = __m128;
+		static const int Width = 4;
+
+		static VCL_STRONG_INLINE Float set(float s) { return _mm_set1_ps(s); }
+		static VCL_STRONG_INLINE Float load(const float* p) { return _mm_load_ps(p); }
+		static VCL_STRONG_INLINE void store(float* p, Float a) { _mm_store_ps(p, a); }
+
+		static VCL_STRONG_INLINE Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+		static VCL_STRONG_INLINE Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+		static VCL_STRONG_INLINE Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+		static VCL_STRONG_INLINE Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+		static VCL_STRONG_INLINE Float neg(Float a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+		static VCL_STRONG_INLINE Float abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		static VCL_STRONG_INLINE Float sqrt(Float a) { return _mm_sqrt_ps(a); }
+		static VCL_STRONG_INLINE Float min(Float a, Float b) { return _mm_min_ps(a, b); }
+		static VCL_STRONG_INLINE Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+
+		// Newton-Raphson step as in '_mmVCL_rsqrt_ps'
+		static VCL_STRONG_INLINE Float rsqrt(Float a)
+		{
+			const Float nr = _mm_rsqrt_ps(a);
+			const Float muls = _mm_mul_ps(_mm_mul_ps(nr, nr), a);
+			return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), nr), _mm_sub_ps(_mm_set1_ps(3.0f), muls));
+		}
+
+		// Newton-Raphson step as in '_mmVCL_rcp_ps'
+		static VCL_STRONG_INLINE Float rcp(Float a)
+		{
+			const Float nr = _mm_rcp_ps(a);
+			const Float muls = _mm_mul_ps(_mm_mul_ps(nr, nr), a);
+			const Float zero = _mm_cmpeq_ps(a, _mm_setzero_ps());
+			return _mm_sub_ps(_mm_add_ps(nr, nr), _mm_andnot_ps(zero, muls));
+		}
+
+		static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+		static VCL_STRONG_INLINE Mask cmpneq(Float a, Float b) { return _mm_cmpneq_ps(a, b); }
+		static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+		static VCL_STRONG_INLINE Mask cmple(Float a, Float b) { return _mm_cmple_ps(a, b); }
+		static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+		static VCL_STRONG_INLINE Mask mask_set(bool b) { return _mm_castsi128_ps(_mm_set1_epi32(b ? -1 : 0)); }
+		static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) { return _mm_and_ps(a, b); }
+		static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+		static VCL_STRONG_INLINE Mask mask_not(Mask a) { return _mm_xor_ps(a, mask_set(true)); }
+		static VCL_STRONG_INLINE unsigned int mask_bits(Mask a) { return static_cast<unsigned int>(_mm_movemask_ps(a)); }
+	};
+#endif
+
+#if defined(__AVX__)
+	//! AVX operations
+	struct AvxOps
+	{
+		using Float = __m256;
+		using Mask = __m256;
+		static const int Width = 8;
+
+		static VCL_STRONG_INLINE Float set(float s) { return _mm256_set1_ps(s); }
+		static VCL_STRONG_INLINE Float load(const float* p) { return _mm256_load_ps(p); }
+		static VCL_STRONG_INLINE void store(float* p, Float a) { _mm256_store_ps(p, a); }
+
+		static VCL_STRONG_INLINE Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+		static VCL_STRONG_INLINE Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+		static VCL_STRONG_INLINE Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+		static VCL_STRONG_INLINE Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+		static VCL_STRONG_INLINE Float neg(Float a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+		static VCL_STRONG_INLINE Float abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		static VCL_STRONG_INLINE Float sqrt(Float a) { return _mm256_sqrt_ps(a); }
+		static VCL_STRONG_INLINE Float min(Float a, Float b) { return _mm256_min_ps(a, b); }
+		static VCL_STRONG_INLINE Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+
+		static VCL_STRONG_INLINE Float rsqrt(Float a)
+		{
+			const Float nr = _mm256_rsqrt_ps(a);
+			const Float muls = _mm256_mul_ps(_mm256_mul_ps(nr, nr), a);
+			return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), nr), _mm256_sub_ps(_mm256_set1_ps(3.0f), muls));
+		}
+		static VCL_STRONG_INLINE Float rcp(Float a)
+		{
+			const Float nr = _mm256_rcp_ps(a);
+			const Float muls = _mm256_mul_ps(_mm256_mul_ps(nr, nr), a);
+			const Float zero = _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ);
+			return _mm256_sub_ps(_mm256_add_ps(nr, nr), _mm256_andnot_ps(zero, muls));
+		}
+
+		static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		static VCL_STRONG_INLINE Mask cmpneq(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+		static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static VCL_STRONG_INLINE Mask cmple(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) { return _mm256_blendv_ps(b, a, m); }
+
+		static VCL_STRONG_INLINE Mask mask_set(bool b) { return _mm256_castsi256_ps(_mm256_set1_epi32(b ? -1 : 0)); }
+		static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+		static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+		static VCL_STRONG_INLINE Mask mask_not(Mask a) { return _mm256_xor_ps(a, mask_set(true)); }
+		static VCL_STRONG_INLINE unsigned int mask_bits(Mask a) { return static_cast<unsigned int>(_mm256_movemask_ps(a)); }
+	};
+#endif
+
+#if defined(__AVX512F__)
+	//! AVX-512 operations, using mask registers
+	struct Avx512Ops
+	{
+		using Float = __m512;
+		using Mask = __mmask16;
+		static const int Width = 16;
+
+		static VCL_STRONG_INLINE Float set(float s) { return _mm512_set1_ps(s); }
+		static VCL_STRONG_INLINE Float load(const float* p) { return _mm512_load_ps(p); }
+		static VCL_STRONG_INLINE void store(float* p, Float a) { _mm512_store_ps(p, a); }
+
+		static VCL_STRONG_INLINE Float add(Float a, Float b) { return _mm512_add_ps(a, b); }
+		static VCL_STRONG_INLINE Float sub(Float a, Float b) { return _mm512_sub_ps(a, b); }
+		static VCL_STRONG_INLINE Float mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+		static VCL_STRONG_INLINE Float div(Float a, Float b) { return _mm512_div_ps(a, b); }
+		static VCL_STRONG_INLINE Float neg(Float a) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(int(0x80000000)))); }
+		static VCL_STRONG_INLINE Float abs(Float a) { return _mm512_abs_ps(a); }
+		static VCL_STRONG_INLINE Float sqrt(Float a) { return _mm512_sqrt_ps(a); }
+		static VCL_STRONG_INLINE Float min(Float a, Float b) { return _mm512_min_ps(a, b); }
+		static VCL_STRONG_INLINE Float max(Float a, Float b) { return _mm512_max_ps(a, b); }
+
+		static VCL_STRONG_INLINE Float rsqrt(Float a)
+		{
+			const Float nr = _mm512_rsqrt14_ps(a);
+			const Float muls = _mm512_mul_ps(_mm512_mul_ps(nr, nr), a);
+			return _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), nr), _mm512_sub_ps(_mm512_set1_ps(3.0f), muls));
+		}
+		static VCL_STRONG_INLINE Float rcp(Float a)
+		{
+			const Float nr = _mm512_rcp14_ps(a);
+			const Float muls = _mm512_mul_ps(_mm512_mul_ps(nr, nr), a);
+			const Mask zero = _mm512_cmp_ps_mask(a, _mm512_setzero_ps(), _CMP_EQ_OQ);
+			return _mm512_mask_sub_ps(_mm512_add_ps(nr, nr), static_cast<Mask>(~zero), _mm512_add_ps(nr, nr), muls);
+		}
+
+		static VCL_STRONG_INLINE Mask cmpeq(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+		static VCL_STRONG_INLINE Mask cmpneq(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+		static VCL_STRONG_INLINE Mask cmplt(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+		static VCL_STRONG_INLINE Mask cmple(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+		static VCL_STRONG_INLINE Float select(Mask m, Float a, Float b) { return _mm512_mask_blend_ps(m, b, a); }
+
+		static VCL_STRONG_INLINE Mask mask_set(bool b) { return b ? Mask(0xffff) : Mask(0); }
+		static VCL_STRONG_INLINE Mask mask_and(Mask a, Mask b) { return a & b; }
+		static VCL_STRONG_INLINE Mask mask_or(Mask a, Mask b) { return a | b; }
+		static VCL_STRONG_INLINE Mask mask_not(Mask a) { return static_cast<Mask>(~a); }
+		static VCL_STRONG_INLINE unsigned int mask_bits(Mask a) { return a; }
+	};
+#endif
+}}}
+
+namespace Vcl {
+	template<typename Ops>
+	struct VectorTypes<Core::Simd::Packet<Ops>>
+	{
+		using float_t = Core::Simd::Packet<Ops>;
+		//! Integer values are represented as floating point values
+		using int_t = Core::Simd::Packet<Ops>;
+		using bool_t = Core::Simd::PacketMask<Ops>;
+	};
+
+	template<typename Ops>
+	struct NumericTrait<Core::Simd::Packet<Ops>>
+	{
+		using base_t = float;
+		using wide_t = typename Ops::Float;
+	};
+}
+
+namespace Eigen {
+	template<typename Ops>
+	struct NumTraits<Vcl::Core::Simd::Packet<Ops>> : GenericNumTraits<Vcl::Core::Simd::Packet<Ops>>
+	{
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+
+		enum
+		{
+			IsInteger = 0,
+			IsSigned = 1,
+			IsComplex = 0,
+			RequireInitialization = 0,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static Packet epsilon() noexcept { return std::numeric_limits<float>::epsilon(); }
+		EIGEN_STRONG_INLINE static int digits10() { return GenericNumTraits<float>::digits10(); }
+		EIGEN_STRONG_INLINE static Packet dummy_precision() noexcept { return 1e-5f; }
+		EIGEN_STRONG_INLINE static Packet highest() noexcept { return std::numeric_limits<float>::max(); }
+		EIGEN_STRONG_INLINE static Packet lowest() noexcept { return std::numeric_limits<float>::lowest(); }
+		EIGEN_STRONG_INLINE static Packet infinity() noexcept { return std::numeric_limits<float>::infinity(); }
+		EIGEN_STRONG_INLINE static Packet quiet_NaN() noexcept { return std::numeric_limits<float>::quiet_NaN(); }
+	};
+}
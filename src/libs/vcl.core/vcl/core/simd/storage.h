@@ -0,0 +1,129 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// VCL
+#include <vcl/core/half.h>
+
+namespace Vcl { namespace Core { namespace Simd {
+	//! Storage-only types which are widened to 'int' when loaded
+	template<typename Storage>
+	struct IsIntegerStorage : std::integral_constant<
+		bool,
+		std::is_same<Storage, int8_t>::value || std::is_same<Storage, uint8_t>::value ||
+		std::is_same<Storage, int16_t>::value || std::is_same<Storage, uint16_t>::value>
+	{
+	};
+
+	//! Storage-only types which can be loaded into vectors of 'Scalar'.
+	//! Integer storage can be loaded into 'int' and 'float' vectors,
+	//! half-precision storage into 'float' vectors.
+	template<typename Storage, typename Scalar>
+	struct IsStorageOf : std::integral_constant<
+		bool,
+		(std::is_same<Scalar, int>::value && IsIntegerStorage<Storage>::value) ||
+		(std::is_same<Scalar, float>::value && (IsIntegerStorage<Storage>::value || std::is_same<Storage, half>::value))>
+	{
+	};
+
+	//! The conversions between storage types and registers are overloaded on
+	//! the register type, which is selected by passing a null pointer to it.
+	namespace Details {
+		//! Convert to the range of the integer storage type, saturating values out of range.
+		//! Floating point values are rounded to the nearest integer, ties to even. NaN maps
+		//! to the lowest value of the storage type.
+		template<typename Storage>
+		VCL_STRONG_INLINE Storage saturate(int v) noexcept
+		{
+			const int lo = std::numeric_limits<Storage>::lowest();
+			const int hi = std::numeric_limits<Storage>::max();
+			return static_cast<Storage>(v < lo ? lo : (v > hi ? hi : v));
+		}
+		template<typename Storage>
+		VCL_STRONG_INLINE Storage saturate(float v) noexcept
+		{
+			const float lo = std::numeric_limits<Storage>::lowest();
+			const float hi = std::numeric_limits<Storage>::max();
+			v = v > lo ? v : lo;
+			v = v < hi ? v : hi;
+			return static_cast<Storage>(std::nearbyint(v));
+		}
+
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE int widen(const Storage* base, int*) noexcept
+		{
+			return base[0];
+		}
+		template<typename Storage, typename = std::enable_if_t<IsIntegerStorage<Storage>::value>>
+		VCL_STRONG_INLINE float widen(const Storage* base, float*) noexcept
+		{
+			return base[0];
+		}
+		VCL_STRONG_INLINE float widen(const half* base, float*) noexcept
+		{
+			return static_cast<float>(base[0]);
+		}
+
+		template<typename Storage>
+		VCL_STRONG_INLINE std::enable_if_t<IsIntegerStorage<Storage>::value> narrow(Storage* base, int value) noexcept
+		{
+			base[0] = saturate<Storage>(value);
+		}
+		template<typename Storage>
+		VCL_STRONG_INLINE std::enable_if_t<IsIntegerStorage<Storage>::value> narrow(Storage* base, float value) noexcept
+		{
+			base[0] = saturate<Storage>(value);
+		}
+		VCL_STRONG_INLINE void narrow(half* base, float value) noexcept
+		{
+			base[0] = half(value);
+		}
+
+		//! Convert 'N' consecutive entries one by one.
+		//! Used by targets without a native conversion instruction.
+		template<typename Scalar, int N, typename Storage>
+		VCL_STRONG_INLINE void widen_n(Scalar (&values)[N], const Storage* base) noexcept
+		{
+			for (int i = 0; i < N; i++)
+				values[i] = widen(base + i, static_cast<Scalar*>(nullptr));
+		}
+		template<typename Scalar, int N, typename Storage>
+		VCL_STRONG_INLINE void narrow_n(Storage* base, const Scalar (&values)[N]) noexcept
+		{
+			for (int i = 0; i < N; i++)
+				narrow(base + i, values[i]);
+		}
+	}
+}}}
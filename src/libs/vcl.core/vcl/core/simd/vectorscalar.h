@@ -30,6 +30,7 @@
 
 // C++ Standard Library
 #include <array>
+#include <cmath>
 #include <initializer_list>
 
 // VCL
@@ -53,6 +54,9 @@ namespace Vcl {
 #if defined VCL_VECTORIZE_AVX512
 #	include <vcl/core/simd/bool8_avx.h>
 #	include <vcl/core/simd/bool16_avx512.h>
+#	include <vcl/core/simd/double4_avx.h>
+#	include <vcl/core/simd/double8_avx512.h>
+#	include <vcl/core/simd/double16_avx512.h>
 #	include <vcl/core/simd/float8_avx.h>
 #	include <vcl/core/simd/float16_avx512.h>
 #	include <vcl/core/simd/int8_avx.h>
@@ -60,6 +64,9 @@ namespace Vcl {
 #elif defined VCL_VECTORIZE_AVX
 #	include <vcl/core/simd/bool8_avx.h>
 #	include <vcl/core/simd/bool16_avx.h>
+#	include <vcl/core/simd/double4_avx.h>
+#	include <vcl/core/simd/double8_avx.h>
+#	include <vcl/core/simd/double16_avx.h>
 #	include <vcl/core/simd/float8_avx.h>
 #	include <vcl/core/simd/float16_avx.h>
 #	include <vcl/core/simd/int8_avx.h>
@@ -67,6 +74,9 @@ namespace Vcl {
 #elif defined VCL_VECTORIZE_SSE
 #	include <vcl/core/simd/bool8_sse.h>
 #	include <vcl/core/simd/bool16_sse.h>
+#	include <vcl/core/simd/double4_sse.h>
+#	include <vcl/core/simd/double8_sse.h>
+#	include <vcl/core/simd/double16_sse.h>
 #	include <vcl/core/simd/float8_sse.h>
 #	include <vcl/core/simd/float16_sse.h>
 #	include <vcl/core/simd/int8_sse.h>
@@ -75,16 +85,47 @@ namespace Vcl {
 #	include <vcl/core/simd/bool4_neon.h>
 #	include <vcl/core/simd/bool8_neon.h>
 #	include <vcl/core/simd/bool16_neon.h>
+#	include <vcl/core/simd/double4_ref.h>
+#	include <vcl/core/simd/double8_ref.h>
+#	include <vcl/core/simd/double16_ref.h>
 #	include <vcl/core/simd/float4_neon.h>
 #	include <vcl/core/simd/float8_neon.h>
 #	include <vcl/core/simd/float16_neon.h>
 #	include <vcl/core/simd/int4_neon.h>
 #	include <vcl/core/simd/int8_neon.h>
 #	include <vcl/core/simd/int16_neon.h>
+namespace Vcl {
+	//! The double types use the reference implementation on NEON
+	template<int Width>
+	VectorScalar<double, Width> select(
+		const VectorScalar<bool, Width>& mask,
+		const VectorScalar<double, Width>& a,
+		const VectorScalar<double, Width>& b)
+	{
+		VectorScalar<double, Width> res;
+		for (int i = 0; i < Width; i++)
+			res[i] = mask[i] ? a[i] : b[i];
+
+		return res;
+	}
+
+	template<int Width>
+	std::ostream& operator<<(std::ostream& s, const VectorScalar<double, Width>& rhs)
+	{
+		s << "'" << rhs[0];
+		for (int i = 1; i < Width; i++)
+			s << ", " << rhs[i];
+		s << "'";
+		return s;
+	}
+}
 #else
 #	include <vcl/core/simd/bool4_ref.h>
 #	include <vcl/core/simd/bool8_ref.h>
 #	include <vcl/core/simd/bool16_ref.h>
+#	include <vcl/core/simd/double4_ref.h>
+#	include <vcl/core/simd/double8_ref.h>
+#	include <vcl/core/simd/double16_ref.h>
 #	include <vcl/core/simd/float4_ref.h>
 #	include <vcl/core/simd/float8_ref.h>
 #	include <vcl/core/simd/float16_ref.h>
@@ -182,6 +223,30 @@ namespace Vcl {
 		using bool_t = VectorScalar<bool, 16>;
 	};
 
+	template<>
+	struct VectorTypes<VectorScalar<double, 4>>
+	{
+		using float_t = VectorScalar<double, 4>;
+		using int_t = VectorScalar<int, 4>;
+		using bool_t = VectorScalar<bool, 4>;
+	};
+
+	template<>
+	struct VectorTypes<VectorScalar<double, 8>>
+	{
+		using float_t = VectorScalar<double, 8>;
+		using int_t = VectorScalar<int, 8>;
+		using bool_t = VectorScalar<bool, 8>;
+	};
+
+	template<>
+	struct VectorTypes<VectorScalar<double, 16>>
+	{
+		using float_t = VectorScalar<double, 16>;
+		using int_t = VectorScalar<int, 16>;
+		using bool_t = VectorScalar<bool, 16>;
+	};
+
 	template<typename T>
 	struct NumericTrait
 	{
@@ -224,6 +289,47 @@ namespace Vcl {
 #endif
 	};
 
+	template<>
+	struct NumericTrait<VectorScalar<double, 4>>
+	{
+		using base_t = double;
+#if defined VCL_VECTORIZE_AVX
+		using wide_t = __m256d;
+#elif defined VCL_VECTORIZE_SSE
+		using wide_t = __m128d;
+#else
+		using wide_t = double;
+#endif
+	};
+	template<>
+	struct NumericTrait<VectorScalar<double, 8>>
+	{
+		using base_t = double;
+#if defined VCL_VECTORIZE_AVX512
+		using wide_t = __m512d;
+#elif defined VCL_VECTORIZE_AVX
+		using wide_t = __m256d;
+#elif defined VCL_VECTORIZE_SSE
+		using wide_t = __m128d;
+#else
+		using wide_t = double;
+#endif
+	};
+	template<>
+	struct NumericTrait<VectorScalar<double, 16>>
+	{
+		using base_t = double;
+#if defined VCL_VECTORIZE_AVX512
+		using wide_t = __m512d;
+#elif defined VCL_VECTORIZE_AVX
+		using wide_t = __m256d;
+#elif defined VCL_VECTORIZE_SSE
+		using wide_t = __m128d;
+#else
+		using wide_t = double;
+#endif
+	};
+
 	//! Component-wise negation
 	template<int Width>
 	VCL_STRONG_INLINE VectorScalar<float, Width> operator-(const VectorScalar<float, Width>& a)
@@ -231,6 +337,13 @@ namespace Vcl {
 		return a * VectorScalar<float, Width>(-1);
 	}
 
+	//! Component-wise negation
+	template<int Width>
+	VCL_STRONG_INLINE VectorScalar<double, Width> operator-(const VectorScalar<double, Width>& a)
+	{
+		return a * VectorScalar<double, Width>(-1);
+	}
+
 	//! Component-wise negation
 	template<int Width>
 	VCL_STRONG_INLINE VectorScalar<int, Width> operator-(const VectorScalar<int, Width>& a)
@@ -261,6 +374,7 @@ namespace Vcl {
 
 	// clang-format off
 	template<int Width> VCL_STRONG_INLINE Vcl::VectorScalar<bool, Width> isinf(const Vcl::VectorScalar<float, Width>& x) { return x.isinf(); }
+	template<int Width> VCL_STRONG_INLINE Vcl::VectorScalar<bool, Width> isinf(const Vcl::VectorScalar<double, Width>& x) { return x.isinf(); }
 
 	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> abs  (const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return x.abs(); }
 	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> abs2 (const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return x*x; }
@@ -274,7 +388,19 @@ namespace Vcl {
 	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> cos(const Vcl::VectorScalar<Scalar, Width>& x)  noexcept { return x.cos(); }
 	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> acos(const Vcl::VectorScalar<Scalar, Width>& x) noexcept  { return x.acos(); }
 
-	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> pow(const Vcl::VectorScalar<Scalar, Width>& x, const Vcl::VectorScalar<Scalar, Width>& y) noexcept { return exp(log(x) * y); }
+	// Max. error of the single precision implementations (see detail/cephes_mathfun.h):
+	// tan: 3.5 ulp for |x| <= 100, asin: 2.5 ulp, atan: 2 ulp, atan2: 3.5 ulp,
+	// exp2: 1.5 ulp, log2: 1.5 ulp, pow: 2 + |y log2(x)| ulp
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> tan(const Vcl::VectorScalar<Scalar, Width>& x)  noexcept { return x.tan(); }
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> asin(const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return x.asin(); }
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> atan(const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return x.atan(); }
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> atan2(const Vcl::VectorScalar<Scalar, Width>& y, const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return y.atan2(x); }
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> exp2(const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return x.exp2(); }
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> log2(const Vcl::VectorScalar<Scalar, Width>& x) noexcept { return x.log2(); }
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> pow(const Vcl::VectorScalar<Scalar, Width>& x, const Vcl::VectorScalar<Scalar, Width>& y) noexcept { return x.pow(y); }
+
+	//! Computes a * b + c, rounded once if the target supports fused multiply-add
+	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> fma(const Vcl::VectorScalar<Scalar, Width>& a, const Vcl::VectorScalar<Scalar, Width>& b, const Vcl::VectorScalar<Scalar, Width>& c) noexcept { return a.fma(b, c); }
 
 	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> min(const Vcl::VectorScalar<Scalar, Width>& x, const Vcl::VectorScalar<Scalar, Width>& y) noexcept { return x.min(y); }
 	template<typename Scalar, int Width> VCL_STRONG_INLINE Vcl::VectorScalar<Scalar, Width> max(const Vcl::VectorScalar<Scalar, Width>& x, const Vcl::VectorScalar<Scalar, Width>& y) noexcept { return x.max(y); }
@@ -289,12 +415,36 @@ namespace Vcl {
 		return x.sgn();
 	}
 	template<int Width>
+	VCL_STRONG_INLINE Vcl::VectorScalar<double, Width> sgn(const Vcl::VectorScalar<double, Width>& x)
+	{
+		return x.sgn();
+	}
+	template<int Width>
 	VCL_STRONG_INLINE VectorScalar<int, Width> sgn(const VectorScalar<int, Width>& a)
 	{
 		using int_t = VectorScalar<int, Width>;
 		return select(int_t(0) < a, int_t(1), int_t(0)) - select(a < int_t(0), int_t(1), int_t(0));
 	}
 
+	//! Computes a * b + c, rounded once if the target supports fused multiply-add
+	VCL_STRONG_INLINE float fma(float a, float b, float c) noexcept
+	{
+#if defined VCL_VECTORIZE_FMA
+		return std::fma(a, b, c);
+#else
+		return a * b + c;
+#endif
+	}
+
+	VCL_STRONG_INLINE double fma(double a, double b, double c) noexcept
+	{
+#if defined VCL_VECTORIZE_FMA
+		return std::fma(a, b, c);
+#else
+		return a * b + c;
+#endif
+	}
+
 	VCL_STRONG_INLINE constexpr float min(float x) noexcept
 	{
 		return x;
@@ -419,6 +569,10 @@ namespace Vcl {
 	using float8 = VectorScalar<float, 8>;
 	using float16 = VectorScalar<float, 16>;
 
+	using double4 = VectorScalar<double, 4>;
+	using double8 = VectorScalar<double, 8>;
+	using double16 = VectorScalar<double, 16>;
+
 	using int4 = VectorScalar<int, 4>;
 	using int8 = VectorScalar<int, 8>;
 	using int16 = VectorScalar<int, 16>;
@@ -495,6 +649,72 @@ namespace Eigen {
 		EIGEN_STRONG_INLINE static Vcl::float16 infinity() noexcept { return std::numeric_limits<float>::infinity(); }
 		EIGEN_STRONG_INLINE static Vcl::float16 quiet_NaN() noexcept { return std::numeric_limits<float>::quiet_NaN(); }
 	};
+	template<>
+	struct NumTraits<Vcl::double4> : GenericNumTraits<Vcl::double4>
+	{
+		enum
+		{
+			IsInteger = std::numeric_limits<double>::is_integer,
+			IsSigned = std::numeric_limits<double>::is_signed,
+			IsComplex = 0,
+			RequireInitialization = internal::is_arithmetic<double>::value ? 0 : 1,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static Vcl::double4 epsilon() noexcept { return std::numeric_limits<double>::epsilon(); }
+		EIGEN_STRONG_INLINE static int digits10() { return GenericNumTraits<double>::digits10(); }
+		EIGEN_STRONG_INLINE static Vcl::double4 dummy_precision() noexcept { return 1e-12; }
+		EIGEN_STRONG_INLINE static Vcl::double4 highest() noexcept { return std::numeric_limits<double>::max(); }
+		EIGEN_STRONG_INLINE static Vcl::double4 lowest() noexcept { return std::numeric_limits<double>::lowest(); }
+		EIGEN_STRONG_INLINE static Vcl::double4 infinity() noexcept { return std::numeric_limits<double>::infinity(); }
+		EIGEN_STRONG_INLINE static Vcl::double4 quiet_NaN() noexcept { return std::numeric_limits<double>::quiet_NaN(); }
+	};
+	template<>
+	struct NumTraits<Vcl::double8> : GenericNumTraits<Vcl::double8>
+	{
+		enum
+		{
+			IsInteger = std::numeric_limits<double>::is_integer,
+			IsSigned = std::numeric_limits<double>::is_signed,
+			IsComplex = 0,
+			RequireInitialization = internal::is_arithmetic<double>::value ? 0 : 1,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static Vcl::double8 epsilon() noexcept { return std::numeric_limits<double>::epsilon(); }
+		EIGEN_STRONG_INLINE static int digits10() { return GenericNumTraits<double>::digits10(); }
+		EIGEN_STRONG_INLINE static Vcl::double8 dummy_precision() noexcept { return 1e-12; }
+		EIGEN_STRONG_INLINE static Vcl::double8 highest() noexcept { return std::numeric_limits<double>::max(); }
+		EIGEN_STRONG_INLINE static Vcl::double8 lowest() noexcept { return std::numeric_limits<double>::lowest(); }
+		EIGEN_STRONG_INLINE static Vcl::double8 infinity() noexcept { return std::numeric_limits<double>::infinity(); }
+		EIGEN_STRONG_INLINE static Vcl::double8 quiet_NaN() noexcept { return std::numeric_limits<double>::quiet_NaN(); }
+	};
+	template<>
+	struct NumTraits<Vcl::double16> : GenericNumTraits<Vcl::double16>
+	{
+		enum
+		{
+			IsInteger = std::numeric_limits<double>::is_integer,
+			IsSigned = std::numeric_limits<double>::is_signed,
+			IsComplex = 0,
+			RequireInitialization = internal::is_arithmetic<double>::value ? 0 : 1,
+			ReadCost = 1,
+			AddCost = 1,
+			MulCost = 1
+		};
+
+		EIGEN_STRONG_INLINE static Vcl::double16 epsilon() noexcept { return std::numeric_limits<double>::epsilon(); }
+		EIGEN_STRONG_INLINE static int digits10() { return GenericNumTraits<double>::digits10(); }
+		EIGEN_STRONG_INLINE static Vcl::double16 dummy_precision() noexcept { return 1e-12; }
+		EIGEN_STRONG_INLINE static Vcl::double16 highest() noexcept { return std::numeric_limits<double>::max(); }
+		EIGEN_STRONG_INLINE static Vcl::double16 lowest() noexcept { return std::numeric_limits<double>::lowest(); }
+		EIGEN_STRONG_INLINE static Vcl::double16 infinity() noexcept { return std::numeric_limits<double>::infinity(); }
+		EIGEN_STRONG_INLINE static Vcl::double16 quiet_NaN() noexcept { return std::numeric_limits<double>::quiet_NaN(); }
+	};
 }
 
 // clang-format off
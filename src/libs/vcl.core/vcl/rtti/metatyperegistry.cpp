@@ -25,13 +25,14 @@
 #include <vcl/rtti/metatyperegistry.h>
 
 // VCL
+#include <vcl/core/container/flathashmap.h>
 #include <vcl/util/hashedstring.h>
 
 namespace Vcl { namespace RTTI {
 	// Stores pointer to instatiated type objects.
 	// This registry is non-owning. Initialization and cleanup
 	// must be performed by the calling code.
-	using TypeMap = std::unordered_map<size_t, const Type*>;
+	using TypeMap = Vcl::Core::FlatHashMap<size_t, const Type*>;
 
 	namespace {
 		TypeMap& instance()
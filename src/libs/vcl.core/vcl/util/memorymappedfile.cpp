@@ -0,0 +1,168 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/util/memorymappedfile.h>
+
+// C++ standard library
+#include <utility>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+#ifdef VCL_ABI_WINAPI
+#	include <windows.h>
+#elif defined(VCL_ABI_POSIX)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+VCL_END_EXTERNAL_HEADERS
+
+namespace Vcl { namespace Util {
+	MemoryMappedFile::MemoryMappedFile(const std::string& path)
+	{
+		open(path);
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+			std::swap(_data, other._data);
+			std::swap(_size, other._size);
+			std::swap(_isOpen, other._isOpen);
+#ifdef VCL_ABI_WINAPI
+			std::swap(_mapping, other._mapping);
+#endif
+		}
+		return *this;
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		close();
+	}
+
+	bool MemoryMappedFile::open(const std::string& path)
+	{
+		close();
+
+#if defined(VCL_ABI_WINAPI)
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		_size = static_cast<size_t>(size.QuadPart);
+		if (_size > 0)
+		{
+			// The mapping keeps a reference to the file
+			_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			if (!_mapping)
+			{
+				_size = 0;
+				return false;
+			}
+
+			_data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!_data)
+			{
+				CloseHandle(_mapping);
+				_mapping = nullptr;
+				_size = 0;
+				return false;
+			}
+		} else
+		{
+			CloseHandle(file);
+		}
+#elif defined(VCL_ABI_POSIX)
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		_size = static_cast<size_t>(info.st_size);
+		if (_size > 0)
+		{
+			void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data == MAP_FAILED)
+			{
+				::close(fd);
+				_size = 0;
+				return false;
+			}
+#	ifdef MADV_SEQUENTIAL
+			madvise(data, _size, MADV_SEQUENTIAL);
+#	endif
+			_data = static_cast<const char*>(data);
+		}
+
+		// The mapping stays valid after closing the descriptor
+		::close(fd);
+#else
+		VCL_UNREFERENCED_PARAMETER(path);
+		return false;
+#endif
+
+		_isOpen = true;
+		return true;
+	}
+
+	void MemoryMappedFile::close()
+	{
+#if defined(VCL_ABI_WINAPI)
+		if (_data)
+			UnmapViewOfFile(_data);
+		if (_mapping)
+			CloseHandle(_mapping);
+		_mapping = nullptr;
+#elif defined(VCL_ABI_POSIX)
+		if (_data)
+			munmap(const_cast<char*>(_data), _size);
+#endif
+
+		_data = nullptr;
+		_size = 0;
+		_isOpen = false;
+	}
+}}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <string>
+
+namespace Vcl { namespace Util {
+	/*!
+	 *	Read-only view of a file mapped into the address space.
+	 *	Pages are loaded by the operating system on first access,
+	 *	which avoids copying the file content into user buffers.
+	 */
+	class MemoryMappedFile
+	{
+	public:
+		MemoryMappedFile() = default;
+		explicit MemoryMappedFile(const std::string& path);
+		MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+		MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+		~MemoryMappedFile();
+
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	public:
+		/*!
+		 *	Map the file at 'path'
+		 *	\returns true if the file could be opened and mapped
+		 */
+		bool open(const std::string& path);
+
+		//! Unmap the current file
+		void close();
+
+		//! \returns true if a file is mapped. Empty files are mapped without data.
+		bool isOpen() const { return _isOpen; }
+
+		const char* data() const { return _data; }
+		size_t size() const { return _size; }
+
+	private:
+		//! Start of the mapped file content
+		const char* _data{ nullptr };
+
+		//! Size of the mapped file in bytes
+		size_t _size{ 0 };
+
+		//! A file is currently mapped
+		bool _isOpen{ false };
+
+#ifdef VCL_ABI_WINAPI
+		//! File mapping object
+		void* _mapping{ nullptr };
+#endif
+	};
+}}
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/util/mortoncodes.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+
+// VCL
+#include <vcl/core/simd/algorithm.h>
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+
+namespace Vcl { namespace Util {
+	namespace {
+		using wide_float_t = VectorScalar<float, Core::Simd::NativeWidth<float>::value>;
+
+		/*!
+		 *	Quantise the points onto the grid [0, max_coord]^Dim spanned by
+		 *	'bounds' and encode the resulting coordinates using 'encode'.
+		 *	Complete blocks of points are quantised using SIMD instructions.
+		 */
+		template<int Dim, typename Code, typename Encode>
+		void encodeBatch(
+			stdext::span<const Eigen::Matrix<float, Dim, 1>> points,
+			stdext::span<Code> codes,
+			const Eigen::AlignedBox<float, Dim>& bounds,
+			uint32_t max_coord,
+			Encode encode)
+		{
+			const size_t width = Core::Simd::NativeWidth<float>::value;
+
+			VclRequire(points.size() == codes.size(), "Each point receives a code.");
+			VclRequire(!bounds.isEmpty(), "Bounds are valid.");
+
+			// Largest value converting to a valid coordinate
+			float max_q = static_cast<float>(max_coord);
+			if (static_cast<double>(max_q) > static_cast<double>(max_coord))
+				max_q = std::nextafter(max_q, 0.0f);
+
+			float lo[Dim], scale[Dim];
+			for (int d = 0; d < Dim; d++)
+			{
+				const float extent = bounds.max()[d] - bounds.min()[d];
+				lo[d] = bounds.min()[d];
+				scale[d] = extent > 0 ? max_q / extent : 0.0f;
+			}
+
+			alignas(64) float quantised[Dim][width];
+			uint32_t coords[Dim];
+
+			size_t i = 0;
+			for (; i + width <= points.size(); i += width)
+			{
+				Eigen::Matrix<wide_float_t, Dim, 1> p;
+				load(p, points.data() + i);
+				for (int d = 0; d < Dim; d++)
+				{
+					const wide_float_t q = (p(d) - wide_float_t(lo[d])) * wide_float_t(scale[d]);
+					store(quantised[d], q.max(wide_float_t(0.0f)).min(wide_float_t(max_q)));
+				}
+
+				for (size_t j = 0; j < width; j++)
+				{
+					for (int d = 0; d < Dim; d++)
+						coords[d] = static_cast<uint32_t>(quantised[d][j]);
+					codes[i + j] = encode(coords);
+				}
+			}
+			for (; i < points.size(); i++)
+			{
+				for (int d = 0; d < Dim; d++)
+				{
+					const float q = (points[i][d] - lo[d]) * scale[d];
+					coords[d] = static_cast<uint32_t>(std::min(std::max(q, 0.0f), max_q));
+				}
+				codes[i] = encode(coords);
+			}
+		}
+	}
+
+	void MortonCode::encode(stdext::span<const Eigen::Vector3f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox3f& bounds)
+	{
+		encodeBatch(points, codes, bounds, MaxCoordinate3D, [](const uint32_t* c) { return encode(c[0], c[1], c[2]); });
+	}
+
+	void MortonCode::encode(stdext::span<const Eigen::Vector2f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox2f& bounds)
+	{
+		encodeBatch(points, codes, bounds, MaxCoordinate2D, [](const uint32_t* c) { return encode(c[0], c[1]); });
+	}
+
+	void MortonCode32::encode(stdext::span<const Eigen::Vector3f> points, stdext::span<uint32_t> codes, const Eigen::AlignedBox3f& bounds)
+	{
+		encodeBatch(points, codes, bounds, MaxCoordinate3D, [](const uint32_t* c) { return encode(c[0], c[1], c[2]); });
+	}
+
+	void MortonCode32::encode(stdext::span<const Eigen::Vector2f> points, stdext::span<uint32_t> codes, const Eigen::AlignedBox2f& bounds)
+	{
+		encodeBatch(points, codes, bounds, MaxCoordinate2D, [](const uint32_t* c) { return encode(c[0], c[1]); });
+	}
+
+	void HilbertCode::encode(stdext::span<const Eigen::Vector3f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox3f& bounds)
+	{
+		encodeBatch(points, codes, bounds, MortonCode::MaxCoordinate3D, [](const uint32_t* c) { return encode(c[0], c[1], c[2]); });
+	}
+
+	void HilbertCode::encode(stdext::span<const Eigen::Vector2f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox2f& bounds)
+	{
+		encodeBatch(points, codes, bounds, MortonCode::MaxCoordinate2D, [](const uint32_t* c) { return encode(c[0], c[1]); });
+	}
+}}
@@ -26,43 +26,90 @@
 
 // VCL configuration
 #include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <cstdint>
 
 // VCL
 #include <vcl/core/contract.h>
+#include <vcl/core/span.h>
 
 namespace Vcl { namespace Util {
 	/*!
-	 * Original implementation can be found at: http://www.forceflow.be/2013/10/07/morton-encodingdecoding-through-bit-interleaving-implementations/
+	 *	64-bit Morton codes. Three-dimensional codes use 21 bits per
+	 *	coordinate, two-dimensional codes 32 bits per coordinate.
+	 *
+	 *	Original implementation can be found at: http://www.forceflow.be/2013/10/07/morton-encodingdecoding-through-bit-interleaving-implementations/
+	 *	With BMI2 the bits are interleaved using 'pdep' and 'pext'.
+	 *	\note 'pdep' and 'pext' are micro-coded and slow on AMD CPUs before Zen 3.
 	 */
 	class MortonCode
 	{
+	public:
+		//! Largest coordinate of a three-dimensional code
+		static const uint32_t MaxCoordinate3D = 0x1fffff;
+
+		//! Largest coordinate of a two-dimensional code
+		static const uint32_t MaxCoordinate2D = 0xffffffff;
+
 	public:
 		VCL_STRONG_INLINE static uint64_t encode(uint32_t x, uint32_t y, uint32_t z)
 		{
-			uint64_t answer = 0;
-			answer |= splitBy3(x) | splitBy3(y) << 1 | splitBy3(z) << 2;
-			return answer;
+			VclRequire(x <= MaxCoordinate3D && y <= MaxCoordinate3D && z <= MaxCoordinate3D, "Coordinates are only 21 bits large.");
+
+#ifdef VCL_VECTORIZE_BMI2
+			return _pdep_u64(x, 0x1249249249249249) | _pdep_u64(y, 0x2492492492492492) | _pdep_u64(z, 0x4924924924924924);
+#else
+			return splitBy3(x) | splitBy3(y) << 1 | splitBy3(z) << 2;
+#endif
 		}
 
 		VCL_STRONG_INLINE static void decode(uint64_t morton, uint32_t& x, uint32_t& y, uint32_t& z)
 		{
-			x = 0;
-			y = 0;
-			z = 0;
+#ifdef VCL_VECTORIZE_BMI2
+			x = static_cast<uint32_t>(_pext_u64(morton, 0x1249249249249249));
+			y = static_cast<uint32_t>(_pext_u64(morton, 0x2492492492492492));
+			z = static_cast<uint32_t>(_pext_u64(morton, 0x4924924924924924));
+#else
+			x = compactBy3(morton);
+			y = compactBy3(morton >> 1);
+			z = compactBy3(morton >> 2);
+#endif
+		}
 
-			for (uint64_t i = 0; i < (sizeof(uint64_t) * CHAR_BIT) / 3; ++i)
-			{
-				x |= ((morton & (uint64_t(1ull) << uint64_t((3ull * i) + 0ull))) >> uint64_t(((3ull * i) + 0ull) - i));
-				y |= ((morton & (uint64_t(1ull) << uint64_t((3ull * i) + 1ull))) >> uint64_t(((3ull * i) + 1ull) - i));
-				z |= ((morton & (uint64_t(1ull) << uint64_t((3ull * i) + 2ull))) >> uint64_t(((3ull * i) + 2ull) - i));
-			}
+		VCL_STRONG_INLINE static uint64_t encode(uint32_t x, uint32_t y)
+		{
+#ifdef VCL_VECTORIZE_BMI2
+			return _pdep_u64(x, 0x5555555555555555) | _pdep_u64(y, 0xaaaaaaaaaaaaaaaa);
+#else
+			return splitBy2(x) | splitBy2(y) << 1;
+#endif
+		}
+
+		VCL_STRONG_INLINE static void decode(uint64_t morton, uint32_t& x, uint32_t& y)
+		{
+#ifdef VCL_VECTORIZE_BMI2
+			x = static_cast<uint32_t>(_pext_u64(morton, 0x5555555555555555));
+			y = static_cast<uint32_t>(_pext_u64(morton, 0xaaaaaaaaaaaaaaaa));
+#else
+			x = compactBy2(morton);
+			y = compactBy2(morton >> 1);
+#endif
 		}
 
+		/*!
+		 *	\brief Encode a batch of points
+		 *
+		 *	The points are quantised to the full resolution of the codes
+		 *	within 'bounds'. Points outside of 'bounds' are clamped.
+		 */
+		static void encode(stdext::span<const Eigen::Vector3f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox3f& bounds);
+		static void encode(stdext::span<const Eigen::Vector2f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox2f& bounds);
+
 	private:
 		VCL_STRONG_INLINE static uint64_t splitBy3(uint32_t a)
 		{
-			VclRequire((a & ~0x1fffff) == 0, "a is in only 21 bits large.");
-
 			uint64_t x = a & 0x1fffff;             // we only look at the first 21 bits
 			x = (x | x << 32) & 0x1f00000000ffff;  // shift left 32 bits, OR with self, and 00011111000000000000000000000000000000001111111111111111
 			x = (x | x << 16) & 0x1f0000ff0000ff;  // shift left 32 bits, OR with self, and 00011111000000000000000011111111000000000000000011111111
@@ -71,5 +118,275 @@ namespace Vcl { namespace Util {
 			x = (x | x << 2) & 0x1249249249249249;
 			return x;
 		}
+
+		//! Inverse of 'splitBy3', collecting every third bit
+		VCL_STRONG_INLINE static uint32_t compactBy3(uint64_t x)
+		{
+			x &= 0x1249249249249249;
+			x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3;
+			x = (x ^ (x >> 4)) & 0x100f00f00f00f00f;
+			x = (x ^ (x >> 8)) & 0x1f0000ff0000ff;
+			x = (x ^ (x >> 16)) & 0x1f00000000ffff;
+			x = (x ^ (x >> 32)) & 0x1fffff;
+			return static_cast<uint32_t>(x);
+		}
+
+		VCL_STRONG_INLINE static uint64_t splitBy2(uint32_t a)
+		{
+			uint64_t x = a;
+			x = (x | x << 16) & 0x0000ffff0000ffff;
+			x = (x | x << 8) & 0x00ff00ff00ff00ff;
+			x = (x | x << 4) & 0x0f0f0f0f0f0f0f0f;
+			x = (x | x << 2) & 0x3333333333333333;
+			x = (x | x << 1) & 0x5555555555555555;
+			return x;
+		}
+
+		VCL_STRONG_INLINE static uint32_t compactBy2(uint64_t x)
+		{
+			x &= 0x5555555555555555;
+			x = (x ^ (x >> 1)) & 0x3333333333333333;
+			x = (x ^ (x >> 2)) & 0x0f0f0f0f0f0f0f0f;
+			x = (x ^ (x >> 4)) & 0x00ff00ff00ff00ff;
+			x = (x ^ (x >> 8)) & 0x0000ffff0000ffff;
+			x = (x ^ (x >> 16)) & 0x00000000ffffffff;
+			return static_cast<uint32_t>(x);
+		}
+	};
+
+	/*!
+	 *	32-bit Morton codes. Three-dimensional codes use 10 bits per
+	 *	coordinate, two-dimensional codes 16 bits per coordinate.
+	 */
+	class MortonCode32
+	{
+	public:
+		//! Largest coordinate of a three-dimensional code
+		static const uint32_t MaxCoordinate3D = 0x3ff;
+
+		//! Largest coordinate of a two-dimensional code
+		static const uint32_t MaxCoordinate2D = 0xffff;
+
+	public:
+		VCL_STRONG_INLINE static uint32_t encode(uint32_t x, uint32_t y, uint32_t z)
+		{
+			VclRequire(x <= MaxCoordinate3D && y <= MaxCoordinate3D && z <= MaxCoordinate3D, "Coordinates are only 10 bits large.");
+
+#ifdef VCL_VECTORIZE_BMI2
+			return _pdep_u32(x, 0x09249249) | _pdep_u32(y, 0x12492492) | _pdep_u32(z, 0x24924924);
+#else
+			return splitBy3(x) | splitBy3(y) << 1 | splitBy3(z) << 2;
+#endif
+		}
+
+		VCL_STRONG_INLINE static void decode(uint32_t morton, uint32_t& x, uint32_t& y, uint32_t& z)
+		{
+#ifdef VCL_VECTORIZE_BMI2
+			x = _pext_u32(morton, 0x09249249);
+			y = _pext_u32(morton, 0x12492492);
+			z = _pext_u32(morton, 0x24924924);
+#else
+			x = compactBy3(morton);
+			y = compactBy3(morton >> 1);
+			z = compactBy3(morton >> 2);
+#endif
+		}
+
+		VCL_STRONG_INLINE static uint32_t encode(uint32_t x, uint32_t y)
+		{
+			VclRequire(x <= MaxCoordinate2D && y <= MaxCoordinate2D, "Coordinates are only 16 bits large.");
+
+#ifdef VCL_VECTORIZE_BMI2
+			return _pdep_u32(x, 0x55555555) | _pdep_u32(y, 0xaaaaaaaa);
+#else
+			return splitBy2(x) | splitBy2(y) << 1;
+#endif
+		}
+
+		VCL_STRONG_INLINE static void decode(uint32_t morton, uint32_t& x, uint32_t& y)
+		{
+#ifdef VCL_VECTORIZE_BMI2
+			x = _pext_u32(morton, 0x55555555);
+			y = _pext_u32(morton, 0xaaaaaaaa);
+#else
+			x = compactBy2(morton);
+			y = compactBy2(morton >> 1);
+#endif
+		}
+
+		//! \brief Encode a batch of points, see 'MortonCode::encode'
+		static void encode(stdext::span<const Eigen::Vector3f> points, stdext::span<uint32_t> codes, const Eigen::AlignedBox3f& bounds);
+		static void encode(stdext::span<const Eigen::Vector2f> points, stdext::span<uint32_t> codes, const Eigen::AlignedBox2f& bounds);
+
+	private:
+		VCL_STRONG_INLINE static uint32_t splitBy3(uint32_t x)
+		{
+			x &= 0x3ff;
+			x = (x | x << 16) & 0x030000ff;
+			x = (x | x << 8) & 0x0300f00f;
+			x = (x | x << 4) & 0x030c30c3;
+			x = (x | x << 2) & 0x09249249;
+			return x;
+		}
+
+		VCL_STRONG_INLINE static uint32_t compactBy3(uint32_t x)
+		{
+			x &= 0x09249249;
+			x = (x ^ (x >> 2)) & 0x030c30c3;
+			x = (x ^ (x >> 4)) & 0x0300f00f;
+			x = (x ^ (x >> 8)) & 0x030000ff;
+			x = (x ^ (x >> 16)) & 0x000003ff;
+			return x;
+		}
+
+		VCL_STRONG_INLINE static uint32_t splitBy2(uint32_t x)
+		{
+			x &= 0xffff;
+			x = (x | x << 8) & 0x00ff00ff;
+			x = (x | x << 4) & 0x0f0f0f0f;
+			x = (x | x << 2) & 0x33333333;
+			x = (x | x << 1) & 0x55555555;
+			return x;
+		}
+
+		VCL_STRONG_INLINE static uint32_t compactBy2(uint32_t x)
+		{
+			x &= 0x55555555;
+			x = (x ^ (x >> 1)) & 0x33333333;
+			x = (x ^ (x >> 2)) & 0x0f0f0f0f;
+			x = (x ^ (x >> 4)) & 0x00ff00ff;
+			x = (x ^ (x >> 8)) & 0x0000ffff;
+			return x;
+		}
+	};
+
+	/*!
+	 *	64-bit Hilbert curve keys. Consecutive keys address neighbouring
+	 *	cells, which improves the locality of sorted points compared to
+	 *	Morton codes at a higher encoding cost.
+	 *
+	 *	Implementation following: J. Skilling, "Programming the Hilbert
+	 *	curve", AIP Conference Proceedings 707, 2004
+	 */
+	class HilbertCode
+	{
+	public:
+		/*!
+		 *	\param bits Number of bits per coordinate; keys are only
+		 *	            comparable when using the same number of bits.
+		 */
+		VCL_STRONG_INLINE static uint64_t encode(uint32_t x, uint32_t y, uint32_t z, int bits = 21)
+		{
+			VclRequire(0 < bits && bits <= 21, "Three-dimensional keys support up to 21 bits.");
+
+			uint32_t axes[] = { x, y, z };
+			axesToTranspose(axes, bits);
+			return MortonCode::encode(axes[2], axes[1], axes[0]);
+		}
+
+		VCL_STRONG_INLINE static void decode(uint64_t key, uint32_t& x, uint32_t& y, uint32_t& z, int bits = 21)
+		{
+			VclRequire(0 < bits && bits <= 21, "Three-dimensional keys support up to 21 bits.");
+
+			uint32_t axes[3];
+			MortonCode::decode(key, axes[2], axes[1], axes[0]);
+			transposeToAxes(axes, bits);
+			x = axes[0];
+			y = axes[1];
+			z = axes[2];
+		}
+
+		VCL_STRONG_INLINE static uint64_t encode(uint32_t x, uint32_t y, int bits = 32)
+		{
+			VclRequire(0 < bits && bits <= 32, "Two-dimensional keys support up to 32 bits.");
+
+			uint32_t axes[] = { x, y };
+			axesToTranspose(axes, bits);
+			return MortonCode::encode(axes[1], axes[0]);
+		}
+
+		VCL_STRONG_INLINE static void decode(uint64_t key, uint32_t& x, uint32_t& y, int bits = 32)
+		{
+			VclRequire(0 < bits && bits <= 32, "Two-dimensional keys support up to 32 bits.");
+
+			uint32_t axes[2];
+			MortonCode::decode(key, axes[1], axes[0]);
+			transposeToAxes(axes, bits);
+			x = axes[0];
+			y = axes[1];
+		}
+
+		//! \brief Encode a batch of points using the full resolution, see 'MortonCode::encode'
+		static void encode(stdext::span<const Eigen::Vector3f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox3f& bounds);
+		static void encode(stdext::span<const Eigen::Vector2f> points, stdext::span<uint64_t> codes, const Eigen::AlignedBox2f& bounds);
+
+	private:
+		//! Convert the coordinates to the transposed Hilbert index
+		template<int N>
+		VCL_STRONG_INLINE static void axesToTranspose(uint32_t (&x)[N], int bits)
+		{
+			// Inverse undo
+			for (int b = bits - 1; b > 0; b--)
+			{
+				const uint32_t q = uint32_t(1) << b;
+				const uint32_t p = q - 1;
+				for (int i = 0; i < N; i++)
+				{
+					if (x[i] & q)
+					{
+						x[0] ^= p;
+					} else
+					{
+						const uint32_t t = (x[0] ^ x[i]) & p;
+						x[0] ^= t;
+						x[i] ^= t;
+					}
+				}
+			}
+
+			// Gray encode
+			for (int i = 1; i < N; i++)
+				x[i] ^= x[i - 1];
+
+			uint32_t t = 0;
+			for (int b = bits - 1; b > 0; b--)
+			{
+				const uint32_t q = uint32_t(1) << b;
+				if (x[N - 1] & q)
+					t ^= q - 1;
+			}
+			for (int i = 0; i < N; i++)
+				x[i] ^= t;
+		}
+
+		//! Convert the transposed Hilbert index to coordinates
+		template<int N>
+		VCL_STRONG_INLINE static void transposeToAxes(uint32_t (&x)[N], int bits)
+		{
+			// Gray decode
+			const uint32_t t = x[N - 1] >> 1;
+			for (int i = N - 1; i > 0; i--)
+				x[i] ^= x[i - 1];
+			x[0] ^= t;
+
+			// Undo excess work
+			for (int b = 1; b < bits; b++)
+			{
+				const uint32_t q = uint32_t(1) << b;
+				const uint32_t p = q - 1;
+				for (int i = N - 1; i >= 0; i--)
+				{
+					if (x[i] & q)
+					{
+						x[0] ^= p;
+					} else
+					{
+						const uint32_t s = (x[0] ^ x[i]) & p;
+						x[0] ^= s;
+						x[i] ^= s;
+					}
+				}
+			}
+		}
 	};
 }}
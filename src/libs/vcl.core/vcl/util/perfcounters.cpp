@@ -0,0 +1,179 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/util/perfcounters.h>
+
+// C++ standard library
+#include <cstring>
+
+// VCL
+#include <vcl/core/contract.h>
+
+#if defined(VCL_ABI_POSIX) && defined(__linux__)
+#	define VCL_UTIL_PERF_EVENT_OPEN
+VCL_BEGIN_EXTERNAL_HEADERS
+#	include <linux/perf_event.h>
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+VCL_END_EXTERNAL_HEADERS
+#endif
+
+namespace Vcl { namespace Util {
+#ifdef VCL_UTIL_PERF_EVENT_OPEN
+	namespace {
+		//! Type and configuration of an event
+		struct EventConfig
+		{
+			uint32_t type;
+			uint64_t config;
+		};
+
+		// Must follow the order of 'PerfCounters::Event'
+		const EventConfig EventConfigs[] = {
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+			{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		};
+
+		int openEvent(const EventConfig& event)
+		{
+			perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = event.type;
+			attr.config = event.config;
+			attr.disabled = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			// Count the calling thread on any processor
+			return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+		}
+	}
+#endif // VCL_UTIL_PERF_EVENT_OPEN
+
+	const char* PerfCounters::name(Event event)
+	{
+		switch (event)
+		{
+		case Event::Cycles: return "cycles";
+		case Event::Instructions: return "instructions";
+		case Event::L1DMisses: return "L1-dcache-load-misses";
+		case Event::LLCMisses: return "LLC-misses";
+		case Event::BranchMisses: return "branch-misses";
+		}
+
+		VclDebugError("Unknown event.");
+		return "";
+	}
+
+	PerfCounters::PerfCounters()
+	{
+		_fds.fill(-1);
+		_values.fill(0);
+
+#ifdef VCL_UTIL_PERF_EVENT_OPEN
+		static_assert(sizeof(EventConfigs) / sizeof(EventConfigs[0]) == NrEvents, "All events are configured");
+		for (size_t e = 0; e < NrEvents; e++)
+			_fds[e] = openEvent(EventConfigs[e]);
+#endif // VCL_UTIL_PERF_EVENT_OPEN
+	}
+
+	PerfCounters::~PerfCounters()
+	{
+#ifdef VCL_UTIL_PERF_EVENT_OPEN
+		for (int fd : _fds)
+		{
+			if (fd >= 0)
+				::close(fd);
+		}
+#endif // VCL_UTIL_PERF_EVENT_OPEN
+	}
+
+	bool PerfCounters::isAvailable(Event event) const
+	{
+		return _fds[static_cast<size_t>(event)] >= 0;
+	}
+
+	bool PerfCounters::isAvailable() const
+	{
+		for (int fd : _fds)
+		{
+			if (fd >= 0)
+				return true;
+		}
+		return false;
+	}
+
+	void PerfCounters::start()
+	{
+#ifdef VCL_UTIL_PERF_EVENT_OPEN
+		for (int fd : _fds)
+		{
+			if (fd >= 0)
+			{
+				ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+				ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+			}
+		}
+#endif // VCL_UTIL_PERF_EVENT_OPEN
+	}
+
+	void PerfCounters::stop()
+	{
+#ifdef VCL_UTIL_PERF_EVENT_OPEN
+		for (int fd : _fds)
+		{
+			if (fd >= 0)
+				ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+		}
+
+		for (size_t e = 0; e < NrEvents; e++)
+		{
+			_values[e] = 0;
+			if (_fds[e] < 0)
+				continue;
+
+			// Value, time enabled, time running
+			uint64_t data[3] = { 0, 0, 0 };
+			if (::read(_fds[e], data, sizeof(data)) != sizeof(data) || data[2] == 0)
+				continue;
+
+			if (data[2] < data[1])
+				_values[e] = static_cast<uint64_t>(double(data[0]) * double(data[1]) / double(data[2]));
+			else
+				_values[e] = data[0];
+		}
+#endif // VCL_UTIL_PERF_EVENT_OPEN
+	}
+
+	uint64_t PerfCounters::value(Event event) const
+	{
+		return _values[static_cast<size_t>(event)];
+	}
+}}
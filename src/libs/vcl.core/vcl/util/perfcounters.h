@@ -0,0 +1,98 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <array>
+#include <cstdint>
+
+namespace Vcl { namespace Util {
+	/*!
+	 *	Hardware performance counters of the calling thread.
+	 *
+	 *	On Linux the counters are read through 'perf_event_open'. Only user
+	 *	space is counted, which is permitted with the default
+	 *	'perf_event_paranoid' setting. Events which cannot be opened, e.g.
+	 *	on other platforms, inside virtual machines or containers, are
+	 *	reported as unavailable instead of failing.
+	 */
+	class PerfCounters
+	{
+	public:
+		enum class Event
+		{
+			Cycles = 0,
+			Instructions,
+			L1DMisses,
+			LLCMisses,
+			BranchMisses,
+		};
+
+		//! Number of supported events
+		static const size_t NrEvents = 5;
+
+		//! Short name of an event following the naming of 'perf'
+		static const char* name(Event event);
+
+	public:
+		//! Open the counters of the calling thread. The counters are not yet running.
+		PerfCounters();
+		~PerfCounters();
+
+		PerfCounters(const PerfCounters&) = delete;
+		PerfCounters& operator=(const PerfCounters&) = delete;
+
+	public:
+		//! \returns true if 'event' can be counted
+		bool isAvailable(Event event) const;
+
+		//! \returns true if any event can be counted
+		bool isAvailable() const;
+
+		//! Reset and start all counters
+		void start();
+
+		//! Stop all counters and read their values
+		void stop();
+
+		/*!
+		 *	Number of events between the last 'start' and 'stop'.
+		 *	If the kernel had to multiplex the counters, the value is
+		 *	extrapolated from the fraction of time the counter was active.
+		 *	\returns 0 for unavailable events
+		 */
+		uint64_t value(Event event) const;
+
+	private:
+		//! Counter file descriptors, -1 if unavailable
+		std::array<int, NrEvents> _fds;
+
+		//! Values read at the last 'stop'
+		std::array<uint64_t, NrEvents> _values;
+	};
+}}
@@ -47,22 +47,22 @@ namespace Vcl { namespace Util {
 	void PreciseTimer::start()
 	{
 #ifdef VCL_STL_CHRONO
-		_startTime = std::chrono::high_resolution_clock::now();
+		_startTime = std::chrono::steady_clock::now();
 #elif defined VCL_ABI_WINAPI
 		QueryPerformanceCounter(&_startTime);
 #elif defined VCL_ABI_POSIX
-		clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_startTime);
+		clock_gettime(CLOCK_MONOTONIC, &_startTime);
 #endif // VCL_STL_CHRONO
 	}
 
 	void PreciseTimer::stop()
 	{
 #ifdef VCL_STL_CHRONO
-		_stopTime = std::chrono::high_resolution_clock::now();
+		_stopTime = std::chrono::steady_clock::now();
 #elif defined VCL_ABI_WINAPI
 		QueryPerformanceCounter(&_stopTime);
 #elif defined VCL_ABI_POSIX
-		clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &_stopTime);
+		clock_gettime(CLOCK_MONOTONIC, &_stopTime);
 #endif // VCL_STL_CHRONO
 	}
 
@@ -72,7 +72,7 @@ namespace Vcl { namespace Util {
 
 #ifdef VCL_STL_CHRONO
 		auto diff = _stopTime - _startTime;
-		return std::chrono::duration<double, std::nano>(diff).count() / double(nr_iterations);
+		return std::chrono::duration<double>(diff).count() / double(nr_iterations);
 #elif defined VCL_ABI_WINAPI
 		LARGE_INTEGER freq;
 		if (QueryPerformanceFrequency(&freq) == false) return std::numeric_limits<double>::quiet_NaN();
@@ -80,7 +80,7 @@ namespace Vcl { namespace Util {
 		return (double(_stopTime.QuadPart - _startTime.QuadPart) / double(freq.QuadPart)) / double(nr_iterations);
 #elif defined VCL_ABI_POSIX
 		timespec thisdiff = diff(_startTime, _stopTime);
-		return (double(size_t(1e9) * thisdiff.tv_sec) + double(thisdiff.tv_nsec)) / double(nr_iterations);
+		return (double(thisdiff.tv_sec) + 1e-9 * double(thisdiff.tv_nsec)) / double(nr_iterations);
 #endif // VCL_STL_CHRONO
 	}
 }}
@@ -44,21 +44,23 @@ VCL_END_EXTERNAL_HEADERS
 #endif // VCL_STL_CHRONO
 
 namespace Vcl { namespace Util {
+	//! Measures the elapsed wall-clock time on a monotonic clock
 	class PreciseTimer
 	{
 	public:
 		void start();
 		void stop();
 
+		//! \returns the time between 'start' and 'stop' in seconds, divided by 'nr_iterations'
 		double interval(unsigned int nr_iterations = 1) const;
 
 	private:
 #ifdef VCL_STL_CHRONO
 		//! Time clock was started
-		std::chrono::high_resolution_clock::time_point _startTime;
+		std::chrono::steady_clock::time_point _startTime;
 
 		//! Time clock was stopped
-		std::chrono::high_resolution_clock::time_point _stopTime;
+		std::chrono::steady_clock::time_point _stopTime;
 #elif defined(VCL_ABI_WINAPI)
 		LARGE_INTEGER _startTime, _stopTime;
 #elif defined(VCL_ABI_POSIX)
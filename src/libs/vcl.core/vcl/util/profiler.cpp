@@ -0,0 +1,207 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/util/profiler.h>
+
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+#ifdef VCL_ABI_POSIX
+#	include <time.h>
+#endif
+VCL_END_EXTERNAL_HEADERS
+
+namespace Vcl { namespace Util {
+	namespace {
+		//! Ring buffer of a single recording thread
+		struct ThreadEvents
+		{
+			explicit ThreadEvents(uint32_t id)
+			: thread(id)
+			, events(new ProfileEvent[Profiler::Capacity])
+			{
+			}
+
+			//! Index of the thread
+			const uint32_t thread;
+
+			//! Event storage
+			std::unique_ptr<ProfileEvent[]> events;
+
+			//! Number of events written so far. Only the owning thread increments it.
+			std::atomic<uint64_t> head{ 0 };
+
+			//! First event not discarded by 'clear'
+			std::atomic<uint64_t> tail{ 0 };
+		};
+
+		//! Buffers of all threads which recorded events. Kept until the program ends.
+		struct Registry
+		{
+			std::mutex lock;
+			std::vector<std::unique_ptr<ThreadEvents>> threads;
+		};
+
+		Registry& registry()
+		{
+			static Registry reg;
+			return reg;
+		}
+
+		ThreadEvents& localEvents()
+		{
+			thread_local ThreadEvents* events = nullptr;
+			if (!events)
+			{
+				auto& reg = registry();
+				std::lock_guard<std::mutex> guard{ reg.lock };
+				reg.threads.emplace_back(new ThreadEvents(static_cast<uint32_t>(reg.threads.size())));
+				events = reg.threads.back().get();
+			}
+			return *events;
+		}
+
+		//! Current nesting depth of the calling thread
+		thread_local uint32_t zoneDepth = 0;
+
+		void writeJsonString(std::ostream& os, const char* str)
+		{
+			os << '"';
+			for (; *str; ++str)
+			{
+				if (*str == '"' || *str == '\\')
+					os << '\\';
+				os << *str;
+			}
+			os << '"';
+		}
+	}
+
+	uint64_t Profiler::now() noexcept
+	{
+#ifdef VCL_ABI_POSIX
+		timespec t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+		return uint64_t(t.tv_sec) * 1000000000ull + uint64_t(t.tv_nsec);
+#else
+		const auto t = std::chrono::steady_clock::now().time_since_epoch();
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t).count());
+#endif // VCL_ABI_POSIX
+	}
+
+	void Profiler::record(const char* name, uint64_t begin, uint64_t end, uint32_t depth) noexcept
+	{
+		auto& local = localEvents();
+
+		// Only this thread writes 'head', the release publishes the event to readers
+		const uint64_t head = local.head.load(std::memory_order_relaxed);
+		local.events[head % Capacity] = { name, begin, end, local.thread, depth };
+		local.head.store(head + 1, std::memory_order_release);
+	}
+
+	std::vector<ProfileEvent> Profiler::events()
+	{
+		std::vector<ProfileEvent> result;
+
+		auto& reg = registry();
+		std::lock_guard<std::mutex> guard{ reg.lock };
+		for (const auto& local : reg.threads)
+		{
+			const uint64_t head = local->head.load(std::memory_order_acquire);
+			const uint64_t tail = local->tail.load(std::memory_order_relaxed);
+			const uint64_t first = std::max(tail, head > Capacity ? head - Capacity : 0);
+			for (uint64_t i = first; i < head; i++)
+				result.push_back(local->events[i % Capacity]);
+		}
+
+		std::stable_sort(result.begin(), result.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+			return a.begin < b.begin;
+		});
+
+		return result;
+	}
+
+	void Profiler::clear()
+	{
+		auto& reg = registry();
+		std::lock_guard<std::mutex> guard{ reg.lock };
+		for (const auto& local : reg.threads)
+			local->tail.store(local->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+	}
+
+	void Profiler::writeChromeTrace(std::ostream& os)
+	{
+		const auto all_events = events();
+		const uint64_t origin = all_events.empty() ? 0 : all_events.front().begin;
+
+		// Time stamps are given in microseconds
+		const auto flags = os.flags();
+		os << std::fixed << std::setprecision(3);
+		os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		for (size_t i = 0; i < all_events.size(); i++)
+		{
+			const auto& e = all_events[i];
+			os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+			writeJsonString(os, e.name);
+			os << ",\"cat\":\"vcl\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+			   << ",\"ts\":" << double(e.begin - origin) / 1000.0
+			   << ",\"dur\":" << double(e.end - e.begin) / 1000.0
+			   << ",\"args\":{\"depth\":" << e.depth << "}}";
+		}
+		os << "\n]}\n";
+		os.flags(flags);
+	}
+
+	bool Profiler::writeChromeTrace(const std::string& path)
+	{
+		std::ofstream file{ path };
+		if (!file.is_open())
+			return false;
+
+		writeChromeTrace(file);
+		return file.good();
+	}
+
+	ProfileZone::ProfileZone(const char* name) noexcept
+	: _name(name)
+	, _depth(zoneDepth++)
+	{
+		_begin = Profiler::now();
+	}
+
+	ProfileZone::~ProfileZone()
+	{
+		const uint64_t end = Profiler::now();
+		zoneDepth--;
+		Profiler::record(_name, _begin, end, _depth);
+	}
+}}
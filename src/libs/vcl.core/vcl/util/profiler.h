@@ -0,0 +1,119 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/*!
+ *	Time the enclosing scope under 'name', which must be a string literal.
+ *	Zones only record data when VCL_ENABLE_PROFILING is set and are
+ *	compiled out otherwise.
+ */
+#ifdef VCL_ENABLE_PROFILING
+#	define VCL_PROFILE_ZONE(name) const ::Vcl::Util::ProfileZone VCL_PP_JOIN(vcl_profile_zone_, __LINE__){ name }
+#else
+#	define VCL_PROFILE_ZONE(name) ((void)0)
+#endif
+
+namespace Vcl { namespace Util {
+	//! Completed profiling zone
+	struct ProfileEvent
+	{
+		//! Name of the zone
+		const char* name;
+
+		//! Start time in nanoseconds
+		uint64_t begin;
+
+		//! End time in nanoseconds
+		uint64_t end;
+
+		//! Index of the recording thread
+		uint32_t thread;
+
+		//! Number of zones the event is nested in
+		uint32_t depth;
+	};
+
+	/*!
+	 *	Collects the profiling zones of all threads.
+	 *
+	 *	Every thread records into its own ring buffer without taking locks.
+	 *	Once a buffer is full, the oldest events are overwritten. Events
+	 *	should only be read or cleared while no zones are recorded.
+	 */
+	class Profiler
+	{
+	public:
+		//! Number of events kept per thread
+		static const size_t Capacity = 16384;
+
+		//! Monotonic time stamp in nanoseconds. Unaffected by the CPU time spent on other threads.
+		static uint64_t now() noexcept;
+
+		//! Record a zone of the calling thread
+		static void record(const char* name, uint64_t begin, uint64_t end, uint32_t depth) noexcept;
+
+		//! \returns the recorded events of all threads ordered by start time
+		static std::vector<ProfileEvent> events();
+
+		//! Discard all recorded events
+		static void clear();
+
+		//! Write the recorded events as Chrome trace (chrome://tracing, Perfetto)
+		static void writeChromeTrace(std::ostream& os);
+
+		//! \returns true if the trace could be written to 'path'
+		static bool writeChromeTrace(const std::string& path);
+	};
+
+	//! Records the time between construction and destruction
+	class ProfileZone
+	{
+	public:
+		explicit ProfileZone(const char* name) noexcept;
+		~ProfileZone();
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+	private:
+		//! Name of the zone
+		const char* _name;
+
+		//! Start of the zone
+		uint64_t _begin;
+
+		//! Nesting depth of the zone
+		uint32_t _depth;
+	};
+}}
@@ -25,51 +25,264 @@
 #include <vcl/util/stringparser.h>
 
 // C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <stdexcept>
-#include <sstream>
+
+// VCL
+#include <vcl/core/contract.h>
+
+#if defined(VCL_COMPILER_MSVC)
+#	include <intrin.h>
+#endif
 
 namespace Vcl { namespace Util {
+	namespace {
+		//! Index of the lowest set bit. 'mask' must not be zero.
+		VCL_STRONG_INLINE int firstSetBit(uint32_t mask)
+		{
+#if defined(VCL_COMPILER_MSVC)
+			unsigned long idx;
+			_BitScanForward(&idx, mask);
+			return static_cast<int>(idx);
+#else
+			return __builtin_ctz(mask);
+#endif
+		}
+
+		VCL_STRONG_INLINE bool isBlank(char c)
+		{
+			return c <= ' ' && c != '\n';
+		}
+
+		//! First line break in [ptr, end), or 'end'
+		const char* findNewLine(const char* ptr, const char* end)
+		{
+#ifdef VCL_VECTORIZE_SSE2
+			const __m128i new_line = _mm_set1_epi8('\n');
+			for (; ptr + 16 <= end; ptr += 16)
+			{
+				const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+				const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, new_line)));
+				if (mask != 0)
+					return ptr + firstSetBit(mask);
+			}
+#endif
+			while (ptr < end && *ptr != '\n')
+				++ptr;
+			return ptr;
+		}
+
+		//! First character in [ptr, end) which is not a blank, or 'end'
+		const char* skipBlanks(const char* ptr, const char* end)
+		{
+			// Tokens are mostly separated by a single character
+			if (ptr < end && !isBlank(*ptr))
+				return ptr;
+
+#ifdef VCL_VECTORIZE_SSE2
+			const __m128i new_line = _mm_set1_epi8('\n');
+			const __m128i limit = _mm_set1_epi8(' ' + 1);
+			for (; ptr + 16 <= end; ptr += 16)
+			{
+				const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+				const __m128i blank = _mm_andnot_si128(_mm_cmpeq_epi8(c, new_line), _mm_cmplt_epi8(c, limit));
+				const uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(blank)) & 0xffff;
+				if (mask != 0)
+					return ptr + firstSetBit(mask);
+			}
+#endif
+			while (ptr < end && isBlank(*ptr))
+				++ptr;
+			return ptr;
+		}
+
+		//! First blank or line break in [ptr, end), or 'end'
+		const char* findBlank(const char* ptr, const char* end)
+		{
+#ifdef VCL_VECTORIZE_SSE2
+			const __m128i limit = _mm_set1_epi8(' ' + 1);
+			for (; ptr + 16 <= end; ptr += 16)
+			{
+				const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+				const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(c, limit)));
+				if (mask != 0)
+					return ptr + firstSetBit(mask);
+			}
+#endif
+			while (ptr < end && *ptr > ' ')
+				++ptr;
+			return ptr;
+		}
+
+		VCL_STRONG_INLINE bool isDigit(char c)
+		{
+			return c >= '0' && c <= '9';
+		}
+
+		/*!
+		 *	Convert [begin, end) to a float.
+		 *
+		 *	Numbers with at most 19 significant digits, a mantissa below 2^53
+		 *	and a decimal exponent within [-22, 22] are computed exactly
+		 *	rounded in double precision. As all rounding boundaries of floats
+		 *	are doubles, rounding the result to float is correct unless it
+		 *	hits a boundary exactly. All other numbers use 'strtof'.
+		 */
+		bool parseFloat(const char* begin, const char* end, float* value)
+		{
+			static const double powers_of_ten[] = {
+				1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+				1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+			};
+
+			const char* ptr = begin;
+			const bool negative = ptr < end && *ptr == '-';
+			if (ptr < end && (*ptr == '-' || *ptr == '+'))
+				++ptr;
+
+			uint64_t mantissa = 0;
+			int nr_digits = 0;
+			int nr_significant = 0;
+			int exponent = 0;
+			for (; ptr < end && isDigit(*ptr); ++ptr, ++nr_digits)
+			{
+				if (mantissa == 0 && *ptr == '0')
+					continue;
+
+				mantissa = 10 * mantissa + static_cast<uint64_t>(*ptr - '0');
+				nr_significant++;
+			}
+			if (ptr < end && *ptr == '.')
+			{
+				for (++ptr; ptr < end && isDigit(*ptr); ++ptr, ++nr_digits)
+				{
+					exponent--;
+					if (mantissa == 0 && *ptr == '0')
+						continue;
+
+					mantissa = 10 * mantissa + static_cast<uint64_t>(*ptr - '0');
+					nr_significant++;
+				}
+			}
+			if (nr_digits == 0)
+				return false;
+
+			if (ptr < end && (*ptr == 'e' || *ptr == 'E'))
+			{
+				++ptr;
+				const bool negative_exponent = ptr < end && *ptr == '-';
+				if (ptr < end && (*ptr == '-' || *ptr == '+'))
+					++ptr;
+
+				int e = 0;
+				for (; ptr < end && isDigit(*ptr); ++ptr)
+				{
+					if (e < 10000)
+						e = 10 * e + (*ptr - '0');
+				}
+				exponent += negative_exponent ? -e : e;
+			}
+
+			if (ptr == end && nr_significant <= 19 && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+			{
+				double d = static_cast<double>(mantissa);
+				d = exponent < 0 ? d / powers_of_ten[-exponent] : d * powers_of_ten[exponent];
+
+				// Bits of the double mantissa not stored in a float
+				uint64_t bits;
+				std::memcpy(&bits, &d, sizeof(bits));
+				const uint64_t dropped = bits & ((uint64_t(1) << 29) - 1);
+				if (mantissa == 0 || dropped != (uint64_t(1) << 28))
+				{
+					const float f = static_cast<float>(d);
+					*value = negative ? -f : f;
+					return true;
+				}
+			}
+
+			// Fall back to the standard library for the remaining numbers
+			char buffer[64];
+			const size_t length = static_cast<size_t>(end - begin);
+			if (length < sizeof(buffer))
+			{
+				std::memcpy(buffer, begin, length);
+				buffer[length] = '\0';
+				*value = std::strtof(buffer, nullptr);
+			} else
+			{
+				*value = std::strtof(std::string(begin, end).c_str(), nullptr);
+			}
+			return true;
+		}
+	}
+
 	StringParser::StringParser()
-	: _streamBuffer(BufferSize)
-	, _currentBuffer(_streamBuffer.data())
-	, _bufferReadPtr(_currentBuffer)
 	{
 	}
 
 	void StringParser::setInputStream(std::istream* stream)
 	{
 		_stream = stream;
+		_file.close();
+		_streamBuffer.resize(BufferSize);
 
 		// Reset the pointers
 		_currentBuffer = _streamBuffer.data();
+		_currentSizeAvailable = 0;
+		_bufferReadPtr = _currentBuffer;
+		_eos = false;
+	}
+
+	void StringParser::setInputBuffer(const char* data, size_t size)
+	{
+		_stream = nullptr;
+		_file.close();
+
+		_currentBuffer = data;
+		_currentSizeAvailable = size;
 		_bufferReadPtr = _currentBuffer;
+		_eos = false;
+	}
+
+	bool StringParser::setInputFile(const std::string& path)
+	{
+		MemoryMappedFile file;
+		if (!file.open(path))
+			return false;
+
+		setInputBuffer(file.data(), file.size());
+		_file = std::move(file);
+		return true;
 	}
 
 	bool StringParser::loadLine()
 	{
-		// Check if a full line is still available
-		char* current_pointer = _bufferReadPtr;
-		while (current_pointer < _currentBuffer + _currentSizeAvailable)
+		// The complete input is available when parsing from memory
+		if (!_stream)
 		{
-			if ((*current_pointer) == '\n')
-			{
-				return true;
-			}
-			++current_pointer;
+			_eos = _bufferReadPtr >= bufferEnd();
+			return !_eos;
 		}
 
+		// Check if a full line is still available
+		if (findNewLine(_bufferReadPtr, bufferEnd()) != bufferEnd())
+			return true;
+
 		// Else, there is no full line available.
 		// Copy any remaining data to the beginning and fill up the buffer with new data
+		char* buffer = _streamBuffer.data();
 		bool full_line_available = false;
 		while (!full_line_available)
 		{
 			// Copy the remaining data to the front
-			const auto copy_amount = static_cast<size_t>((_currentBuffer + _currentSizeAvailable) - _bufferReadPtr);
-			if (copy_amount > 0 && _bufferReadPtr != _currentBuffer)
+			const auto copy_amount = static_cast<size_t>(bufferEnd() - _bufferReadPtr);
+			if (copy_amount > 0 && _bufferReadPtr != buffer)
 			// There was some data read, move the remaining
 			{
-				memmove(_currentBuffer, _bufferReadPtr, copy_amount);
+				memmove(buffer, _bufferReadPtr, copy_amount);
 			} else if (copy_amount == 0 && _stream->eof())
 			// All data was read and we're are at the end of the stream
 			{
@@ -78,7 +291,7 @@ namespace Vcl { namespace Util {
 			}
 
 			// We want to fill the buffer again
-			_bufferReadPtr = _currentBuffer;
+			_bufferReadPtr = buffer;
 			_currentSizeAvailable = copy_amount;
 
 			if (_stream->eof())
@@ -87,7 +300,7 @@ namespace Vcl { namespace Util {
 				continue;
 			}
 
-			_stream->read(_currentBuffer + _currentSizeAvailable, static_cast<std::streamsize>(BufferSize - _currentSizeAvailable));
+			_stream->read(buffer + _currentSizeAvailable, static_cast<std::streamsize>(BufferSize - _currentSizeAvailable));
 			const auto amount_read = _stream->gcount();
 			if (amount_read == 0)
 			{
@@ -95,16 +308,7 @@ namespace Vcl { namespace Util {
 			}
 			_currentSizeAvailable += static_cast<size_t>(amount_read);
 
-			current_pointer = _bufferReadPtr;
-			while (current_pointer < _currentBuffer + _currentSizeAvailable)
-			{
-				if ((*current_pointer) == '\n')
-				{
-					full_line_available = true;
-					break;
-				}
-				++current_pointer;
-			}
+			full_line_available = findNewLine(_bufferReadPtr, bufferEnd()) != bufferEnd();
 		}
 
 		return full_line_available;
@@ -112,19 +316,13 @@ namespace Vcl { namespace Util {
 
 	void StringParser::skipWhiteSpace()
 	{
-		while (_bufferReadPtr < _currentBuffer + _currentSizeAvailable && (*_bufferReadPtr) <= ' ' && (*_bufferReadPtr) != '\n')
-		{
-			++_bufferReadPtr;
-		}
+		_bufferReadPtr = skipBlanks(_bufferReadPtr, bufferEnd());
 	}
 
 	void StringParser::skipLine()
 	{
-		while (_bufferReadPtr < _currentBuffer + _currentSizeAvailable && (*_bufferReadPtr) != '\n')
-		{
-			++_bufferReadPtr;
-		}
-		if (_bufferReadPtr < _currentBuffer + _currentSizeAvailable)
+		_bufferReadPtr = findNewLine(_bufferReadPtr, bufferEnd());
+		if (_bufferReadPtr < bufferEnd())
 		{
 			++_bufferReadPtr;
 		}
@@ -135,15 +333,7 @@ namespace Vcl { namespace Util {
 		const char* begin_ptr = _bufferReadPtr;
 		skipLine();
 
-		// Store the end-pointer and terminate the string
-		char c = *_bufferReadPtr;
-		*_bufferReadPtr = '\0';
-
-		// Store the string
-		*out_string_ptr = begin_ptr;
-
-		// Restore the stored end-pointer
-		*_bufferReadPtr = c;
+		out_string_ptr->assign(begin_ptr, _bufferReadPtr);
 	}
 
 	bool StringParser::readString(std::string* out_string_ptr)
@@ -151,26 +341,13 @@ namespace Vcl { namespace Util {
 		skipWhiteSpace();
 
 		const char* begin_ptr = _bufferReadPtr;
-		while ((*_bufferReadPtr) > ' ')
-		{
-			++_bufferReadPtr;
-		}
-
+		_bufferReadPtr = findBlank(_bufferReadPtr, bufferEnd());
 		if (_bufferReadPtr == begin_ptr)
 		{
 			return false;
 		}
 
-		// Store the end-pointer and terminate the string
-		char c = *_bufferReadPtr;
-		*_bufferReadPtr = '\0';
-
-		// Store the string
-		*out_string_ptr = begin_ptr;
-
-		// Restore the stored end-pointer
-		*_bufferReadPtr = c;
-
+		out_string_ptr->assign(begin_ptr, _bufferReadPtr);
 		return true;
 	}
 
@@ -180,12 +357,15 @@ namespace Vcl { namespace Util {
 
 		// Find the end of the number
 		const char* begin_ptr = _bufferReadPtr;
+		const char* end_ptr = bufferEnd();
 		while (
-			((*_bufferReadPtr) >= '0' && (*_bufferReadPtr) <= '9') ||
-			(*_bufferReadPtr) == '.' ||
-			(*_bufferReadPtr) == '-' ||
-			(*_bufferReadPtr) == 'E' ||
-			(*_bufferReadPtr) == 'e')
+			_bufferReadPtr < end_ptr &&
+			(isDigit(*_bufferReadPtr) ||
+			 (*_bufferReadPtr) == '.' ||
+			 (*_bufferReadPtr) == '-' ||
+			 (*_bufferReadPtr) == '+' ||
+			 (*_bufferReadPtr) == 'E' ||
+			 (*_bufferReadPtr) == 'e'))
 		{
 			++_bufferReadPtr;
 		}
@@ -195,17 +375,16 @@ namespace Vcl { namespace Util {
 			return false;
 		}
 
-		// Store the end-pointer and terminate the string
-		char c = *_bufferReadPtr;
-		*_bufferReadPtr = '\0';
-
-		// Convert the string to a float
-		*f_ptr = static_cast<float>(atof(begin_ptr));
+		return parseFloat(begin_ptr, _bufferReadPtr, f_ptr);
+	}
 
-		// Restore the stored end-pointer
-		*_bufferReadPtr = c;
+	size_t StringParser::readFloats(stdext::span<float> values)
+	{
+		size_t nr_values = 0;
+		while (nr_values < values.size() && readFloat(values.data() + nr_values))
+			nr_values++;
 
-		return true;
+		return nr_values;
 	}
 
 	bool StringParser::readInt(int* i_ptr)
@@ -214,8 +393,8 @@ namespace Vcl { namespace Util {
 
 		// Find the end of the number
 		const char* begin_ptr = _bufferReadPtr;
-		while (((*_bufferReadPtr) >= '0' && (*_bufferReadPtr) <= '9') ||
-			   (*_bufferReadPtr) == '-')
+		const char* end_ptr = bufferEnd();
+		while (_bufferReadPtr < end_ptr && (isDigit(*_bufferReadPtr) || (*_bufferReadPtr) == '-'))
 		{
 			++_bufferReadPtr;
 		}
@@ -225,16 +404,46 @@ namespace Vcl { namespace Util {
 			return false;
 		}
 
-		// Store the end-pointer and terminate the string
-		char c = *_bufferReadPtr;
-		*_bufferReadPtr = '\0';
-
 		// Convert the string to an int
-		*i_ptr = atoi(begin_ptr);
+		const char* ptr = begin_ptr;
+		const bool negative = *ptr == '-';
+		if (negative)
+			++ptr;
+
+		int64_t value = 0;
+		for (; ptr < _bufferReadPtr && isDigit(*ptr); ++ptr)
+			value = 10 * value + (*ptr - '0');
 
-		// Restore the stored end-pointer
-		*_bufferReadPtr = c;
+		*i_ptr = static_cast<int>(negative ? -value : value);
 
 		return true;
 	}
+	std::vector<stdext::span<const char>> splitAtLineBreaks(stdext::span<const char> buffer, size_t max_chunks, size_t min_chunk_size)
+	{
+		VclRequire(max_chunks > 0, "At least one chunk is requested.");
+
+		const size_t nr_chunks = std::max<size_t>(1, std::min(max_chunks, buffer.size() / std::max<size_t>(1, min_chunk_size)));
+		const size_t chunk_size = buffer.size() / nr_chunks;
+
+		std::vector<stdext::span<const char>> chunks;
+		chunks.reserve(nr_chunks);
+
+		// Move each nominal split point forward to the next line break
+		const char* const end = buffer.data() + buffer.size();
+		const char* begin = buffer.data();
+		for (size_t c = 1; c < nr_chunks && begin < end; c++)
+		{
+			const char* split = std::max(begin, buffer.data() + c * chunk_size);
+			split = findNewLine(split, end);
+			if (split < end)
+				++split;
+
+			chunks.emplace_back(begin, static_cast<size_t>(split - begin));
+			begin = split;
+		}
+		if (begin < end || chunks.empty())
+			chunks.emplace_back(begin, static_cast<size_t>(end - begin));
+
+		return chunks;
+	}
 }}
@@ -34,8 +34,17 @@
 #include <vector>
 
 // VCL
+#include <vcl/core/span.h>
+#include <vcl/util/memorymappedfile.h>
 
 namespace Vcl { namespace Util {
+	/*!
+	 *	Line-based tokenizer for text files.
+	 *
+	 *	Data is either read from a stream through an intermediate buffer,
+	 *	or parsed in-place from a memory buffer or a memory-mapped file.
+	 *	The parser never writes to its input.
+	 */
 	class StringParser
 	{
 	public:
@@ -46,6 +55,16 @@ namespace Vcl { namespace Util {
 
 	public:
 		void setInputStream(std::istream* stream);
+
+		//! Parse 'size' bytes at 'data' without copying. The buffer must outlive the parser.
+		void setInputBuffer(const char* data, size_t size);
+
+		/*!
+		 *	Map the file at 'path' and parse it in-place
+		 *	\returns true if the file could be mapped
+		 */
+		bool setInputFile(const std::string& path);
+
 		bool loadLine();
 		void readLine(std::string* out_string_ptr);
 		void skipWhiteSpace();
@@ -54,10 +73,22 @@ namespace Vcl { namespace Util {
 		bool readFloat(float* f_ptr);
 		bool readInt(int* i_ptr);
 
+		/*!
+		 *	Read consecutive floats on the current line
+		 *	\returns the number of floats read, which stops at the first entry not being a number
+		 */
+		size_t readFloats(stdext::span<float> values);
+
+	private:
+		const char* bufferEnd() const { return _currentBuffer + _currentSizeAvailable; }
+
 	private: // Parser state
 		//! Stream to parse data from
 		std::istream* _stream{ nullptr };
 
+		//! Mapped file to parse data from
+		MemoryMappedFile _file;
+
 		//! Size of the parse buffer
 		static const size_t BufferSize{ 512 * 1024 };
 
@@ -65,15 +96,25 @@ namespace Vcl { namespace Util {
 		std::vector<char> _streamBuffer;
 
 		//! Start of the current buffer
-		char* _currentBuffer{ nullptr };
+		const char* _currentBuffer{ nullptr };
 
 		//! Size of the current buffer
 		size_t _currentSizeAvailable{ 0 };
 
 		//! Current read pointer
-		char* _bufferReadPtr{ nullptr };
+		const char* _bufferReadPtr{ nullptr };
 
 		//! Reached end of stream?
 		bool _eos{ false };
 	};
+
+	/*!
+	 *	Split a text buffer into ranges which can be parsed independently.
+	 *
+	 *	\param buffer         Text to split
+	 *	\param max_chunks     Maximum number of ranges to create
+	 *	\param min_chunk_size Ranges are not made smaller than this number of bytes
+	 *	\returns Consecutive ranges covering 'buffer'. All but the last end directly after a line break.
+	 */
+	std::vector<stdext::span<const char>> splitAtLineBreaks(stdext::span<const char> buffer, size_t max_chunks, size_t min_chunk_size = 256 * 1024);
 }}
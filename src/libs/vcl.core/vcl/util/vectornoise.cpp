@@ -34,6 +34,14 @@ namespace Vcl { namespace Util {
 		_noise3 = std::make_unique<WaveletNoise<N>>();
 	}
 
+	template<int N>
+	VectorNoise<N>::VectorNoise(unsigned int seed, const std::string& cache_dir)
+	{
+		_noise1 = std::make_unique<WaveletNoise<N>>(seed + 0, cache_dir);
+		_noise2 = std::make_unique<WaveletNoise<N>>(seed + 1, cache_dir);
+		_noise3 = std::make_unique<WaveletNoise<N>>(seed + 2, cache_dir);
+	}
+
 	template<int N>
 	VectorNoise<N>::~VectorNoise() = default;
 
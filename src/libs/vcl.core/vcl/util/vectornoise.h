@@ -30,6 +30,7 @@
 
 // C++ standard libary
 #include <memory>
+#include <string>
 
 // VCL
 #include <vcl/util/waveletnoise.h>
@@ -43,6 +44,13 @@ namespace Vcl { namespace Util {
 	{
 	public:
 		VectorNoise();
+
+		/*!
+		 *	Construct the noise tiles from 'seed'.
+		 *	\param seed      Seed of the first tile, the others use the following seeds
+		 *	\param cache_dir Directory of the tile cache files, an empty path disables the cache
+		 */
+		explicit VectorNoise(unsigned int seed, const std::string& cache_dir = {});
 		~VectorNoise();
 
 	public: // Evaluation
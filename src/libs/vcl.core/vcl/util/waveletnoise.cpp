@@ -22,6 +22,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include <vcl/core/concurrency/parallel.h>
 #include <vcl/core/simd/memory.h>
 #include <vcl/core/simd/vectorscalar.h>
 
@@ -29,10 +30,18 @@
 #include <vcl/util/waveletnoise.h>
 #include <vcl/util/waveletnoise_helpers.h>
 #include <vcl/util/waveletnoise_modulo.h>
+#include <vcl/util/profiler.h>
 
 // C++ standard library
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
 
 // Disable the core-guideline checker until this file is refactored
 #if defined(VCL_COMPILER_MSVC) && defined(VCL_CHECK_CORE_GUIDELINES) && (_MSC_VER >= 1910)
@@ -134,6 +143,164 @@ namespace {
 		return result;
 	}
 #undef ADD_WEIGHTED
+
+	//! Interpolate the noise at the lanes of 'p', gathering each of the 27 taps with a single vector gather
+	template<int N, int Width>
+	Vcl::VectorScalar<float, Width> interpolate(const Eigen::Matrix<Vcl::VectorScalar<float, Width>, 3, 1>& p, const float* data) noexcept
+	{
+		using real_t = Vcl::VectorScalar<float, Width>;
+		using int_t = Vcl::VectorScalar<int, Width>;
+
+		using Vcl::load;
+		using Vcl::store;
+
+		// Evaluate the quadratic B-spline basis functions per lane
+		alignas(64) std::array<float, Width> coords;
+		alignas(64) std::array<std::array<int, Width>, 3> mid;
+		alignas(64) std::array<std::array<std::array<float, Width>, 3>, 3> weights;
+		for (int a = 0; a < 3; a++)
+		{
+			store(coords.data(), p(a));
+			for (int l = 0; l < Width; l++)
+			{
+				std::array<float, 3> w;
+				Vcl::Util::Details::evaluateQuadraticSplineBasis(coords[l], w, mid[a][l]);
+				weights[a][0][l] = w[0];
+				weights[a][1][l] = w[1];
+				weights[a][2][l] = w[2];
+			}
+		}
+
+		std::array<int_t, 3> mid_v;
+		std::array<std::array<real_t, 3>, 3> w_v;
+		for (int a = 0; a < 3; a++)
+		{
+			load(mid_v[a], mid[a].data());
+			for (int i = 0; i < 3; i++)
+				load(w_v[a][i], weights[a][i].data());
+		}
+
+		// Accumulate the weighted noise coefficients
+		real_t result{ 0.0f };
+		for (int z = -1; z <= 1; z++)
+		{
+			const int_t z_offset = Vcl::Util::FastMath<N>::modulo(mid_v[2] + int_t(z)) * int_t(N * N);
+			for (int y = -1; y <= 1; y++)
+			{
+				const int_t yz_offset = z_offset + Vcl::Util::FastMath<N>::modulo(mid_v[1] + int_t(y)) * int_t(N);
+				const real_t yz_weight = w_v[1][y + 1] * w_v[2][z + 1];
+				for (int x = -1; x <= 1; x++)
+				{
+					const int_t idx = yz_offset + Vcl::Util::FastMath<N>::modulo(mid_v[0] + int_t(x));
+					result += w_v[0][x + 1] * yz_weight * gather(data, idx);
+				}
+			}
+		}
+
+		return result;
+	}
+
+	//! Sum of the scaled noise bands, normalized to a variance of 1
+	template<int N, int Width>
+	Vcl::VectorScalar<float, Width> interpolateBands(const Eigen::Matrix<Vcl::VectorScalar<float, Width>, 3, 1>& p, float s, int first_band, int nr_bands, stdext::span<const float> w, const float* data) noexcept
+	{
+		using real_t = Vcl::VectorScalar<float, Width>;
+
+		// The band selection only depends on 's', thus is uniform for all lanes
+		real_t result{ 0.0f };
+		for (int b = 0; b < nr_bands && s + static_cast<float>(first_band + b) < 0; b++)
+		{
+			const real_t scale{ 2.0f * static_cast<float>(std::pow(2.0f, first_band + b)) };
+
+			Eigen::Matrix<real_t, 3, 1> q;
+			for (int i = 0; i < 3; i++)
+				q(i) = p(i) * scale;
+
+			result += real_t(w[b]) * interpolate<N, Width>(q, data);
+		}
+
+		float variance = 0;
+		for (int b = 0; b < nr_bands; b++)
+			variance += w[b] * w[b];
+
+		// Adjust the noise so it has a variance of 1
+		if (variance > 0)
+			result *= real_t(1.0f / sqrtf(variance * 0.210f));
+
+		return result;
+	}
+
+	//! Evaluate 'func' for blocks of 'Width' points. The last block is padded by repeating its last point.
+	template<int Width, typename Func>
+	void evaluateBlocks(stdext::span<const std::array<float, 3>> points, stdext::span<float> values, Func&& func)
+	{
+		using real_t = Vcl::VectorScalar<float, Width>;
+
+		using Vcl::load;
+		using Vcl::store;
+
+		alignas(64) std::array<std::array<float, Width>, 3> coords;
+		alignas(64) std::array<float, Width> result;
+		for (size_t i = 0; i < points.size(); i += Width)
+		{
+			const size_t n = std::min<size_t>(Width, points.size() - i);
+			for (size_t l = 0; l < Width; l++)
+			{
+				const auto& q = points[i + std::min(l, n - 1)];
+				coords[0][l] = q[0];
+				coords[1][l] = q[1];
+				coords[2][l] = q[2];
+			}
+
+			Eigen::Matrix<real_t, 3, 1> p;
+			load(p(0), coords[0].data());
+			load(p(1), coords[1].data());
+			load(p(2), coords[2].data());
+
+			store(result.data(), func(p));
+			std::copy_n(result.begin(), n, values.begin() + i);
+		}
+	}
+
+	//! Header of a noise tile cache file, padded to keep the tile data cache-line aligned
+	struct TileFileHeader
+	{
+		char magic[8];
+		uint32_t size;
+		uint32_t seed;
+		float min;
+		float max;
+		char padding[40];
+	};
+	static_assert(sizeof(TileFileHeader) == 64, "Header covers one cache-line");
+
+	constexpr char TileFileMagic[8] = { 'V', 'C', 'L', 'N', 'O', 'I', 'S', '1' };
+
+	//! Draw the normal distributed random numbers the noise tile is generated from
+	template<int N>
+	std::vector<float> makeNoiseBase(std::mt19937& rnd_gen)
+	{
+		constexpr int n3 = N * N * N;
+
+		std::normal_distribution<float> normal;
+		std::vector<float> noise_data_base;
+		noise_data_base.reserve(n3);
+
+		std::generate_n(std::back_inserter(noise_data_base), n3, [&normal, &rnd_gen]() {
+			return normal(rnd_gen);
+		});
+
+		return noise_data_base;
+	}
+
+	// Width of the native vector registers used for batched evaluation
+#if defined(VCL_VECTORIZE_AVX512)
+	constexpr int BatchWidth = 16;
+#elif defined(VCL_VECTORIZE_AVX)
+	constexpr int BatchWidth = 8;
+#else
+	constexpr int BatchWidth = 4;
+#endif
 }
 
 namespace Vcl { namespace Util {
@@ -154,18 +321,21 @@ namespace Vcl { namespace Util {
 	template<int N>
 	WaveletNoise<N>::WaveletNoise(std::mt19937& rnd_gen)
 	{
-		constexpr int n3 = N * N * N;
+		// Step 1. Fill the tile with random numbers in the range -1 to 1.
+		initializeNoise(makeNoiseBase<N>(rnd_gen));
+	}
 
-		std::normal_distribution<float> normal;
-		std::vector<float> noise_data_base;
-		noise_data_base.reserve(n3);
+	template<int N>
+	WaveletNoise<N>::WaveletNoise(unsigned int seed, const std::string& cache_dir)
+	{
+		const std::string path = cache_dir + "/waveletnoise_" + std::to_string(N) + "_" + std::to_string(seed) + ".bin";
+		if (!cache_dir.empty() && loadTile(path, seed))
+			return;
 
-		// Step 1. Fill the tile with random numbers in the range -1 to 1.
-		std::generate_n(std::back_inserter(noise_data_base), n3, [&normal, &rnd_gen]() {
-			return normal(rnd_gen);
-		});
+		initializeNoise(makeNoiseBase<N>(*make_twister(seed)));
 
-		initializeNoise(noise_data_base);
+		if (!cache_dir.empty())
+			storeTile(path, seed);
 	}
 
 	template<int N>
@@ -180,63 +350,77 @@ namespace Vcl { namespace Util {
 		static_assert(N >= 0, "N >= 0");
 		static_assert(N % 2 == 0, "N is even");
 
+		VCL_PROFILE_ZONE("WaveletNoise::initializeNoise");
+
 		constexpr int n3 = N * N * N;
 
 		std::vector<float> temp1(n3, 0);
 		std::vector<float> temp2(n3, 0);
 
-		// Steps 2 and 3. Downsample and upsample the tile
-		for (int iy = 0; iy < N; iy++)
-		{
-			for (int iz = 0; iz < N; iz++)
+		// Steps 2 and 3. Downsample and upsample the tile.
+		// The filters along one axis are independent, thus each pass
+		// processes the slices orthogonal to another axis in parallel.
+		Core::parallel_for(0, N, 1, [&](size_t first, size_t last) {
+			for (int iz = static_cast<int>(first); iz < static_cast<int>(last); iz++)
 			{
-				const int i = iy * N + iz * N * N;
-				downsample<N>(stdext::make_span(&noise_data_base[i], N), stdext::make_span(&temp1[i], N), N, 1);
-				upsample<N>(stdext::make_span(&temp1[i], N), stdext::make_span(&temp2[i], N), N, 1);
+				for (int iy = 0; iy < N; iy++)
+				{
+					const int i = iy * N + iz * N * N;
+					downsample<N>(stdext::make_span(&noise_data_base[i], N), stdext::make_span(&temp1[i], N), N, 1);
+					upsample<N>(stdext::make_span(&temp1[i], N), stdext::make_span(&temp2[i], N), N, 1);
+				}
 			}
-		}
-		for (int ix = 0; ix < N; ix++)
-		{
-			for (int iz = 0; iz < N; iz++)
+		});
+		Core::parallel_for(0, N, 1, [&](size_t first, size_t last) {
+			for (int iz = static_cast<int>(first); iz < static_cast<int>(last); iz++)
 			{
-				const int i = ix + iz * N * N;
-				downsample<N>(stdext::make_span(&temp2[i], N + N * N), stdext::make_span(&temp1[i], N + N * N), N, N);
-				upsample<N>(stdext::make_span(&temp1[i], N + N * N), stdext::make_span(&temp2[i], N + N * N), N, N);
+				for (int ix = 0; ix < N; ix++)
+				{
+					const int i = ix + iz * N * N;
+					downsample<N>(stdext::make_span(&temp2[i], N + N * N), stdext::make_span(&temp1[i], N + N * N), N, N);
+					upsample<N>(stdext::make_span(&temp1[i], N + N * N), stdext::make_span(&temp2[i], N + N * N), N, N);
+				}
 			}
-		}
-		for (int ix = 0; ix < N; ix++)
-		{
-			for (int iy = 0; iy < N; iy++)
+		});
+		Core::parallel_for(0, N, 1, [&](size_t first, size_t last) {
+			for (int iy = static_cast<int>(first); iy < static_cast<int>(last); iy++)
 			{
-				const int i = ix + iy * N;
-				downsample<N>(stdext::make_span(&temp2[i], N * N * N), stdext::make_span(&temp1[i], N * N * N), N, N * N);
-				upsample<N>(stdext::make_span(&temp1[i], N * N * N), stdext::make_span(&temp2[i], N * N * N), N, N * N);
+				for (int ix = 0; ix < N; ix++)
+				{
+					const int i = ix + iy * N;
+					downsample<N>(stdext::make_span(&temp2[i], N * N * N), stdext::make_span(&temp1[i], N * N * N), N, N * N);
+					upsample<N>(stdext::make_span(&temp1[i], N * N * N), stdext::make_span(&temp2[i], N * N * N), N, N * N);
+				}
 			}
-		}
+		});
 
 		// Step 4. Subtract out the coarse-scale contribution
-		_noiseTileData.reserve(n3);
-		for (int i = 0; i < n3; i++)
-		{
-			_noiseTileData.emplace_back(noise_data_base[i] - temp2[i]);
-		}
+		_noiseTileData.resize(n3);
+		Core::parallel_for(0, n3, Core::CacheLineGranularity<float>::value, [&](size_t first, size_t last) {
+			for (size_t i = first; i < last; i++)
+			{
+				_noiseTileData[i] = noise_data_base[i] - temp2[i];
+			}
+		});
 
 		// Avoid even/odd variance difference by adding odd-offset version of noise to itself.
 		int offset = N / 2;
 		if (offset % 2 == 0) { offset++; }
 
-		int icnt = 0;
-		for (int ix = 0; ix < N; ix++)
-		{
-			for (int iy = 0; iy < N; iy++)
+		Core::parallel_for(0, N, 1, [&](size_t first, size_t last) {
+			for (int ix = static_cast<int>(first); ix < static_cast<int>(last); ix++)
 			{
-				for (int iz = 0; iz < N; iz++)
+				int icnt = ix * N * N;
+				for (int iy = 0; iy < N; iy++)
 				{
-					temp1[icnt] = _noiseTileData[FastMath<N>::modulo(ix + offset) + FastMath<N>::modulo(iy + offset) * N + FastMath<N>::modulo(iz + offset) * N * N];
-					icnt++;
+					for (int iz = 0; iz < N; iz++)
+					{
+						temp1[icnt] = _noiseTileData[FastMath<N>::modulo(ix + offset) + FastMath<N>::modulo(iy + offset) * N + FastMath<N>::modulo(iz + offset) * N * N];
+						icnt++;
+					}
 				}
 			}
-		}
+		});
 
 		_min = std::numeric_limits<float>::max();
 		_max = -std::numeric_limits<float>::max();
@@ -250,6 +434,71 @@ namespace Vcl { namespace Util {
 		}
 	}
 
+	template<int N>
+	stdext::span<const float> WaveletNoise<N>::tile() const noexcept
+	{
+		if (_noiseTileFile)
+			return { reinterpret_cast<const float*>(_noiseTileFile->data() + sizeof(TileFileHeader)), N * N * N };
+
+		return _noiseTileData;
+	}
+
+	template<int N>
+	bool WaveletNoise<N>::loadTile(const std::string& path, unsigned int seed)
+	{
+		auto file = std::make_shared<MemoryMappedFile>();
+		if (!file->open(path))
+			return false;
+
+		// Reject files of other tile sizes, seeds or incomplete writes
+		if (file->size() != sizeof(TileFileHeader) + N * N * N * sizeof(float))
+			return false;
+
+		TileFileHeader header;
+		std::memcpy(&header, file->data(), sizeof(TileFileHeader));
+		if (std::memcmp(header.magic, TileFileMagic, sizeof(TileFileMagic)) != 0 || header.size != static_cast<uint32_t>(N) || header.seed != seed)
+			return false;
+
+		_min = header.min;
+		_max = header.max;
+		_noiseTileFile = std::move(file);
+		return true;
+	}
+
+	template<int N>
+	void WaveletNoise<N>::storeTile(const std::string& path, unsigned int seed) const
+	{
+		TileFileHeader header = {};
+		std::memcpy(header.magic, TileFileMagic, sizeof(TileFileMagic));
+		header.size = N;
+		header.seed = seed;
+		header.min = _min;
+		header.max = _max;
+
+		// Write to a temporary file first, so concurrent readers never see a partial tile.
+		// The name is unique per writer, such that processes creating the same tile do not
+		// write into each other's file.
+		std::random_device rd;
+		std::ostringstream tmp_name;
+		tmp_name << path << "." << std::hex << rd() << rd() << ".tmp";
+		const std::string tmp_path = tmp_name.str();
+		{
+			std::ofstream file(tmp_path, std::ios_base::binary | std::ios_base::trunc);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(TileFileHeader));
+			file.write(reinterpret_cast<const char*>(_noiseTileData.data()), _noiseTileData.size() * sizeof(float));
+			if (!file)
+			{
+				file.close();
+				std::remove(tmp_path.c_str());
+				return;
+			}
+		}
+
+		// The cache is optional, failing to publish the file is not an error
+		if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+			std::remove(tmp_path.c_str());
+	}
+
 	template<int N>
 	float WaveletNoise<N>::evaluate(const Vec3& p) const noexcept
 	{
@@ -261,12 +510,14 @@ namespace Vcl { namespace Util {
 		evaluateQuadraticSplineBasis(p[2], w[2], mid[2]);
 
 		// Loop over the noise coefficients within the bound
-		return interpolate<N>(mid[0], mid[1], mid[2], w, _noiseTileData);
+		return interpolate<N>(mid[0], mid[1], mid[2], w, tile());
 	}
 
 	template<int N>
 	float WaveletNoise<N>::evaluate(const Vec3& p, const Vec3& normal) const
 	{
+		const stdext::span<const float> data = tile();
+
 		std::array<int, 3> c, minimum, maximum;
 		float result = 0.0f;
 
@@ -304,7 +555,7 @@ namespace Vcl { namespace Util {
 					}
 
 					// Evaluate noise by weighting noise coefficients by basis function values
-					result += weight * _noiseTileData[FastMath<N>::modulo(c[2]) * N * N + FastMath<N>::modulo(c[1]) * N + FastMath<N>::modulo(c[0])];
+					result += weight * data[FastMath<N>::modulo(c[2]) * N * N + FastMath<N>::modulo(c[1]) * N + FastMath<N>::modulo(c[0])];
 				}
 			}
 		}
@@ -352,7 +603,7 @@ namespace Vcl { namespace Util {
 		evaluateQuadraticSplineBasis(p[2], w[2], mid[2]);
 
 		// Evaluate noise by weighting noise coefficients by basis function values
-		return interpolate<N>(mid[0], mid[1], mid[2], w, _noiseTileData);
+		return interpolate<N>(mid[0], mid[1], mid[2], w, tile());
 	}
 
 	template<int N>
@@ -366,7 +617,7 @@ namespace Vcl { namespace Util {
 		evaluateQuadraticSplineBasis(p[2], w[2], mid[2]);
 
 		// Evaluate noise by weighting noise coefficients by basis function values
-		return interpolate<N>(mid[0], mid[1], mid[2], w, _noiseTileData);
+		return interpolate<N>(mid[0], mid[1], mid[2], w, tile());
 	}
 
 	template<int N>
@@ -380,13 +631,13 @@ namespace Vcl { namespace Util {
 		evaluateDQuadraticSplineBasis(p[2], w[2], mid[2]);
 
 		// Evaluate noise by weighting noise coefficients by basis function values
-		return interpolate<N>(mid[0], mid[1], mid[2], w, _noiseTileData);
+		return interpolate<N>(mid[0], mid[1], mid[2], w, tile());
 	}
 
 	template<int N>
 	void WaveletNoise<N>::dxDyDz(const Vec3& p, Mat33& final) const noexcept
 	{
-		const stdext::span<const float> data = _noiseTileData;
+		const stdext::span<const float> data = tile();
 
 		float result1 = 0;
 		float result2 = 0;
@@ -519,6 +770,65 @@ namespace Vcl { namespace Util {
 		return v;
 	}
 
+	template<int N>
+	void WaveletNoise<N>::evaluate(stdext::span<const Vec3> points, stdext::span<float> values) const noexcept
+	{
+		VclRequire(values.size() >= points.size(), "Output has space for all points.");
+
+		const float* data = tile().data();
+		evaluateBlocks<BatchWidth>(points, values, [data](const Eigen::Matrix<VectorScalar<float, BatchWidth>, 3, 1>& p) {
+			return interpolate<N, BatchWidth>(p, data);
+		});
+	}
+
+	template<int N>
+	void WaveletNoise<N>::evaluate(stdext::span<const Vec3> points, float s, const Vec3* normal, int first_band, int nr_bands, stdext::span<const float> w, stdext::span<float> values) const
+	{
+		VclRequire(values.size() >= points.size(), "Output has space for all points.");
+
+		// The support of the projected noise depends on the normal, it is evaluated point by point
+		if (normal != nullptr)
+		{
+			for (size_t i = 0; i < points.size(); i++)
+				values[i] = evaluate(points[i], s, normal, first_band, nr_bands, w);
+			return;
+		}
+
+		const float* data = tile().data();
+		evaluateBlocks<BatchWidth>(points, values, [=](const Eigen::Matrix<VectorScalar<float, BatchWidth>, 3, 1>& p) {
+			return interpolateBands<N, BatchWidth>(p, s, first_band, nr_bands, w, data);
+		});
+	}
+
+	template<int N>
+	template<int Width>
+	VectorScalar<float, Width> WaveletNoise<N>::evaluate(const Eigen::Matrix<VectorScalar<float, Width>, 3, 1>& p) const noexcept
+	{
+		return interpolate<N, Width>(p, tile().data());
+	}
+
+	template<int N>
+	template<int Width>
+	VectorScalar<float, Width> WaveletNoise<N>::evaluate(const Eigen::Matrix<VectorScalar<float, Width>, 3, 1>& p, float s, int first_band, int nr_bands, stdext::span<const float> w) const
+	{
+		return interpolateBands<N, Width>(p, s, first_band, nr_bands, w, tile().data());
+	}
+
+#define VCL_UTIL_WAVELETNOISE_INST_BATCH(N, Width)                                                                                                      \
+	template VectorScalar<float, Width> WaveletNoise<N>::evaluate<Width>(const Eigen::Matrix<VectorScalar<float, Width>, 3, 1>&) const noexcept; \
+	template VectorScalar<float, Width> WaveletNoise<N>::evaluate<Width>(const Eigen::Matrix<VectorScalar<float, Width>, 3, 1>&, float, int, int, stdext::span<const float>) const;
+
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(32, 4)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(32, 8)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(32, 16)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(64, 4)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(64, 8)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(64, 16)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(128, 4)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(128, 8)
+	VCL_UTIL_WAVELETNOISE_INST_BATCH(128, 16)
+#undef VCL_UTIL_WAVELETNOISE_INST_BATCH
+
 	template class WaveletNoise<32>;
 	template class WaveletNoise<64>;
 	template class WaveletNoise<128>;
@@ -29,12 +29,16 @@
 
 // C++ standard library
 #include <array>
+#include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 // VCL
+#include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/contract.h>
 #include <vcl/core/span.h>
+#include <vcl/util/memorymappedfile.h>
 
 namespace Vcl { namespace Util {
 	/*!
@@ -52,6 +56,14 @@ namespace Vcl { namespace Util {
 		WaveletNoise(unsigned int seed);
 		WaveletNoise(std::mt19937& rnd_gen);
 
+		/*!
+		 *	Construct the noise tile for 'seed' using a cache file in 'cache_dir'.
+		 *	A matching cache file is mapped into memory instead of generating
+		 *	the tile, otherwise the generated tile is written to the cache.
+		 *	An empty 'cache_dir' disables the cache.
+		 */
+		WaveletNoise(unsigned int seed, const std::string& cache_dir);
+
 	public: // Evaluation
 		float evaluate(const Vec3& p) const noexcept;
 		float evaluate(const Vec3& p, const Vec3& normal) const;
@@ -64,13 +76,37 @@ namespace Vcl { namespace Util {
 
 		Vec3 velocity(const Vec3& p) const noexcept;
 
+	public: // Batched evaluation
+		//! Evaluate the noise at all 'points' and write the results to 'values'
+		void evaluate(stdext::span<const Vec3> points, stdext::span<float> values) const noexcept;
+
+		//! Evaluate the band-limited noise at all 'points' and write the results to 'values'
+		void evaluate(stdext::span<const Vec3> points, float s, const Vec3* normal, int first_band, int nr_bands, stdext::span<const float> w, stdext::span<float> values) const;
+
+		/*!
+		 *	Evaluate the noise at the points stored in the lanes of 'p'.
+		 *	Instantiated for widths 4, 8 and 16.
+		 */
+		template<int Width>
+		VectorScalar<float, Width> evaluate(const Eigen::Matrix<VectorScalar<float, Width>, 3, 1>& p) const noexcept;
+
+		/*!
+		 *	Evaluate the band-limited noise at the points stored in the lanes of 'p'.
+		 *	Instantiated for widths 4, 8 and 16.
+		 */
+		template<int Width>
+		VectorScalar<float, Width> evaluate(const Eigen::Matrix<VectorScalar<float, Width>, 3, 1>& p, float s, int first_band, int nr_bands, stdext::span<const float> w) const;
+
 	public: // Properties
 		float minValue() const noexcept { return _min; }
 		float maxValue() const noexcept { return _max; }
 
 	public: // Access
 		int getNoiseTileSize() const noexcept { return N; }
-		const float* getNoiseTileData() const noexcept { return _noiseTileData.data(); }
+		const float* getNoiseTileData() const noexcept { return tile().data(); }
+
+		//! \returns true if the noise tile is mapped from a cache file
+		bool isMapped() const noexcept { return _noiseTileFile != nullptr; }
 
 	protected: // Helper methods
 		//! Special constructor taking an initialized set of random numbers
@@ -79,10 +115,23 @@ namespace Vcl { namespace Util {
 		//! Initialize the noise data
 		void initializeNoise(stdext::span<const float> noise_data_base);
 
+	private:
+		//! \returns the noise tile, either owned or mapped from a cache file
+		stdext::span<const float> tile() const noexcept;
+
+		//! Map the noise tile from a cache file
+		bool loadTile(const std::string& path, unsigned int seed);
+
+		//! Write the noise tile to a cache file
+		void storeTile(const std::string& path, unsigned int seed) const;
+
 	private:
 		//! Noise data
 		std::vector<float> _noiseTileData;
 
+		//! Cache file the noise data is mapped from. Shared between copies.
+		std::shared_ptr<const MemoryMappedFile> _noiseTileFile;
+
 		float _min; //!< Minimum noise data
 		float _max; //!< Maximum noise data
 	};
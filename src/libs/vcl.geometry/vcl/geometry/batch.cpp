@@ -0,0 +1,222 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+
+// VCL
+#include <vcl/core/contract.h>
+#include <vcl/core/simd/dispatch.h>
+#include <vcl/core/simd/memory.h>
+#include <vcl/geometry/batch_dispatch.h>
+#include <vcl/geometry/distancePoint3Triangle3.h>
+#include <vcl/geometry/distanceTriangle3Triangle3.h>
+#include <vcl/geometry/distance_ray3ray3.h>
+#include <vcl/geometry/intersect.h>
+#include <vcl/util/profiler.h>
+
+namespace Vcl { namespace Geometry {
+	namespace {
+		using Core::Simd::SimdExt;
+		using Detail::BatchLayout;
+
+		static_assert(sizeof(Triangle<float, 3>) == 9 * sizeof(float), "Triangles are densely packed");
+		static_assert(sizeof(Eigen::Vector3f) == 3 * sizeof(float), "Points are densely packed");
+		static_assert(sizeof(Ray<float, 3>) % sizeof(float) == 0, "Rays consist of floats");
+		static_assert(sizeof(Eigen::AlignedBox<float, 3>) % sizeof(float) == 0, "Boxes consist of floats");
+
+		//! Locate origin and direction within a ray
+		BatchLayout rayLayout() noexcept
+		{
+			const Ray<float, 3> ray{ Eigen::Vector3f::Zero(), Eigen::Vector3f::Ones() };
+			const auto* base = reinterpret_cast<const float*>(&ray);
+			return { sizeof(Ray<float, 3>) / sizeof(float), static_cast<size_t>(ray.origin().data() - base), static_cast<size_t>(ray.direction().data() - base) };
+		}
+
+		//! Locate minimum and maximum within a box
+		BatchLayout boxLayout() noexcept
+		{
+			const Eigen::AlignedBox<float, 3> box{ Eigen::Vector3f::Zero(), Eigen::Vector3f::Ones() };
+			const auto* base = reinterpret_cast<const float*>(&box);
+			return { sizeof(Eigen::AlignedBox<float, 3>) / sizeof(float), static_cast<size_t>(box.min().data() - base), static_cast<size_t>(box.max().data() - base) };
+		}
+
+		// Fallbacks processing the primitives one by one, used if vectorization is not available.
+		// Inputs are passed by the address of the first object.
+		void pointTriangleScalar(const float* tris, const float* points, float* distances, size_t count)
+		{
+			const auto* t = reinterpret_cast<const Triangle<float, 3>*>(tris);
+			const auto* p = reinterpret_cast<const Eigen::Vector3f*>(points);
+			for (size_t i = 0; i < count; i++)
+				distances[i] = distance(t[i], p[i]);
+		}
+
+		void triangleTriangleScalar(const float* tris_a, const float* tris_b, float* distances, size_t count)
+		{
+			// There is no scalar implementation, thus the triangles are processed in groups of four
+			alignas(16) float lanes[4];
+			const auto gather = [&](const float* src, size_t k, size_t n) {
+				for (size_t i = 0; i < 4; i++)
+					lanes[i] = src[9 * ((i < n) ? i : 0) + k];
+
+				float4 v;
+				load(v, lanes);
+				return v;
+			};
+			const auto gatherTriangle = [&](const float* src, size_t n) {
+				using Vector3 = Eigen::Matrix<float4, 3, 1>;
+				return Triangle<float4, 3>{
+					Vector3{ gather(src, 0, n), gather(src, 1, n), gather(src, 2, n) },
+					Vector3{ gather(src, 3, n), gather(src, 4, n), gather(src, 5, n) },
+					Vector3{ gather(src, 6, n), gather(src, 7, n), gather(src, 8, n) }
+				};
+			};
+
+			for (size_t base = 0; base < count; base += 4)
+			{
+				const size_t n = std::min<size_t>(count - base, 4);
+
+				Eigen::Matrix<float4, 3, 1> pt_a, pt_b;
+				const float4 d = distance(gatherTriangle(tris_a + 9 * base, n), gatherTriangle(tris_b + 9 * base, n), pt_a, pt_b);
+				for (size_t i = 0; i < n; i++)
+					distances[base + i] = d[static_cast<int>(i)];
+			}
+		}
+
+		void rayRayScalar(const float* rays_a, const float* rays_b, BatchLayout, float* distances, size_t count)
+		{
+			const auto* a = reinterpret_cast<const Ray<float, 3>*>(rays_a);
+			const auto* b = reinterpret_cast<const Ray<float, 3>*>(rays_b);
+			for (size_t i = 0; i < count; i++)
+				distances[i] = distance(a[i], b[i], nullptr);
+		}
+
+		void rayBoxScalar(const float* boxes, BatchLayout, const float* rays, BatchLayout, bool* results, size_t count)
+		{
+			const auto* b = reinterpret_cast<const Eigen::AlignedBox<float, 3>*>(boxes);
+			const auto* r = reinterpret_cast<const Ray<float, 3>*>(rays);
+			for (size_t i = 0; i < count; i++)
+				results[i] = intersects(b[i], r[i], RayBoxIntersectionAlgorithmSelector<RayBoxIntersectionAlgorithm::Ize>{});
+		}
+
+		const Detail::BatchKernels ScalarKernels = {
+			&pointTriangleScalar,
+			&triangleTriangleScalar,
+			&rayRayScalar,
+			&rayBoxScalar,
+		};
+
+		// The kernels are resolved once on first use
+		const Core::Simd::Dispatcher<const Detail::BatchKernels*>& batchKernels() noexcept
+		{
+			static const Core::Simd::Dispatcher<const Detail::BatchKernels*> kernels = {
+				{ SimdExt::None, &ScalarKernels },
+#ifdef VCL_GEOMETRY_BATCH_SSE
+				{ SimdExt::SSE, Detail::batchKernelsSSE() },
+#endif
+#ifdef VCL_GEOMETRY_BATCH_AVX
+				{ SimdExt::AVX, Detail::batchKernelsAVX() },
+#endif
+#ifdef VCL_GEOMETRY_BATCH_AVX512
+				{ SimdExt::AVX512, Detail::batchKernelsAVX512() },
+#endif
+			};
+			return kernels;
+		}
+	}
+
+	void distance(stdext::span<const Triangle<float, 3>> tris, stdext::span<const Eigen::Vector3f> points, stdext::span<float> distances)
+	{
+		VclRequire(points.size() == tris.size() && distances.size() == tris.size(), "Sizes of the batches match.");
+
+		VCL_PROFILE_ZONE("distance::pointTriangle::batch");
+		if (tris.empty())
+			return;
+
+		const auto* t = reinterpret_cast<const float*>(tris.data());
+		batchKernels().get()->PointTriangle(t, points.data()->data(), distances.data(), tris.size());
+	}
+
+	void distance(stdext::span<const Triangle<float, 3>> tris_a, stdext::span<const Triangle<float, 3>> tris_b, stdext::span<float> distances)
+	{
+		VclRequire(tris_b.size() == tris_a.size() && distances.size() == tris_a.size(), "Sizes of the batches match.");
+
+		VCL_PROFILE_ZONE("distance::triangleTriangle::batch");
+		if (tris_a.empty())
+			return;
+
+		const auto* a = reinterpret_cast<const float*>(tris_a.data());
+		const auto* b = reinterpret_cast<const float*>(tris_b.data());
+		batchKernels().get()->TriangleTriangle(a, b, distances.data(), tris_a.size());
+	}
+
+	void distance(stdext::span<const Ray<float, 3>> rays_a, stdext::span<const Ray<float, 3>> rays_b, stdext::span<float> distances)
+	{
+		VclRequire(rays_b.size() == rays_a.size() && distances.size() == rays_a.size(), "Sizes of the batches match.");
+
+		VCL_PROFILE_ZONE("distance::rayRay::batch");
+		if (rays_a.empty())
+			return;
+
+		const auto* a = reinterpret_cast<const float*>(rays_a.data());
+		const auto* b = reinterpret_cast<const float*>(rays_b.data());
+		batchKernels().get()->RayRay(a, b, rayLayout(), distances.data(), rays_a.size());
+	}
+
+	void intersects(stdext::span<const Eigen::AlignedBox<float, 3>> boxes, stdext::span<const Ray<float, 3>> rays, stdext::span<bool> results)
+	{
+		VclRequire(rays.size() == boxes.size() && results.size() == boxes.size(), "Sizes of the batches match.");
+
+		VCL_PROFILE_ZONE("intersects::rayBox::batch");
+		if (boxes.empty())
+			return;
+
+		const auto* b = reinterpret_cast<const float*>(boxes.data());
+		const auto* r = reinterpret_cast<const float*>(rays.data());
+		batchKernels().get()->RayBox(b, boxLayout(), r, rayLayout(), results.data(), boxes.size());
+	}
+
+	Core::Simd::SimdExt distancePointTriangleSimdExt() noexcept
+	{
+		return batchKernels().simdExt();
+	}
+
+	Core::Simd::SimdExt distanceTriangleTriangleSimdExt() noexcept
+	{
+		return batchKernels().simdExt();
+	}
+
+	Core::Simd::SimdExt distanceRayRaySimdExt() noexcept
+	{
+		return batchKernels().simdExt();
+	}
+
+	Core::Simd::SimdExt intersectsSimdExt() noexcept
+	{
+		return batchKernels().simdExt();
+	}
+}}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstddef>
+
+// Instruction sets for which the batched geometry kernels are compiled.
+// With runtime dispatch enabled, all x86 variants are built and selected on
+// the executing processor.
+#if defined(VCL_VECTORIZE_SSE) || (defined(VCL_VECTORIZE_DISPATCH) && (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)))
+#	define VCL_GEOMETRY_BATCH_SSE
+#endif
+#if defined(VCL_VECTORIZE_AVX) || (defined(VCL_VECTORIZE_DISPATCH) && (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)))
+#	define VCL_GEOMETRY_BATCH_AVX
+#endif
+#if defined(VCL_VECTORIZE_AVX512) || (defined(VCL_VECTORIZE_DISPATCH) && (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)))
+#	define VCL_GEOMETRY_BATCH_AVX512
+#endif
+
+namespace Vcl { namespace Geometry { namespace Detail {
+	//! Position of two vectors of 3 floats within an object, counted in floats
+	struct BatchLayout
+	{
+		//! Distance between two consecutive objects
+		size_t Stride;
+
+		//! Offset of the first vector
+		size_t First;
+
+		//! Offset of the second vector
+		size_t Second;
+	};
+
+	/*!
+	 *	\brief Batched geometry kernels
+	 *
+	 *	Triangles are stored densely, 9 floats each. Points are stored as 3 floats.
+	 *	Rays and boxes are described by a 'BatchLayout' locating origin and direction,
+	 *	respectively minimum and maximum.
+	 *	The kernels are implemented in separate translation units compiled for
+	 *	the respective instruction set. This header must not pull in any code
+	 *	which could be instantiated with different compiler flags.
+	 */
+	struct BatchKernels
+	{
+		void (*PointTriangle)(const float* tris, const float* points, float* distances, size_t count);
+		void (*TriangleTriangle)(const float* tris_a, const float* tris_b, float* distances, size_t count);
+		void (*RayRay)(const float* rays_a, const float* rays_b, BatchLayout ray, float* distances, size_t count);
+		void (*RayBox)(const float* boxes, BatchLayout box, const float* rays, BatchLayout ray, bool* results, size_t count);
+	};
+
+#ifdef VCL_GEOMETRY_BATCH_SSE
+	const BatchKernels* batchKernelsSSE() noexcept;
+#endif
+#ifdef VCL_GEOMETRY_BATCH_AVX
+	const BatchKernels* batchKernelsAVX() noexcept;
+#endif
+#ifdef VCL_GEOMETRY_BATCH_AVX512
+	const BatchKernels* batchKernelsAVX512() noexcept;
+#endif
+}}}
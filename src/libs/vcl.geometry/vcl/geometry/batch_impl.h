@@ -0,0 +1,162 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// Shared implementation of the batched geometry kernels.
+// The including translation unit is compiled for the instruction set of the
+// operation policy it instantiates the kernels with.
+
+// VCL
+#include <vcl/core/simd/packet.h>
+#include <vcl/geometry/batch_dispatch.h>
+#include <vcl/geometry/distancePoint3Triangle3_impl.h>
+#include <vcl/geometry/distanceTriangle3Triangle3_impl.h>
+#include <vcl/geometry/distance_ray3ray3_impl.h>
+#include <vcl/geometry/intersect.h>
+
+namespace {
+	// Unused lanes repeat the first element of a group.
+	// Avoid calling inline library functions, which could be merged with
+	// instances compiled for a different instruction set.
+	template<typename Ops>
+	Vcl::Core::Simd::Packet<Ops> gather(const float* src, size_t stride, size_t n)
+	{
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+
+		alignas(64) float lanes[Packet::Width];
+		for (size_t i = 0; i < Packet::Width; i++)
+			lanes[i] = src[stride * ((i < n) ? i : 0)];
+		return Packet::load(lanes);
+	}
+
+	template<typename Ops>
+	Eigen::Matrix<Vcl::Core::Simd::Packet<Ops>, 3, 1> gather3(const float* src, size_t stride, size_t n)
+	{
+		return { gather<Ops>(src, stride, n), gather<Ops>(src + 1, stride, n), gather<Ops>(src + 2, stride, n) };
+	}
+
+	template<typename Ops>
+	Vcl::Geometry::Triangle<Vcl::Core::Simd::Packet<Ops>, 3> gatherTriangle(const float* src, size_t n)
+	{
+		return { gather3<Ops>(src, 9, n), gather3<Ops>(src + 3, 9, n), gather3<Ops>(src + 6, 9, n) };
+	}
+
+	template<typename Ops>
+	Vcl::Geometry::Ray<Vcl::Core::Simd::Packet<Ops>, 3> gatherRay(const float* src, Vcl::Geometry::Detail::BatchLayout layout, size_t n)
+	{
+		return { gather3<Ops>(src + layout.First, layout.Stride, n), gather3<Ops>(src + layout.Second, layout.Stride, n) };
+	}
+
+	template<typename Ops>
+	void scatter(float* dst, const Vcl::Core::Simd::Packet<Ops>& v, size_t n)
+	{
+		alignas(64) float lanes[Vcl::Core::Simd::Packet<Ops>::Width];
+		v.store(lanes);
+		for (size_t i = 0; i < n; i++)
+			dst[i] = lanes[i];
+	}
+
+	template<typename Ops>
+	void pointTriangleBatch(const float* tris, const float* points, float* distances, size_t count)
+	{
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+
+		const size_t width = Packet::Width;
+		for (size_t base = 0; base < count; base += width)
+		{
+			const size_t n = (count - base < width) ? count - base : width;
+
+			const auto tri = gatherTriangle<Ops>(tris + 9 * base, n);
+			const auto p = gather3<Ops>(points + 3 * base, 3, n);
+			const Packet d = Vcl::Geometry::distanceImpl(tri, p, static_cast<std::array<Packet, 3>*>(nullptr), nullptr);
+			scatter(distances + base, d, n);
+		}
+	}
+
+	template<typename Ops>
+	void triangleTriangleBatch(const float* tris_a, const float* tris_b, float* distances, size_t count)
+	{
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+
+		const size_t width = Packet::Width;
+		for (size_t base = 0; base < count; base += width)
+		{
+			const size_t n = (count - base < width) ? count - base : width;
+
+			const auto a = gatherTriangle<Ops>(tris_a + 9 * base, n);
+			const auto b = gatherTriangle<Ops>(tris_b + 9 * base, n);
+			Eigen::Matrix<Packet, 3, 1> pt_a, pt_b;
+			const Packet d = Vcl::Geometry::distanceImpl(a, b, pt_a, pt_b);
+			scatter(distances + base, d, n);
+		}
+	}
+
+	template<typename Ops>
+	void rayRayBatch(const float* rays_a, const float* rays_b, Vcl::Geometry::Detail::BatchLayout ray, float* distances, size_t count)
+	{
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+
+		const size_t width = Packet::Width;
+		for (size_t base = 0; base < count; base += width)
+		{
+			const size_t n = (count - base < width) ? count - base : width;
+
+			const auto a = gatherRay<Ops>(rays_a + ray.Stride * base, ray, n);
+			const auto b = gatherRay<Ops>(rays_b + ray.Stride * base, ray, n);
+			const Packet d = Vcl::Geometry::distanceImpl(a, b, static_cast<Vcl::Geometry::Result<Packet>*>(nullptr));
+			scatter(distances + base, d, n);
+		}
+	}
+
+	template<typename Ops>
+	void rayBoxBatch(const float* boxes, Vcl::Geometry::Detail::BatchLayout box, const float* rays, Vcl::Geometry::Detail::BatchLayout ray, bool* results, size_t count)
+	{
+		using namespace Vcl::Geometry;
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+
+		const size_t width = Packet::Width;
+		for (size_t base = 0; base < count; base += width)
+		{
+			const size_t n = (count - base < width) ? count - base : width;
+
+			const float* b = boxes + box.Stride * base;
+			const Eigen::AlignedBox<Packet, 3> aabb{ gather3<Ops>(b + box.First, box.Stride, n), gather3<Ops>(b + box.Second, box.Stride, n) };
+			const auto r = gatherRay<Ops>(rays + ray.Stride * base, ray, n);
+			const auto hits = intersects(aabb, r, RayBoxIntersectionAlgorithmSelector<RayBoxIntersectionAlgorithm::Ize>{}).bits();
+			for (size_t i = 0; i < n; i++)
+				results[base + i] = ((hits >> i) & 1) != 0;
+		}
+	}
+
+	template<typename Ops>
+	const Vcl::Geometry::Detail::BatchKernels* batchKernels() noexcept
+	{
+		static const Vcl::Geometry::Detail::BatchKernels kernels = {
+			&pointTriangleBatch<Ops>,
+			&triangleTriangleBatch<Ops>,
+			&rayRayBatch<Ops>,
+			&rayBoxBatch<Ops>,
+		};
+		return &kernels;
+	}
+}
@@ -30,6 +30,7 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/span.h>
 #include <vcl/geometry/triangle.h>
 
 namespace Vcl { namespace Geometry {
@@ -42,4 +43,18 @@ namespace Vcl { namespace Geometry {
 	float4 distance(const Triangle<float4, 3>& tri, const Eigen::Matrix<float4, 3, 1>& p, std::array<float4, 3>* barycentric = nullptr, int* r = nullptr);
 	float8 distance(const Triangle<float8, 3>& tri, const Eigen::Matrix<float8, 3, 1>& p, std::array<float8, 3>* barycentric = nullptr, int* r = nullptr);
 	float16 distance(const Triangle<float16, 3>& tri, const Eigen::Matrix<float16, 3, 1>& p, std::array<float16, 3>* barycentric = nullptr, int* r = nullptr);
+
+	/*!
+	 *	\brief Compute the distances between a batch of triangles and points
+	 *
+	 *	The computation is vectorized using the widest instruction set of the executing
+	 *	processor (see \ref distancePointTriangleSimdExt).
+	 *	\param tris triangles
+	 *	\param points points, one for each triangle
+	 *	\param distances outputs the distance between each triangle and its point
+	 */
+	void distance(stdext::span<const Triangle<float, 3>> tris, stdext::span<const Eigen::Vector3f> points, stdext::span<float> distances);
+
+	//! \returns the instruction set used by the batched point-triangle distance
+	Core::Simd::SimdExt distancePointTriangleSimdExt() noexcept;
 }}
@@ -30,6 +30,7 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/span.h>
 #include <vcl/geometry/segment.h>
 #include <vcl/geometry/triangle.h>
 
@@ -75,4 +76,18 @@ namespace Vcl { namespace Geometry {
 		const Triangle<float16, 3>& iTri2,
 		Eigen::Matrix<float16, 3, 1>& oTri1Point,
 		Eigen::Matrix<float16, 3, 1>& oTri2Point);
+
+	/*!
+	 *	\brief Compute the distances between two batches of triangles
+	 *
+	 *	The computation is vectorized using the widest instruction set of the executing
+	 *	processor (see \ref distanceTriangleTriangleSimdExt).
+	 *	\param tris_a first triangles
+	 *	\param tris_b second triangles
+	 *	\param distances outputs the squared distance between each pair of triangles
+	 */
+	void distance(stdext::span<const Triangle<float, 3>> tris_a, stdext::span<const Triangle<float, 3>> tris_b, stdext::span<float> distances);
+
+	//! \returns the instruction set used by the batched triangle-triangle distance
+	Core::Simd::SimdExt distanceTriangleTriangleSimdExt() noexcept;
 }}
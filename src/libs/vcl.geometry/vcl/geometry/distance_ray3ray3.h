@@ -30,6 +30,7 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/span.h>
 #include <vcl/geometry/ray.h>
 
 namespace Vcl { namespace Geometry {
@@ -56,4 +57,18 @@ namespace Vcl { namespace Geometry {
 		const Ray<float16, 3>& ray_a,
 		const Ray<float16, 3>& ray_b,
 		Result<float16>* result);
+
+	/*!
+	 *	\brief Compute the distances between two batches of rays
+	 *
+	 *	The computation is vectorized using the widest instruction set of the executing
+	 *	processor (see \ref distanceRayRaySimdExt).
+	 *	\param rays_a first rays
+	 *	\param rays_b second rays
+	 *	\param distances outputs the distance between each pair of rays
+	 */
+	void distance(stdext::span<const Ray<float, 3>> rays_a, stdext::span<const Ray<float, 3>> rays_b, stdext::span<float> distances);
+
+	//! \returns the instruction set used by the batched ray-ray distance
+	Core::Simd::SimdExt distanceRayRaySimdExt() noexcept;
 }}
@@ -34,6 +34,7 @@
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/contract.h>
+#include <vcl/core/span.h>
 #include <vcl/geometry/ray.h>
 #include <vcl/geometry/tetrahedron.h>
 #include <vcl/math/math.h>
@@ -134,15 +135,16 @@ namespace Vcl { namespace Geometry {
 		return tmin <= tmax;
 	}
 
-	template<typename Real, int Width>
-	Vcl::VectorScalar<bool, Width> intersects(
-		const Eigen::AlignedBox<Vcl::VectorScalar<Real, Width>, 3>& box,
-		const Ray<Vcl::VectorScalar<Real, Width>, 3>& r,
+	//! Vectorized variant of the above for 'VectorScalar' and packet types
+	template<typename Real>
+	typename VectorTypes<Real>::bool_t intersects(
+		const Eigen::AlignedBox<Real, 3>& box,
+		const Ray<Real, 3>& r,
 		RayBoxIntersectionAlgorithmSelector<RayBoxIntersectionAlgorithm::Ize>)
 	{
 		using namespace Vcl::Mathematics;
 
-		using real_t = Vcl::VectorScalar<Real, Width>;
+		using real_t = Real;
 
 		real_t txmin = select(r.signs().x() == 0, box.min().x(), box.max().x()) - r.origin().x();
 		real_t txmax = select(r.signs().x() == 1, box.min().x(), box.max().x()) - r.origin().x();
@@ -176,6 +178,20 @@ namespace Vcl { namespace Geometry {
 		return tmin <= tmax;
 	}
 
+	/*!
+	 *	\brief Intersect a batch of rays with boxes using the method by Ize
+	 *
+	 *	The computation is vectorized using the widest instruction set of the executing
+	 *	processor (see \ref intersectsSimdExt).
+	 *	\param boxes boxes
+	 *	\param rays rays, one for each box
+	 *	\param results outputs whether each ray intersects its box
+	 */
+	void intersects(stdext::span<const Eigen::AlignedBox<float, 3>> boxes, stdext::span<const Ray<float, 3>> rays, stdext::span<bool> results);
+
+	//! \returns the instruction set used by the batched ray-box intersection
+	Core::Simd::SimdExt intersectsSimdExt() noexcept;
+
 	/*!
 	*	\brief Ray-AABB intersection
 	*
@@ -25,169 +25,165 @@
 #include <vcl/geometry/io/serialiser_obj.h>
 
 // Standard C++ library
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <vector>
 
 // VCL library
+#include <vcl/core/concurrency/parallel.h>
+#include <vcl/util/memorymappedfile.h>
+#include <vcl/util/profiler.h>
 #include <vcl/util/stringparser.h>
 
 namespace Vcl { namespace Geometry { namespace IO {
-	static int convertToIndex(const std::string& str, int latest_idx)
-	{
-		int idx = atoi(str.c_str());
-		if (idx < 0)
+	namespace {
+		//! Vertex reference of a face corner
+		struct ObjIndex
 		{
-			return latest_idx + 1 + idx;
-		} else
+			//! Absolute index, or index relative to the first vertex of the chunk
+			int index;
+
+			//! The index was given relative to the last defined vertex
+			bool relative;
+		};
+
+		//! Elements parsed from a range of lines
+		struct ObjChunk
 		{
-			return idx - 1;
+			std::vector<float> positions;
+			std::vector<Vector3f> normals;
+			std::vector<unsigned int> faceSizes;
+			std::vector<ObjIndex> faceIndices;
+		};
+
+		void parseChunk(stdext::span<const char> text, ObjChunk& chunk)
+		{
+			VCL_PROFILE_ZONE("ObjSerialiser::parseChunk");
+
+			Vcl::Util::StringParser parser;
+			parser.setInputBuffer(text.data(), text.size());
+
+			int nr_positions = 0;
+			float v3[3];
+			Vector3f n;
+
+			std::string token;
+			std::string face_corner;
+			while (parser.loadLine())
+			{
+				parser.readString(&token);
+
+				// Vertex data
+				if (token == "v")
+				{
+					parser.readFloats(stdext::make_span(v3, 3));
+					chunk.positions.insert(chunk.positions.end(), v3, v3 + 3);
+					nr_positions++;
+				} else if (token == "vn")
+				{
+					parser.readFloats(stdext::make_span(n.data(), 3));
+					chunk.normals.emplace_back(n);
+				}
+
+				// Primitive data
+				else if (token == "p")
+				{
+					VclDebugError("Not implemented.");
+				} else if (token == "l")
+				{
+					VclDebugError("Not implemented.");
+				} else if (token == "f")
+				{
+					// Only the position indices of 'v/vt/vn/vc' are used
+					unsigned int nr_corners = 0;
+					while (parser.readString(&face_corner))
+					{
+						const int idx = std::atoi(face_corner.c_str());
+						if (idx < 0)
+							chunk.faceIndices.push_back({ nr_positions + idx, true });
+						else
+							chunk.faceIndices.push_back({ idx - 1, false });
+
+						nr_corners++;
+					}
+					chunk.faceSizes.push_back(nr_corners);
+				}
+
+				parser.skipLine();
+			}
 		}
 	}
 
 	void ObjSerialiser::load(AbstractDeserialiser* deserialiser, const std::string& path) const
 	{
+		VCL_PROFILE_ZONE("ObjSerialiser::load");
 		VclRequire(deserialiser != nullptr, "Deserialiser is given.");
 
-		std::ifstream fin(path.c_str());
-		VclCheck(fin.is_open() && !fin.eof(), "File exists, is not locked and is not empty.");
-		if (!fin.is_open() || fin.eof())
+		// Parse the file in-place
+		Vcl::Util::MemoryMappedFile file;
+		const bool is_open = file.open(path);
+		VclCheck(is_open, "File exists and is not locked.");
+		if (!is_open)
 			return;
 
-		Vcl::Util::StringParser parser;
-		parser.setInputStream(&fin);
+		// Parse line-aligned chunks of the file concurrently
+		auto& pool = Core::ThreadPool::global();
+		const auto texts = Vcl::Util::splitAtLineBreaks(stdext::make_span(file.data(), file.size()), 4 * pool.size());
+		std::vector<ObjChunk> chunks(texts.size());
+		Core::parallel_for(pool, 0, texts.size(), 1, [&](size_t first, size_t last) {
+			for (size_t c = first; c < last; c++)
+				parseChunk(texts[c], chunks[c]);
+		});
+
+		// Merge the chunks in file order
+		VCL_PROFILE_ZONE("ObjSerialiser::merge");
+		size_t nr_positions = 0;
+		size_t nr_faces = 0;
+		for (const auto& chunk : chunks)
+		{
+			nr_positions += chunk.positions.size() / 3;
+			nr_faces += chunk.faceSizes.size();
+		}
 
-		// Start importing the mesh
 		deserialiser->begin();
+		deserialiser->sizeHintNodes(static_cast<unsigned int>(nr_positions));
+		deserialiser->sizeHintFaces(static_cast<unsigned int>(nr_faces));
 
-		int latest_v_idx = -1;
-		int latest_vn_idx = -1;
-		int latest_vt_idx = -1;
-		int latest_vc_idx = -1;
-		Eigen::Vector2f v2;
-		Eigen::Vector3f v3;
-		Eigen::Vector4f v4;
-		std::vector<float> vN;
-		std::vector<std::array<unsigned int, 2>> primitive_point;
-		std::vector<std::array<unsigned int, 3>> primitive_line;
-		std::vector<std::array<unsigned int, 4>> primitive_face;
-		std::vector<unsigned int> primitive_vertices;
-		std::vector<std::string> names;
-
-		// Record if a material was used.
-		bool materials_are_loaded = false;
-		bool materials_are_used = false;
-
-		std::string token;
-		std::string face_corner;
-		while (parser.loadLine())
+		std::vector<float> position(3);
+		for (const auto& chunk : chunks)
 		{
-			parser.readString(&token);
-
-			if (token == "o")
-			{
-				std::string name;
-				parser.readString(&name);
-
-				// Set the mesh name
-				//loader->setName(name);
-			}
-
-			// Vertex data
-			else if (token == "v")
-			{
-				float p0, p1, p2;
-				parser.readFloat(&p0);
-				parser.readFloat(&p1);
-				parser.readFloat(&p2);
-
-				vN = { p0, p1, p2 };
-				deserialiser->addNode(vN);
-				latest_v_idx++;
-			} else if (token == "vn")
-			{
-				parser.readFloat(&v3(0));
-				parser.readFloat(&v3(1));
-				parser.readFloat(&v3(2));
-
-				deserialiser->addNormal(v3);
-				latest_vn_idx++;
-			} else if (token == "vt")
-			{
-				parser.readFloat(&v2(0));
-				parser.readFloat(&v2(1));
-
-				//deserialiser->addTexture(v2);
-				latest_vt_idx++;
-			} else if (token == "vc") // Non standard extension
+			for (size_t i = 0; i < chunk.positions.size(); i += 3)
 			{
-				parser.readFloat(&v4(0));
-				parser.readFloat(&v4(1));
-				parser.readFloat(&v4(2));
-				parser.readFloat(&v4(3));
-
-				//latest_vc_idx = deserialiser->addColour(v4);
-				latest_vc_idx++;
+				std::copy_n(chunk.positions.data() + i, 3, position.begin());
+				deserialiser->addNode(position);
 			}
+		}
+		for (const auto& chunk : chunks)
+		{
+			for (const auto& normal : chunk.normals)
+				deserialiser->addNormal(normal);
+		}
 
-			// Primitive data
-			else if (token == "p")
-			{
-				VclDebugError("Not implemented.");
-				//primitive_point
-			} else if (token == "l")
-			{
-				VclDebugError("Not implemented.");
-				//primitive_line
-			} else if (token == "f")
+		// Relative indices are resolved against the vertices of the preceding chunks
+		std::vector<unsigned int> primitive_vertices;
+		int chunk_offset = 0;
+		for (const auto& chunk : chunks)
+		{
+			const ObjIndex* corner = chunk.faceIndices.data();
+			for (unsigned int size : chunk.faceSizes)
 			{
-				std::array<unsigned int, 4> corner;
-				corner.fill(0xffffffff);
-				primitive_face.clear();
 				primitive_vertices.clear();
-
-				while (parser.readString(&face_corner))
-				{
-					std::string::size_type pos_one, pos_two, pos_three;
-
-					// Read position
-					pos_one = face_corner.find("/", 0);
-					corner[0] = convertToIndex(face_corner.substr(0, pos_one), latest_v_idx);
-
-					// Read texture coordinate
-					if (pos_one != face_corner.npos)
-					{
-						pos_two = face_corner.find("/", pos_one + 1);
-						if (pos_two - pos_one > 1)
-							corner[1] = convertToIndex(face_corner.substr(pos_one + 1, pos_two - (pos_one + 1)), latest_vt_idx);
-
-						// Read normal
-						if (pos_two != face_corner.npos)
-						{
-							pos_three = face_corner.find("/", pos_two + 1);
-							if (pos_three - pos_two > 1)
-								corner[2] = convertToIndex(face_corner.substr(pos_two + 1, pos_three - (pos_two + 1)), latest_vn_idx);
-
-							// Read colour
-							if (pos_three != face_corner.npos)
-							{
-								if (face_corner.length() - pos_three > 2)
-									corner[3] = convertToIndex(face_corner.substr(pos_three + 1), latest_vc_idx);
-							}
-						}
-					}
-
-					primitive_face.emplace_back(corner);
-					primitive_vertices.emplace_back(corner[0]);
-				}
+				for (unsigned int c = 0; c < size; c++, corner++)
+					primitive_vertices.emplace_back(corner->relative ? chunk_offset + corner->index : corner->index);
 
 				deserialiser->addFace(primitive_vertices);
 			}
-
-			parser.skipLine();
+			chunk_offset += static_cast<int>(chunk.positions.size() / 3);
 		}
+
 		deserialiser->end();
-		fin.close();
 	}
 
 	void ObjSerialiser::store(AbstractSerialiser* serialiser, const std::string& path) const
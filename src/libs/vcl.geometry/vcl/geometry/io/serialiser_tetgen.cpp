@@ -25,19 +25,113 @@
 #include <vcl/geometry/io/serialiser_tetgen.h>
 
 // Standard C++ library
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <fstream>
+#include <string>
 #include <vector>
 
 // VCL
+#include <vcl/core/concurrency/parallel.h>
+#include <vcl/util/memorymappedfile.h>
+#include <vcl/util/profiler.h>
 #include <vcl/util/stringparser.h>
 
 namespace Vcl { namespace Geometry { namespace IO {
+	namespace {
+		//! Read the coordinates of a node
+		void readRecord(Vcl::Util::StringParser& parser, std::array<float, 3>& position)
+		{
+			parser.readFloats(stdext::make_span(position.data(), position.size()));
+		}
+
+		//! Read the zero-based node indices of a tetrahedron
+		void readRecord(Vcl::Util::StringParser& parser, std::array<unsigned int, 4>& tetrahedron)
+		{
+			for (auto& idx : tetrahedron)
+			{
+				int i = 0;
+				parser.readInt(&i);
+				idx = static_cast<unsigned int>(i - 1);
+			}
+		}
+
+		/*!
+		 *	Parse the records of a range of lines of a '.node' or '.ele' file.
+		 *	Each record starts with its index followed by 'N' values. If 'header'
+		 *	is given, the first record of the range is the file header.
+		 */
+		template<typename T, size_t N>
+		void parseChunk(stdext::span<const char> text, std::vector<T>& values, std::array<int, 4>* header)
+		{
+			VCL_PROFILE_ZONE("TetGenSerialiser::parseChunk");
+
+			Vcl::Util::StringParser parser;
+			parser.setInputBuffer(text.data(), text.size());
+
+			std::string token;
+			std::array<T, N> record;
+			while (parser.loadLine())
+			{
+				// Skips all the empty lines and comments
+				if (parser.readString(&token) && token != "#")
+				{
+					if (header)
+					{
+						(*header)[0] = std::stoi(token);
+						for (size_t i = 1; i < header->size(); i++)
+							parser.readInt(&(*header)[i]);
+						header = nullptr;
+					} else
+					{
+						readRecord(parser, record);
+						values.insert(values.end(), record.begin(), record.end());
+					}
+				}
+
+				parser.skipLine();
+			}
+		}
+
+		/*!
+		 *	Parse all records of a file concurrently
+		 *	\returns the number of records announced by the header
+		 */
+		template<typename T, size_t N>
+		int parseFile(const Vcl::Util::MemoryMappedFile& file, std::vector<T>& values)
+		{
+			auto& pool = Core::ThreadPool::global();
+			const auto texts = Vcl::Util::splitAtLineBreaks(stdext::make_span(file.data(), file.size()), 4 * pool.size());
+
+			// Only the first chunk contains the header
+			std::array<int, 4> header = { 0, 0, 0, 0 };
+			std::vector<std::vector<T>> chunks(texts.size());
+			Core::parallel_for(pool, 0, texts.size(), 1, [&](size_t first, size_t last) {
+				for (size_t c = first; c < last; c++)
+					parseChunk<T, N>(texts[c], chunks[c], c == 0 ? &header : nullptr);
+			});
+
+			// Concatenate the records in file order
+			size_t nr_values = 0;
+			for (const auto& chunk : chunks)
+				nr_values += chunk.size();
+
+			values.clear();
+			values.reserve(nr_values);
+			for (const auto& chunk : chunks)
+				values.insert(values.end(), chunk.begin(), chunk.end());
+
+			return header[0];
+		}
+	}
+
 	void TetGenSerialiser::load(AbstractDeserialiser* deserialiser, const std::string& path) const
 	{
 		using namespace std;
 
 		VclRequire(deserialiser != nullptr, "Deserialiser is given.");
+		VCL_PROFILE_ZONE("TetGenSerialiser::load");
 
 		// Check for the file endings
 		string node_path;
@@ -53,134 +147,45 @@ namespace Vcl { namespace Geometry { namespace IO {
 			ele_path = path;
 		}
 
-		ifstream fin_node(node_path.c_str());
-		ifstream fin_ele(ele_path.c_str());
-
-		VclCheck(fin_node.is_open() && !fin_node.eof(), "File exists, is not locked and is not empty.");
-		if (!fin_node.is_open() || fin_node.eof())
+		// Parse the files in-place
+		Vcl::Util::MemoryMappedFile node_file;
+		const bool node_is_open = node_file.open(node_path);
+		VclCheck(node_is_open, "File exists and is not locked.");
+		if (!node_is_open)
 			return;
 
-		VclCheck(fin_ele.is_open() && !fin_ele.eof(), "File exists, is not locked and is not empty.");
-		if (!fin_ele.is_open() || fin_ele.eof())
+		Vcl::Util::MemoryMappedFile ele_file;
+		const bool ele_is_open = ele_file.open(ele_path);
+		VclCheck(ele_is_open, "File exists and is not locked.");
+		if (!ele_is_open)
 			return;
 
-		Vcl::Util::StringParser node_parser;
-		node_parser.setInputStream(&fin_node);
+		std::vector<float> positions;
+		const int nr_nodes = parseFile<float, 3>(node_file, positions);
 
-		Vcl::Util::StringParser ele_parser;
-		ele_parser.setInputStream(&fin_ele);
+		std::vector<unsigned int> tetrahedra;
+		const int nr_volumes = parseFile<unsigned int, 4>(ele_file, tetrahedra);
 
-		// Start importing the mesh
+		// Import the mesh
+		VCL_PROFILE_ZONE("TetGenSerialiser::merge");
 		deserialiser->begin();
+		deserialiser->sizeHintNodes(static_cast<unsigned int>(nr_nodes));
+		deserialiser->sizeHintVolumes(static_cast<unsigned int>(nr_volumes));
 
 		std::vector<float> position(3);
-		std::vector<unsigned int> tetrahedron(4);
-
-		// Read the node header
-		string token;
-		while (node_parser.loadLine())
-		{
-			// Skips all the empty lines
-			if (node_parser.readString(&token))
-			{
-				if (token == "#")
-				{
-					// Ignore the rest of the line
-					node_parser.skipLine();
-				} else
-				{
-					int size = stoi(token);
-					int dim;
-					int attribute;
-					int boundary;
-
-					node_parser.readInt(&dim);
-					node_parser.readInt(&attribute);
-					node_parser.readInt(&boundary);
-
-					deserialiser->sizeHintNodes(static_cast<unsigned int>(size));
-
-					break;
-				}
-			}
-		}
-
-		// Read the position data
-		while (node_parser.loadLine())
-		{
-			// Skips all the empty lines
-			if (node_parser.readString(&token))
-			{
-				if (token == "#")
-				{
-					// Ignore the rest of the line
-					node_parser.skipLine();
-				} else
-				{
-					node_parser.readFloat(&position[0]);
-					node_parser.readFloat(&position[1]);
-					node_parser.readFloat(&position[2]);
-
-					deserialiser->addNode(position);
-				}
-			}
-		}
-
-		// Read the element header
-		while (ele_parser.loadLine())
+		for (size_t i = 0; i < positions.size(); i += 3)
 		{
-			// Skips all the empty lines
-			if (ele_parser.readString(&token))
-			{
-				if (token == "#")
-				{
-					// Ignore the rest of the line
-					ele_parser.skipLine();
-				} else
-				{
-					int size = stoi(token);
-					int dim;
-					int attribute;
-
-					ele_parser.readInt(&dim);
-					ele_parser.readInt(&attribute);
-
-					deserialiser->sizeHintVolumes(static_cast<unsigned>(size));
-
-					break;
-				}
-			}
+			std::copy_n(positions.data() + i, 3, position.begin());
+			deserialiser->addNode(position);
 		}
 
-		// Read the element data
-		while (ele_parser.loadLine())
+		std::vector<unsigned int> tetrahedron(4);
+		for (size_t i = 0; i < tetrahedra.size(); i += 4)
 		{
-			// Skips all the empty lines
-			if (ele_parser.readString(&token))
-			{
-				if (token == "#")
-				{
-					// Ignore the rest of the line
-					ele_parser.skipLine();
-				} else
-				{
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[0]));
-					tetrahedron[0] -= 1;
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[1]));
-					tetrahedron[1] -= 1;
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[2]));
-					tetrahedron[2] -= 1;
-					ele_parser.readInt(reinterpret_cast<int*>(&tetrahedron[3]));
-					tetrahedron[3] -= 1;
-
-					deserialiser->addVolume(tetrahedron);
-				}
-			}
+			std::copy_n(tetrahedra.data() + i, 4, tetrahedron.begin());
+			deserialiser->addVolume(tetrahedron);
 		}
 
 		deserialiser->end();
-
-		fin_node.close();
-		fin_ele.close();
 	}
 }}}
@@ -36,6 +36,7 @@
 
 // VCL
 #include <vcl/core/container/array.h>
+#include <vcl/core/container/flathashmap.h>
 #include <vcl/core/contract.h>
 #include <vcl/core/span.h>
 #include <vcl/geometry/cell.h>
@@ -76,7 +77,8 @@ namespace Vcl { namespace Geometry {
 		using tetra_traits = Vcl::Geometry::CellTraits<TetrahedralCell<VertexId>>;
 
 		// Face cache
-		std::unordered_map<uint64_t, std::array<VertexId, 3>> face_lut;
+		Core::FlatHashMap<uint64_t, std::array<VertexId, 3>> face_lut;
+		face_lut.reserve(indices.size());
 
 		// Find all the tet-faces without a neighbour
 		for (const auto& idx : indices)
@@ -29,9 +29,10 @@
 
 // C++ standard libary
 #include <memory>
-#include <unordered_map>
+#include <string>
 
 // VCL
+#include <vcl/core/container/flathashmap.h>
 #include <vcl/geometry/property.h>
 
 #ifdef VCL_COMPILER_MSVC
@@ -45,7 +46,7 @@ namespace Vcl { namespace Geometry {
 	class PropertyGroup
 	{
 	public:
-		using map_type = std::unordered_map<std::string, std::unique_ptr<PropertyBase>>;
+		using map_type = Core::FlatHashMap<std::string, std::unique_ptr<PropertyBase>, Core::StringHasher, Core::StringEqual>;
 		using index_type = IndexT;
 
 	public:
@@ -49,4 +49,16 @@ namespace Vcl { namespace Mathematics {
 	{
 		return Impl::AnalyticPolarDecomposition(A, q);
 	}
+	int AnalyticPolarDecomposition(const Eigen::Matrix<double4, 3, 3>& A, Eigen::Quaternion<double4>& q)
+	{
+		return Impl::AnalyticPolarDecomposition(A, q);
+	}
+	int AnalyticPolarDecomposition(const Eigen::Matrix<double8, 3, 3>& A, Eigen::Quaternion<double8>& q)
+	{
+		return Impl::AnalyticPolarDecomposition(A, q);
+	}
+	int AnalyticPolarDecomposition(const Eigen::Matrix<double16, 3, 3>& A, Eigen::Quaternion<double16>& q)
+	{
+		return Impl::AnalyticPolarDecomposition(A, q);
+	}
 }}
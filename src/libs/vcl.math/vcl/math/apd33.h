@@ -45,4 +45,7 @@ namespace Vcl { namespace Mathematics {
 	int AnalyticPolarDecomposition(const Eigen::Matrix<float8, 3, 3>& A, Eigen::Quaternion<float8>& Q);
 	int AnalyticPolarDecomposition(const Eigen::Matrix<float16, 3, 3>& A, Eigen::Quaternion<float16>& Q);
 	int AnalyticPolarDecomposition(const Eigen::Matrix3d& A, Eigen::Quaterniond& q);
+	int AnalyticPolarDecomposition(const Eigen::Matrix<double4, 3, 3>& A, Eigen::Quaternion<double4>& q);
+	int AnalyticPolarDecomposition(const Eigen::Matrix<double8, 3, 3>& A, Eigen::Quaternion<double8>& q);
+	int AnalyticPolarDecomposition(const Eigen::Matrix<double16, 3, 3>& A, Eigen::Quaternion<double16>& q);
 }}
@@ -30,6 +30,8 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/span.h>
+#include <vcl/math/jacobisvd33_mcadams_dispatch.h>
 
 namespace Vcl { namespace Mathematics {
 	/**
@@ -63,4 +65,23 @@ namespace Vcl { namespace Mathematics {
 	inline int McAdamsJacobiSVD(Eigen::Matrix<float8, 3, 3>& A, Eigen::Matrix<float8, 3, 3>& U, Eigen::Matrix<float8, 3, 3>& V) { return McAdamsJacobiSVD(A, U, V, false); }
 	int McAdamsJacobiSVD(Eigen::Matrix<float8, 3, 3>& A, Eigen::Quaternion<float8>& U, Eigen::Quaternion<float8>& V, unsigned int sweeps = 4);
 #endif // defined(VCL_VECTORIZE_AVX)
+
+#ifdef VCL_MATH_MCADAMS_BATCH_SSE
+	/*!
+	 *	\brief Decompose a batch of matrices
+	 *
+	 *	Computes the same decomposition as the single matrix variant for each entry of \p A.
+	 *	The matrices are processed with the widest kernel supported by the executing
+	 *	processor (see \ref McAdamsJacobiSVDSimdExt).
+	 *	\param A inputs the matrices to be decomposed. Outputs the diagonal of S on the diagonal entries
+	 *	\param U contains the first rotation matrices of the decompositions
+	 *	\param V contains the third rotation matrices of the decompositions
+	 *	\param sweeps number of Jacobi sweeps
+	 *	\returns total number of Givens rotations applied per matrix
+	 */
+	int McAdamsJacobiSVD(stdext::span<Eigen::Matrix<float, 3, 3>> A, stdext::span<Eigen::Matrix<float, 3, 3>> U, stdext::span<Eigen::Matrix<float, 3, 3>> V, unsigned int sweeps = 4);
+
+	//! \returns the instruction set used by the batched McAdams SVD
+	Core::Simd::SimdExt McAdamsJacobiSVDSimdExt() noexcept;
+#endif // defined(VCL_MATH_MCADAMS_BATCH_SSE)
 }}
@@ -0,0 +1,149 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Shared implementation of the batched McAdams SVD kernels.
+// The including translation unit selects the instruction set by defining
+// USE_{SSE,AVX,AVX512}_IMPLEMENTATION and provides:
+//	VCL_MCADAMS_BATCH_WIDTH:  number of lanes of a register
+//	VCL_MCADAMS_BATCH_LOAD:   aligned load of a register
+//	VCL_MCADAMS_BATCH_STORE:  aligned store of a register
+
+#define USE_ACCURATE_RSQRT_IN_JACOBI_CONJUGATION
+#define COMPUTE_V_AS_MATRIX
+#define COMPUTE_U_AS_MATRIX
+
+// Disable runtime asserts usage of uninitialized variables. Necessary for constructs like 'var = xor(var, var)'
+#ifdef VCL_COMPILER_MSVC
+#	pragma runtime_checks("u", off)
+#	pragma warning(disable : 4700)
+#elif defined VCL_COMPILER_GNU
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#	pragma GCC diagnostic ignored "-Wunused-variable"
+#elif defined VCL_COMPILER_CLANG
+#	pragma clang diagnostic push
+#	pragma clang diagnostic ignored "-Wmissing-prototypes"
+#	pragma clang diagnostic ignored "-Wold-style-cast"
+#	pragma clang diagnostic ignored "-Wuninitialized"
+#	pragma clang diagnostic ignored "-Wunused-variable"
+#endif
+
+#include <vcl/math/mcadams/Singular_Value_Decomposition_Preamble.hpp>
+
+namespace {
+	void mcAdamsSVDBatch(float* A, float* U, float* V, size_t count, unsigned int sweeps)
+	{
+		using ::sqrt;
+
+#define JACOBI_CONJUGATION_SWEEPS (int)sweeps
+
+		const size_t width = VCL_MCADAMS_BATCH_WIDTH;
+
+		// Structure-of-arrays staging buffers, one row per matrix entry
+		alignas(64) float a[9][VCL_MCADAMS_BATCH_WIDTH];
+		alignas(64) float u[9][VCL_MCADAMS_BATCH_WIDTH];
+		alignas(64) float v[9][VCL_MCADAMS_BATCH_WIDTH];
+
+		for (size_t base = 0; base < count; base += width)
+		{
+			// Unused lanes are filled with identity matrices.
+			// Avoid calling inline library functions, which could be merged with
+			// instances compiled for a different instruction set.
+			const size_t n = (count - base < width) ? count - base : width;
+			for (size_t i = 0; i < width; i++)
+			{
+				const float* src = A + 9 * (base + i);
+				for (int k = 0; k < 9; k++)
+					a[k][i] = (i < n) ? src[k] : ((k % 4 == 0) ? 1.0f : 0.0f);
+			}
+
+#include <vcl/math/mcadams/Singular_Value_Decomposition_Kernel_Declarations.hpp>
+
+			Va11 = VCL_MCADAMS_BATCH_LOAD(a[0]);
+			Va21 = VCL_MCADAMS_BATCH_LOAD(a[1]);
+			Va31 = VCL_MCADAMS_BATCH_LOAD(a[2]);
+			Va12 = VCL_MCADAMS_BATCH_LOAD(a[3]);
+			Va22 = VCL_MCADAMS_BATCH_LOAD(a[4]);
+			Va32 = VCL_MCADAMS_BATCH_LOAD(a[5]);
+			Va13 = VCL_MCADAMS_BATCH_LOAD(a[6]);
+			Va23 = VCL_MCADAMS_BATCH_LOAD(a[7]);
+			Va33 = VCL_MCADAMS_BATCH_LOAD(a[8]);
+
+#include <vcl/math/mcadams/Singular_Value_Decomposition_Main_Kernel_Body.hpp>
+
+			VCL_MCADAMS_BATCH_STORE(u[0], Vu11);
+			VCL_MCADAMS_BATCH_STORE(u[1], Vu21);
+			VCL_MCADAMS_BATCH_STORE(u[2], Vu31);
+			VCL_MCADAMS_BATCH_STORE(u[3], Vu12);
+			VCL_MCADAMS_BATCH_STORE(u[4], Vu22);
+			VCL_MCADAMS_BATCH_STORE(u[5], Vu32);
+			VCL_MCADAMS_BATCH_STORE(u[6], Vu13);
+			VCL_MCADAMS_BATCH_STORE(u[7], Vu23);
+			VCL_MCADAMS_BATCH_STORE(u[8], Vu33);
+
+			VCL_MCADAMS_BATCH_STORE(v[0], Vv11);
+			VCL_MCADAMS_BATCH_STORE(v[1], Vv21);
+			VCL_MCADAMS_BATCH_STORE(v[2], Vv31);
+			VCL_MCADAMS_BATCH_STORE(v[3], Vv12);
+			VCL_MCADAMS_BATCH_STORE(v[4], Vv22);
+			VCL_MCADAMS_BATCH_STORE(v[5], Vv32);
+			VCL_MCADAMS_BATCH_STORE(v[6], Vv13);
+			VCL_MCADAMS_BATCH_STORE(v[7], Vv23);
+			VCL_MCADAMS_BATCH_STORE(v[8], Vv33);
+
+			VCL_MCADAMS_BATCH_STORE(a[0], Va11);
+			VCL_MCADAMS_BATCH_STORE(a[4], Va22);
+			VCL_MCADAMS_BATCH_STORE(a[8], Va33);
+
+			// Write back the valid lanes
+			for (size_t i = 0; i < n; i++)
+			{
+				float* dst_a = A + 9 * (base + i);
+				float* dst_u = U + 9 * (base + i);
+				float* dst_v = V + 9 * (base + i);
+				for (int k = 0; k < 9; k++)
+				{
+					dst_u[k] = u[k][i];
+					dst_v[k] = v[k][i];
+				}
+				dst_a[0] = a[0][i];
+				dst_a[4] = a[4][i];
+				dst_a[8] = a[8][i];
+			}
+		}
+
+#undef JACOBI_CONJUGATION_SWEEPS
+	}
+}
+
+#ifdef VCL_COMPILER_MSVC
+#	pragma warning(default : 4700)
+#	pragma runtime_checks("u", restore)
+#elif defined VCL_COMPILER_GNU
+#	pragma GCC diagnostic pop
+#elif defined VCL_COMPILER_CLANG
+#	pragma clang diagnostic pop
+#endif
@@ -24,7 +24,8 @@
  */
 #include <vcl/math/jacobisvd33_mcadams.h>
 
-#ifdef VCL_VECTORIZE_SSE
+// The scalar variant serves as fallback of the batched decomposition
+#if defined(VCL_VECTORIZE_SSE) || defined(VCL_MATH_MCADAMS_BATCH_SSE)
 
 // VCL
 #	include <vcl/core/contract.h>
@@ -117,4 +118,4 @@ namespace Vcl { namespace Mathematics {
 #	elif defined VCL_COMPILER_CLANG
 #		pragma clang diagnostic pop
 #	endif
-#endif // defined(VCL_VECTORIZE_SSE)
+#endif // defined(VCL_VECTORIZE_SSE) || defined(VCL_MATH_MCADAMS_BATCH_SSE)
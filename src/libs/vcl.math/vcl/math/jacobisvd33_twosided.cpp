@@ -51,4 +51,16 @@ namespace Vcl { namespace Mathematics {
 	{
 		return TwoSidedJacobiSVD<double>(A, U, V, warm_start);
 	}
+	int TwoSidedJacobiSVD(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U, Eigen::Matrix<double4, 3, 3>& V, bool warm_start /* = false */)
+	{
+		return TwoSidedJacobiSVD<double4>(A, U, V, warm_start);
+	}
+	int TwoSidedJacobiSVD(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U, Eigen::Matrix<double8, 3, 3>& V, bool warm_start /* = false */)
+	{
+		return TwoSidedJacobiSVD<double8>(A, U, V, warm_start);
+	}
+	int TwoSidedJacobiSVD(Eigen::Matrix<double16, 3, 3>& A, Eigen::Matrix<double16, 3, 3>& U, Eigen::Matrix<double16, 3, 3>& V, bool warm_start /* = false */)
+	{
+		return TwoSidedJacobiSVD<double16>(A, U, V, warm_start);
+	}
 }}
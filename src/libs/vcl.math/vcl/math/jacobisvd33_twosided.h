@@ -30,6 +30,8 @@
 
 // VCL
 #include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/span.h>
+#include <vcl/math/jacobisvd33_twosided_dispatch.h>
 
 namespace Vcl { namespace Mathematics {
 	int TwoSidedJacobiSVD(Eigen::Matrix<float, 3, 3>& A, Eigen::Matrix<float, 3, 3>& U, Eigen::Matrix<float, 3, 3>& V, bool warm_start);
@@ -43,4 +45,24 @@ namespace Vcl { namespace Mathematics {
 	inline int TwoSidedJacobiSVD(Eigen::Matrix<float16, 3, 3>& A, Eigen::Matrix<float16, 3, 3>& U, Eigen::Matrix<float16, 3, 3>& V) { return TwoSidedJacobiSVD(A, U, V, false); }
 
 	int TwoSidedJacobiSVD(Eigen::Matrix3d& A, Eigen::Matrix3d& U, Eigen::Matrix3d& V, bool warm_start = false);
+	int TwoSidedJacobiSVD(Eigen::Matrix<double4, 3, 3>& A, Eigen::Matrix<double4, 3, 3>& U, Eigen::Matrix<double4, 3, 3>& V, bool warm_start = false);
+	int TwoSidedJacobiSVD(Eigen::Matrix<double8, 3, 3>& A, Eigen::Matrix<double8, 3, 3>& U, Eigen::Matrix<double8, 3, 3>& V, bool warm_start = false);
+	int TwoSidedJacobiSVD(Eigen::Matrix<double16, 3, 3>& A, Eigen::Matrix<double16, 3, 3>& U, Eigen::Matrix<double16, 3, 3>& V, bool warm_start = false);
+
+	/*!
+	 *	\brief Decompose a batch of matrices
+	 *
+	 *	Computes the same decomposition as the single matrix variant for each entry of \p A.
+	 *	The matrices are processed with the widest kernel supported by the executing
+	 *	processor (see \ref TwoSidedJacobiSVDSimdExt).
+	 *	\param A inputs the matrices to be decomposed. Outputs the diagonal matrices S
+	 *	\param U contains the left rotation matrices. Inputs the initial rotations for a warm start
+	 *	\param V contains the right rotation matrices. Inputs the initial rotations for a warm start
+	 *	\param warm_start use the rotations passed in \p U and \p V as initial guess
+	 *	\returns the largest number of rotations applied to a matrix
+	 */
+	int TwoSidedJacobiSVD(stdext::span<Eigen::Matrix<float, 3, 3>> A, stdext::span<Eigen::Matrix<float, 3, 3>> U, stdext::span<Eigen::Matrix<float, 3, 3>> V, bool warm_start = false);
+
+	//! \returns the instruction set used by the batched two-sided Jacobi SVD
+	Core::Simd::SimdExt TwoSidedJacobiSVDSimdExt() noexcept;
 }}
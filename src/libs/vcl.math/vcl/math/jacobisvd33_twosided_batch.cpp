@@ -0,0 +1,88 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <vcl/math/jacobisvd33_twosided.h>
+
+// C++ standard library
+#include <algorithm>
+
+// VCL
+#include <vcl/core/contract.h>
+#include <vcl/core/simd/dispatch.h>
+#include <vcl/util/profiler.h>
+
+namespace Vcl { namespace Mathematics {
+	namespace {
+		using Core::Simd::SimdExt;
+
+		//! Fallback processing the matrices one by one, used if vectorization is not available
+		int twoSidedSVDBatchScalar(float* A, float* U, float* V, size_t count, bool warm_start)
+		{
+			auto* a = reinterpret_cast<Eigen::Matrix<float, 3, 3>*>(A);
+			auto* u = reinterpret_cast<Eigen::Matrix<float, 3, 3>*>(U);
+			auto* v = reinterpret_cast<Eigen::Matrix<float, 3, 3>*>(V);
+
+			int iterations = 0;
+			for (size_t i = 0; i < count; i++)
+				iterations = std::max(iterations, TwoSidedJacobiSVD(a[i], u[i], v[i], warm_start));
+
+			return iterations;
+		}
+
+		// The kernel is resolved once on first use
+		const Core::Simd::Dispatcher<Detail::TwoSidedSVDBatchKernel>& batchKernel() noexcept
+		{
+			static const Core::Simd::Dispatcher<Detail::TwoSidedSVDBatchKernel> kernel = {
+				{ SimdExt::None, &twoSidedSVDBatchScalar },
+#ifdef VCL_MATH_TWOSIDED_BATCH_SSE
+				{ SimdExt::SSE, Detail::twoSidedSVDBatchKernelSSE() },
+#endif
+#ifdef VCL_MATH_TWOSIDED_BATCH_AVX
+				{ SimdExt::AVX, Detail::twoSidedSVDBatchKernelAVX() },
+#endif
+#ifdef VCL_MATH_TWOSIDED_BATCH_AVX512
+				{ SimdExt::AVX512, Detail::twoSidedSVDBatchKernelAVX512() },
+#endif
+			};
+			return kernel;
+		}
+	}
+
+	int TwoSidedJacobiSVD(stdext::span<Eigen::Matrix<float, 3, 3>> A, stdext::span<Eigen::Matrix<float, 3, 3>> U, stdext::span<Eigen::Matrix<float, 3, 3>> V, bool warm_start)
+	{
+		static_assert(sizeof(Eigen::Matrix<float, 3, 3>) == 9 * sizeof(float), "Matrices are densely packed");
+		VclRequire(U.size() == A.size() && V.size() == A.size(), "Output sizes match the input size.");
+
+		VCL_PROFILE_ZONE("TwoSidedJacobiSVD::batch");
+		if (A.empty())
+			return 0;
+
+		return batchKernel().get()(A.data()->data(), U.data()->data(), V.data()->data(), A.size(), warm_start);
+	}
+
+	Core::Simd::SimdExt TwoSidedJacobiSVDSimdExt() noexcept
+	{
+		return batchKernel().simdExt();
+	}
+}}
@@ -0,0 +1,40 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// VCL
+#include <vcl/math/jacobisvd33_twosided_dispatch.h>
+
+#ifdef VCL_MATH_TWOSIDED_BATCH_AVX
+#	include <vcl/math/jacobisvd33_twosided_batch_impl.h>
+
+namespace Vcl { namespace Mathematics { namespace Detail {
+	TwoSidedSVDBatchKernel twoSidedSVDBatchKernelAVX() noexcept
+	{
+		return &twoSidedSVDBatch<Core::Simd::AvxOps>;
+	}
+}}}
+#endif // defined(VCL_MATH_TWOSIDED_BATCH_AVX)
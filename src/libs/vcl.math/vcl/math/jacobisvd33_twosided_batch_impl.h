@@ -0,0 +1,101 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Shared implementation of the batched two-sided Jacobi SVD kernels.
+// The including translation unit is compiled for the instruction set of the
+// operation policy it instantiates the kernel with.
+
+// VCL
+#include <vcl/core/simd/packet.h>
+
+#define VCL_MATH_TWOSIDEDJACOBI_USE_RSQRT
+#define VCL_MATH_TWOSIDEDJACOBI_USE_RCP
+#include <vcl/math/jacobisvd33_twosided_impl.h>
+
+namespace Vcl { namespace Mathematics {
+	template<typename Ops>
+	struct TwoSidedJacobiTraits<Core::Simd::Packet<Ops>>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-22 (Machine eps: 2^-23)
+		VCL_STRONG_INLINE static float epsilon() { return 0.0000002384185791015625f; }
+	};
+}}
+
+namespace {
+	template<typename Ops>
+	int twoSidedSVDBatch(float* A, float* U, float* V, size_t count, bool warm_start)
+	{
+		using Packet = Vcl::Core::Simd::Packet<Ops>;
+		using Matrix = Eigen::Matrix<Packet, 3, 3>;
+
+		const size_t width = Packet::Width;
+		alignas(64) float lanes[Packet::Width];
+
+		// Unused lanes are filled with identity matrices.
+		// Avoid calling inline library functions, which could be merged with
+		// instances compiled for a different instruction set.
+		const auto gather = [&](Matrix& m, const float* src, size_t n) {
+			for (int k = 0; k < 9; k++)
+			{
+				for (size_t i = 0; i < width; i++)
+					lanes[i] = (i < n) ? src[9 * i + k] : ((k % 4 == 0) ? 1.0f : 0.0f);
+				m(k % 3, k / 3) = Packet::load(lanes);
+			}
+		};
+		const auto scatter = [&](float* dst, const Matrix& m, size_t n) {
+			for (int k = 0; k < 9; k++)
+			{
+				m(k % 3, k / 3).store(lanes);
+				for (size_t i = 0; i < n; i++)
+					dst[9 * i + k] = lanes[i];
+			}
+		};
+
+		int iterations = 0;
+		for (size_t base = 0; base < count; base += width)
+		{
+			const size_t n = (count - base < width) ? count - base : width;
+
+			Matrix a, u, v;
+			gather(a, A + 9 * base, n);
+			if (warm_start)
+			{
+				gather(u, U + 9 * base, n);
+				gather(v, V + 9 * base, n);
+			}
+
+			const int iter = Vcl::Mathematics::TwoSidedJacobiSVD(a, u, v, warm_start);
+			iterations = (iter > iterations) ? iter : iterations;
+
+			scatter(A + 9 * base, a, n);
+			scatter(U + 9 * base, u, n);
+			scatter(V + 9 * base, v, n);
+		}
+
+		return iterations;
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstddef>
+
+// Instruction sets for which the batched two-sided Jacobi SVD kernel is compiled.
+// With runtime dispatch enabled, all x86 variants are built and selected on
+// the executing processor.
+#if defined(VCL_VECTORIZE_SSE) || (defined(VCL_VECTORIZE_DISPATCH) && (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)))
+#	define VCL_MATH_TWOSIDED_BATCH_SSE
+#endif
+#if defined(VCL_VECTORIZE_AVX) || (defined(VCL_VECTORIZE_DISPATCH) && (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)))
+#	define VCL_MATH_TWOSIDED_BATCH_AVX
+#endif
+#if defined(VCL_VECTORIZE_AVX512) || (defined(VCL_VECTORIZE_DISPATCH) && (defined(VCL_ARCH_X86) || defined(VCL_ARCH_X64)))
+#	define VCL_MATH_TWOSIDED_BATCH_AVX512
+#endif
+
+namespace Vcl { namespace Mathematics { namespace Detail {
+	/*!
+	 *	\brief Batched two-sided Jacobi SVD kernel
+	 *
+	 *	Matrices are stored densely in column-major order, 9 floats each.
+	 *	The kernels are implemented in separate translation units compiled for
+	 *	the respective instruction set. This header must not pull in any code
+	 *	which could be instantiated with different compiler flags.
+	 *	The kernel returns the largest number of rotations applied to a group
+	 *	of matrices.
+	 */
+	using TwoSidedSVDBatchKernel = int (*)(float* A, float* U, float* V, size_t count, bool warm_start);
+
+#ifdef VCL_MATH_TWOSIDED_BATCH_SSE
+	TwoSidedSVDBatchKernel twoSidedSVDBatchKernelSSE() noexcept;
+#endif
+#ifdef VCL_MATH_TWOSIDED_BATCH_AVX
+	TwoSidedSVDBatchKernel twoSidedSVDBatchKernelAVX() noexcept;
+#endif
+#ifdef VCL_MATH_TWOSIDED_BATCH_AVX512
+	TwoSidedSVDBatchKernel twoSidedSVDBatchKernelAVX512() noexcept;
+#endif
+}}}
@@ -94,6 +94,33 @@ namespace Vcl { namespace Mathematics {
 		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
 	};
 
+	template<>
+	struct TwoSidedJacobiTraits<double4>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-51 (Machine eps: 2^-52)
+		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
+	};
+
+	template<>
+	struct TwoSidedJacobiTraits<double8>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-51 (Machine eps: 2^-52)
+		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
+	};
+
+	template<>
+	struct TwoSidedJacobiTraits<double16>
+	{
+		VCL_STRONG_INLINE static int maxIterations() { return 20; }
+
+		// 2^-51 (Machine eps: 2^-52)
+		VCL_STRONG_INLINE static double epsilon() { return 4.4408920985006261616945266723633e-16; }
+	};
+
 	// Forsythe and Henrici
 	// Not favourable. May yield negative singular values.
 	template<typename Real>
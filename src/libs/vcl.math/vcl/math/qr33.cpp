@@ -74,6 +74,28 @@ namespace Vcl { namespace Mathematics {
 		JacobiRotateQR<double, 2, 0>(R, Q);
 		JacobiRotateQR<double, 2, 1>(R, Q);
 	}
+	void JacobiQR(Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence (1,0), (2,0), (2,1)
+		// of rotations
+		JacobiRotateQR<double4, 1, 0>(R, Q);
+		JacobiRotateQR<double4, 2, 0>(R, Q);
+		JacobiRotateQR<double4, 2, 1>(R, Q);
+	}
+	void JacobiQR(Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence (1,0), (2,0), (2,1)
+		// of rotations
+		JacobiRotateQR<double8, 1, 0>(R, Q);
+		JacobiRotateQR<double8, 2, 0>(R, Q);
+		JacobiRotateQR<double8, 2, 1>(R, Q);
+	}
 
 	void HouseholderQR(Eigen::Matrix<float, 3, 3>& R, Eigen::Matrix<float, 3, 3>& Q)
 	{
@@ -114,4 +136,24 @@ namespace Vcl { namespace Mathematics {
 		HouseholderQR<double, 0>(R, Q);
 		HouseholderQR<double, 1>(R, Q);
 	}
+
+	void HouseholderQR(Eigen::Matrix<double4, 3, 3>& R, Eigen::Matrix<double4, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence 0, 1 column elimination
+		HouseholderQR<double4, 0>(R, Q);
+		HouseholderQR<double4, 1>(R, Q);
+	}
+
+	void HouseholderQR(Eigen::Matrix<double8, 3, 3>& R, Eigen::Matrix<double8, 3, 3>& Q)
+	{
+		// Initialize Q
+		Q.setIdentity();
+
+		// Clear values below the diagonal with a fixed sequence 0, 1 column elimination
+		HouseholderQR<double8, 0>(R, Q);
+		HouseholderQR<double8, 1>(R, Q);
+	}
 }}
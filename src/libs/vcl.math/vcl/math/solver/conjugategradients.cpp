@@ -27,9 +27,14 @@
 // C++ standard library
 #include <limits>
 
+// VCL
+#include <vcl/util/profiler.h>
+
 namespace Vcl { namespace Mathematics { namespace Solver {
 	bool ConjugateGradients::solve(ConjugateGradientsContext* ctx, double* residual)
 	{
+		VCL_PROFILE_ZONE("ConjugateGradients::solve");
+
 		int dofs = ctx->size();
 		if (dofs == 0)
 		{
@@ -48,6 +53,8 @@ namespace Vcl { namespace Mathematics { namespace Solver {
 			iteration++;
 			sub_iteration++;
 
+			VCL_PROFILE_ZONE("ConjugateGradients::iteration");
+
 			// q = A*d
 			ctx->computeQ();
 
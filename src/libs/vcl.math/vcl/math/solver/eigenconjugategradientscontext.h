@@ -28,8 +28,14 @@
 #include <vcl/config/global.h>
 #include <vcl/config/eigen.h>
 
+// C++ standard library
+#include <array>
+#include <utility>
+
 // VCL
+#include <vcl/core/simd/algorithm.h>
 #include <vcl/core/contract.h>
+#include <vcl/core/span.h>
 #include <vcl/math/solver/conjugategradients.h>
 #include <vcl/math/math.h>
 
@@ -73,10 +79,19 @@ namespace Vcl { namespace Mathematics { namespace Solver {
 		// d_a = dot(q, q)
 		void reduceVectors() override
 		{
-			real_t d_r = _res.squaredNorm();
-			real_t d_g = _dir.dot(_q);
-			real_t d_b = _res.dot(_q);
-			real_t d_a = _q.squaredNorm();
+			// Compute all products in a single pass over the vectors
+			const std::array<stdext::span<const real_t>, 3> vectors = { {
+				{ _res.data(), _size },
+				{ _dir.data(), _size },
+				{ _q.data(), _size }
+			} };
+			const std::array<std::pair<int, int>, 4> products = { { { 0, 0 }, { 1, 2 }, { 0, 2 }, { 2, 2 } } };
+			const auto dots = Vcl::Core::Simd::multi_dot(vectors, products);
+
+			real_t d_r = dots[0];
+			real_t d_g = dots[1];
+			real_t d_b = dots[2];
+			real_t d_a = dots[3];
 
 			_alpha = 0.0f;
 			if (fabs(d_g) > 0.0f)
@@ -24,9 +24,14 @@
  */
 #include <vcl/math/solver/jacobi.h>
 
+// VCL
+#include <vcl/util/profiler.h>
+
 namespace Vcl { namespace Mathematics { namespace Solver {
 	bool Jacobi::solve(JacobiContext* ctx, double* residual)
 	{
+		VCL_PROFILE_ZONE("Jacobi::solve");
+
 		int dofs = ctx->size();
 		if (dofs == 0)
 		{
@@ -59,6 +64,8 @@ namespace Vcl { namespace Mathematics { namespace Solver {
 			iteration++;
 			sub_iteration++;
 
+			VCL_PROFILE_ZONE("Jacobi::iteration");
+
 			// x^{n+1} = c + C x^{n}
 			ctx->updateSolution();
 
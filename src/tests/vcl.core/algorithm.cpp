@@ -0,0 +1,209 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/simd/algorithm.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	// Integral values keep the floating point results exact independent of the order of operations
+	template<typename T>
+	std::vector<T> makeValues(size_t size)
+	{
+		std::vector<T> values(size);
+		for (size_t i = 0; i < size; i++)
+			values[i] = static_cast<T>((i * 7) % 11) - T(5);
+		return values;
+	}
+
+	template<typename T, int Width>
+	void testReduce()
+	{
+		for (size_t size = 0; size < 3 * Width + 2; size++)
+		{
+			const auto values = makeValues<T>(size);
+			const T expected = std::accumulate(values.begin(), values.end(), T(3));
+
+			EXPECT_EQ(Vcl::Core::Simd::reduce<Width>(stdext::make_span(values), T(3)), expected) << "Size " << size;
+
+			const T expected_max = std::accumulate(values.begin(), values.end(), T(-100), [](T a, T b) { return std::max(a, b); });
+			const T reduced_max = Vcl::Core::Simd::reduce<Width>(stdext::make_span(values), T(-100), [](auto a, auto b) { return Vcl::select(a < b, b, a); });
+			EXPECT_EQ(reduced_max, expected_max) << "Size " << size;
+		}
+	}
+
+	template<typename T, int Width>
+	void testMinMax()
+	{
+		for (size_t size = 1; size < 3 * Width + 2; size++)
+		{
+			auto values = makeValues<T>(size);
+			values[size / 2] = T(42);
+			values[size - 1] = T(-42);
+
+			const auto mm = Vcl::Core::Simd::minmax<Width>(stdext::make_span(values));
+			const auto expected = std::minmax_element(values.begin(), values.end());
+			EXPECT_EQ(mm.first, *expected.first) << "Size " << size;
+			EXPECT_EQ(mm.second, *expected.second) << "Size " << size;
+		}
+	}
+
+	template<typename T, int Width>
+	void testMultiDot()
+	{
+		for (size_t size = 0; size < 3 * Width + 2; size++)
+		{
+			const auto a = makeValues<T>(size);
+			auto b = makeValues<T>(size);
+			std::reverse(b.begin(), b.end());
+
+			const std::array<stdext::span<const T>, 2> vectors = { { stdext::make_span(a), stdext::make_span(b) } };
+			const std::array<std::pair<int, int>, 3> products = { { { 0, 0 }, { 0, 1 }, { 1, 1 } } };
+			const auto dots = Vcl::Core::Simd::multi_dot<Width>(vectors, products);
+
+			EXPECT_EQ(dots[0], std::inner_product(a.begin(), a.end(), a.begin(), T(0))) << "Size " << size;
+			EXPECT_EQ(dots[1], std::inner_product(a.begin(), a.end(), b.begin(), T(0))) << "Size " << size;
+			EXPECT_EQ(dots[2], std::inner_product(b.begin(), b.end(), b.begin(), T(0))) << "Size " << size;
+		}
+	}
+
+	template<typename T, int Width>
+	void testTransform()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		for (size_t size = 0; size < 3 * Width + 2; size++)
+		{
+			const auto a = makeValues<T>(size);
+			const auto b = makeValues<T>(size + 1);
+
+			// Guard entry behind the output to detect writes beyond the end
+			std::vector<T> out(size + 1, T(-1));
+			Vcl::Core::Simd::transform<Width>(stdext::make_span(a), stdext::make_span(out.data(), size), [](const vector_t& v) { return v * v; });
+			for (size_t i = 0; i < size; i++)
+				EXPECT_EQ(out[i], a[i] * a[i]);
+			EXPECT_EQ(out[size], T(-1));
+
+			Vcl::Core::Simd::transform<Width>(stdext::make_span(a), stdext::make_span(b.data() + 1, size), stdext::make_span(out.data(), size), [](const vector_t& u, const vector_t& v) { return u - v; });
+			for (size_t i = 0; i < size; i++)
+				EXPECT_EQ(out[i], a[i] - b[i + 1]);
+			EXPECT_EQ(out[size], T(-1));
+		}
+	}
+
+	template<typename T, int Width>
+	void testScan()
+	{
+		for (size_t size = 0; size < 3 * Width + 2; size++)
+		{
+			const auto values = makeValues<T>(size);
+
+			std::vector<T> expected(size);
+			std::partial_sum(values.begin(), values.end(), expected.begin());
+
+			std::vector<T> out(size + 1, T(-1));
+			Vcl::Core::Simd::inclusive_scan<Width>(stdext::make_span(values), stdext::make_span(out.data(), size));
+			for (size_t i = 0; i < size; i++)
+				EXPECT_EQ(out[i], expected[i]) << "Size " << size << ", entry " << i;
+			EXPECT_EQ(out[size], T(-1));
+
+			Vcl::Core::Simd::exclusive_scan<Width>(stdext::make_span(values), stdext::make_span(out.data(), size), T(10));
+			for (size_t i = 0; i < size; i++)
+				EXPECT_EQ(out[i], T(10) + (i > 0 ? expected[i - 1] : T(0))) << "Size " << size << ", entry " << i;
+			EXPECT_EQ(out[size], T(-1));
+
+			// In-place
+			auto in_place = values;
+			Vcl::Core::Simd::inclusive_scan<Width>(stdext::make_span(in_place), stdext::make_span(in_place));
+			EXPECT_EQ(in_place, expected) << "Size " << size;
+		}
+	}
+}
+
+TEST(AlgorithmTest, Reduce)
+{
+	testReduce<float, 4>();
+	testReduce<float, 8>();
+	testReduce<float, 16>();
+	testReduce<double, 4>();
+	testReduce<double, 8>();
+	testReduce<int, 8>();
+
+	const auto values = makeValues<float>(100);
+	EXPECT_EQ(Vcl::Core::Simd::reduce(stdext::make_span(values)), std::accumulate(values.begin(), values.end(), 0.0f));
+}
+
+TEST(AlgorithmTest, MinMax)
+{
+	testMinMax<float, 4>();
+	testMinMax<float, 8>();
+	testMinMax<float, 16>();
+	testMinMax<double, 4>();
+	testMinMax<double, 16>();
+}
+
+TEST(AlgorithmTest, MultiDot)
+{
+	testMultiDot<float, 4>();
+	testMultiDot<float, 8>();
+	testMultiDot<float, 16>();
+	testMultiDot<double, 8>();
+}
+
+TEST(AlgorithmTest, Transform)
+{
+	testTransform<float, 4>();
+	testTransform<float, 8>();
+	testTransform<float, 16>();
+	testTransform<double, 4>();
+	testTransform<int, 16>();
+}
+
+TEST(AlgorithmTest, Scan)
+{
+	testScan<float, 4>();
+	testScan<float, 8>();
+	testScan<float, 16>();
+	testScan<double, 4>();
+	testScan<double, 8>();
+	testScan<double, 16>();
+	testScan<int, 4>();
+	testScan<int, 8>();
+	testScan<int, 16>();
+}
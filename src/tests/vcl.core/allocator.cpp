@@ -28,9 +28,15 @@
 
 // Include the relevant parts from the library
 #include <vcl/core/memory/allocator.h>
+#include <vcl/core/memory/arena.h>
+#include <vcl/core/memory/pool.h>
 
 // C++ standard library
+#include <atomic>
+#include <list>
+#include <numeric>
 #include <scoped_allocator>
+#include <thread>
 #include <vector>
 
 VCL_BEGIN_EXTERNAL_HEADERS
@@ -121,3 +127,210 @@ TEST(AllocatorTest, AlignedAllocInitObject)
 	auto base = reinterpret_cast<size_t>(v.data()) & 0x3f;
 	EXPECT_EQ(0ull, base);
 }
+
+TEST(AllocatorTest, PageAllocInitObject)
+{
+	using namespace Vcl::Core;
+
+	std::vector<SimpleObject, Allocator<SimpleObject, PageAllocPolicy<SimpleObject, PageSize::Regular>>> v(10, { 4 });
+	EXPECT_EQ(4, v[5].x);
+
+	v.resize(15);
+	EXPECT_EQ(5, v[13].x);
+
+	// Memory is page aligned
+	auto base = reinterpret_cast<size_t>(v.data()) & 0xfff;
+	EXPECT_EQ(0ull, base);
+}
+
+TEST(AllocatorTest, HugePageAlloc)
+{
+	using namespace Vcl::Core;
+
+	// Allocate a buffer spanning multiple huge pages
+	const size_t size = 5 * 1024 * 1024 + 3;
+	std::vector<int, Allocator<int, HugePageAllocPolicy<int>, NoInitObjectTraits<int>>> v(size);
+
+	// Memory is aligned to the huge page size
+	auto base = reinterpret_cast<size_t>(v.data()) & (2 * 1024 * 1024 - 1);
+	EXPECT_EQ(0ull, base);
+
+	for (size_t i = 0; i < size; i++)
+		v[i] = static_cast<int>(i);
+	EXPECT_EQ(static_cast<int>(size - 1), v.back());
+}
+
+TEST(AllocatorTest, NumaAlloc)
+{
+	using namespace Vcl::Core;
+
+	// The placement is only a hint, the memory is always usable
+	PageAllocPolicy<float, PageSize::Regular, NumaPlacement::FirstTouch> first_touch;
+	InterleavedNumaAllocPolicy<float> interleaved;
+
+	const size_t size = 1 << 20;
+	float* a = first_touch.allocate(size);
+	float* b = interleaved.allocate(size);
+	ASSERT_NE(nullptr, a);
+	ASSERT_NE(nullptr, b);
+
+	// Fresh pages are zero initialised
+	EXPECT_EQ(0.0f, a[size - 1]);
+	EXPECT_EQ(0.0f, b[size - 1]);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		a[i] = 1.0f;
+		b[i] = 2.0f;
+	}
+	EXPECT_EQ(1.0f, a[size / 2]);
+	EXPECT_EQ(2.0f, b[size / 2]);
+
+	first_touch.deallocate(a, size);
+	interleaved.deallocate(b, size);
+
+	EXPECT_EQ(nullptr, first_touch.allocate(0));
+}
+
+TEST(AllocatorTest, ArenaAllocInitObject)
+{
+	using namespace Vcl::Core;
+
+	MemoryArena arena{ 1024 };
+	{
+		ArenaScope scope{ arena };
+
+		using alloc_t = Allocator<SimpleObject, ArenaAllocPolicy<SimpleObject>>;
+		std::vector<SimpleObject, alloc_t> v(10, { 4 }, alloc_t{ ArenaAllocPolicy<SimpleObject>{ arena } });
+		EXPECT_EQ(4, v[5].x);
+
+		v.resize(15);
+		EXPECT_EQ(5, v[13].x);
+
+		// Requests larger than a chunk are supported
+		std::vector<double, Allocator<double, ArenaAllocPolicy<double>>> w(1000, 1.0, Allocator<double, ArenaAllocPolicy<double>>{ ArenaAllocPolicy<double>{ arena } });
+		EXPECT_EQ(1.0, w[999]);
+		EXPECT_EQ(0ull, reinterpret_cast<size_t>(w.data()) % alignof(double));
+	}
+
+	// Memory is reused after the scope was left
+	const size_t capacity = arena.capacity();
+	{
+		ArenaScope scope{ arena };
+		std::vector<double, Allocator<double, ArenaAllocPolicy<double>>> w(1000, 1.0, Allocator<double, ArenaAllocPolicy<double>>{ ArenaAllocPolicy<double>{ arena } });
+	}
+	EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST(AllocatorTest, ArenaAllocThreadLocal)
+{
+	using namespace Vcl::Core;
+
+	ArenaScope scope;
+	std::vector<int, ArenaAllocator<int>> v;
+	for (int i = 0; i < 1000; i++)
+		v.push_back(i);
+
+	EXPECT_EQ(999, v.back());
+	EXPECT_GE(MemoryArena::threadLocal().capacity(), 1000 * sizeof(int));
+}
+
+TEST(AllocatorTest, PoolAllocInitObject)
+{
+	using namespace Vcl::Core;
+
+	std::vector<SimpleObject, PoolAllocator<SimpleObject>> v(10, { 4 });
+	EXPECT_EQ(4, v[5].x);
+
+	// Grow beyond the size of a block
+	v.resize(150);
+	EXPECT_EQ(5, v[130].x);
+	EXPECT_EQ(4, v[9].x);
+}
+
+TEST(AllocatorTest, PoolAllocReuse)
+{
+	using namespace Vcl::Core;
+
+	MemoryPool pool{ 24, 16, 4 };
+	EXPECT_EQ(32u, pool.blockSize());
+
+	void* a = pool.allocate();
+	void* b = pool.allocate();
+	EXPECT_EQ(0ull, reinterpret_cast<size_t>(a) % 16);
+	EXPECT_EQ(0ull, reinterpret_cast<size_t>(b) % 16);
+	EXPECT_NE(a, b);
+
+	// Released blocks are handed out first
+	pool.deallocate(a);
+	EXPECT_EQ(a, pool.allocate());
+
+	// New chunks are added on demand
+	for (int i = 0; i < 10; i++)
+		pool.allocate();
+	EXPECT_EQ(12u, pool.capacity());
+
+	// Node based containers use a block per node
+	std::list<int, PoolAllocator<int>> l;
+	for (int i = 0; i < 100; i++)
+		l.push_back(i);
+	EXPECT_EQ(4950, std::accumulate(l.begin(), l.end(), 0));
+}
+
+TEST(AllocatorTest, PoolAllocCrossThread)
+{
+	using namespace Vcl::Core;
+
+	// Blocks released on another thread are returned to their owner
+	MemoryPool owner{ 16, 16, 4 };
+	MemoryPool other{ 16, 16, 4 };
+	void* a = owner.allocate();
+	for (int i = 0; i < 3; i++)
+		owner.allocate();
+	std::thread{ [&]() { other.deallocate(a); } }.join();
+	EXPECT_EQ(a, owner.allocate());
+	EXPECT_EQ(4u, owner.capacity());
+	EXPECT_EQ(0u, other.capacity());
+
+	// Blocks outlive the thread they were allocated on
+	std::list<int, PoolAllocator<int>> l;
+	std::thread{ [&]() {
+		for (int i = 0; i < 100; i++)
+			l.push_back(i);
+	} }.join();
+	EXPECT_EQ(4950, std::accumulate(l.begin(), l.end(), 0));
+	l.clear();
+
+	std::vector<int, PoolAllocator<int>> v;
+	std::thread{ [&]() { v.assign(10, 3); } }.join();
+	v.push_back(4);
+	EXPECT_EQ(34, std::accumulate(v.begin(), v.end(), 0));
+}
+
+TEST(AllocatorTest, PoolAllocOwnerExit)
+{
+	using namespace Vcl::Core;
+
+	// Return blocks while the allocating thread terminates
+	PoolAllocPolicy<int> policy;
+	for (int round = 0; round < 1000; round++)
+	{
+		std::vector<int*> blocks(round % 4);
+		std::atomic<bool> allocated{ false };
+
+		std::thread owner{ [&]() {
+			for (auto& block : blocks)
+				block = policy.allocate(1);
+			allocated = true;
+		} };
+		std::thread other{ [&]() {
+			while (!allocated)
+				std::this_thread::yield();
+			for (auto block : blocks)
+				policy.deallocate(block, 1);
+		} };
+
+		owner.join();
+		other.join();
+	}
+}
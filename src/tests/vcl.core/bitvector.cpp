@@ -28,9 +28,15 @@
 
 // Include the relevant parts from the library
 #include <vcl/core/container/bitvector.h>
+#include <vcl/core/container/concurrentbitvector.h>
+#include <vcl/core/container/packedbitvector.h>
+#include <vcl/core/memory/arena.h>
+#include <vcl/core/memory/pool.h>
 
 // C++ standard library
+#include <atomic>
 #include <random>
+#include <thread>
 #include <vector>
 
 VCL_BEGIN_EXTERNAL_HEADERS
@@ -102,3 +108,217 @@ TEST(BitVectorTest, Generation)
 	v.assign(19, false);
 	EXPECT_EQ(v.generation(), 1);
 }
+
+TEST(BitVectorTest, Allocators)
+{
+	using namespace Vcl::Core;
+
+	ArenaScope scope;
+	BitVector<ArenaAllocator> a(19, false);
+	BitVector<PoolAllocator> p(19, false);
+
+	a[17] = true;
+	p[17] = true;
+	EXPECT_TRUE(a[17]);
+	EXPECT_TRUE(p[17]);
+
+	a.assign(500, false);
+	p.assign(500, false);
+	EXPECT_FALSE(a[17]);
+	EXPECT_FALSE(p[17]);
+	EXPECT_EQ(500, a.size());
+	EXPECT_EQ(500, p.size());
+}
+
+TEST(PackedBitVectorTest, SetBit)
+{
+	using namespace Vcl::Core;
+
+	PackedBitVector<> v(200, false);
+	EXPECT_FALSE(v[17]);
+	EXPECT_FALSE(v.any());
+
+	v.set(17);
+	v.setBit(130, true);
+	EXPECT_TRUE(v[17]);
+	EXPECT_TRUE(v[130]);
+	EXPECT_EQ(2u, v.count());
+
+	EXPECT_TRUE(v.testAndSet(17));
+	EXPECT_FALSE(v.testAndSet(18));
+	EXPECT_EQ(3u, v.count());
+
+	v.reset(17);
+	v.flip(18);
+	EXPECT_FALSE(v[17]);
+	EXPECT_FALSE(v[18]);
+	EXPECT_EQ(1u, v.count());
+}
+
+TEST(PackedBitVectorTest, Assign)
+{
+	using namespace Vcl::Core;
+
+	PackedBitVector<> v(131, true);
+	EXPECT_EQ(131u, v.count());
+	EXPECT_TRUE(v[130]);
+
+	// Resetting only touches dirty words
+	v.assign(131, false);
+	EXPECT_EQ(0u, v.count());
+	EXPECT_EQ(PackedBitVector<>::npos, v.findFirst());
+
+	v.set(5000 % 131);
+	v.resetAllBitsToFalse();
+	EXPECT_FALSE(v.any());
+
+	v.assign(10, true);
+	EXPECT_EQ(10u, v.size());
+	EXPECT_EQ(10u, v.count());
+}
+
+TEST(PackedBitVectorTest, Scan)
+{
+	using namespace Vcl::Core;
+
+	const size_t n = 100000;
+	std::mt19937 rnd;
+	std::uniform_int_distribution<size_t> dist(0, n - 1);
+
+	PackedBitVector<> v(n);
+	std::vector<bool> ref(n, false);
+	for (int i = 0; i < 500; i++)
+	{
+		const size_t idx = dist(rnd);
+		v.set(idx);
+		ref[idx] = true;
+	}
+
+	std::vector<size_t> expected;
+	for (size_t i = 0; i < n; i++)
+		if (ref[i])
+			expected.push_back(i);
+
+	std::vector<size_t> visited;
+	v.forEachSetBit([&visited](size_t idx) { visited.push_back(idx); });
+	EXPECT_EQ(expected, visited);
+
+	std::vector<size_t> iterated(v.setBits().begin(), v.setBits().end());
+	EXPECT_EQ(expected, iterated);
+
+	EXPECT_EQ(expected.size(), v.count());
+	EXPECT_EQ(expected.front(), v.findFirst());
+	EXPECT_EQ(expected[1], v.findNext(expected[0] + 1));
+	EXPECT_EQ(PackedBitVector<>::npos, v.findNext(expected.back() + 1));
+}
+
+TEST(PackedBitVectorTest, BulkOperations)
+{
+	using namespace Vcl::Core;
+
+	const size_t n = 1037;
+	PackedBitVector<> a(n), b(n);
+	for (size_t i = 0; i < n; i += 2)
+		a.set(i);
+	for (size_t i = 0; i < n; i += 3)
+		b.set(i);
+
+	PackedBitVector<> c(n);
+	c |= a;
+	c |= b;
+	PackedBitVector<> d(n, true);
+	d &= a;
+	d &= b;
+	PackedBitVector<> e(n, true);
+	e.andNot(a);
+
+	bool check = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		check = check && c[i] == (i % 2 == 0 || i % 3 == 0);
+		check = check && d[i] == (i % 6 == 0);
+		check = check && e[i] == (i % 2 != 0);
+	}
+	EXPECT_TRUE(check);
+
+	// Bits set by a bulk operation are found by the scans
+	EXPECT_EQ((n + 5) / 6, d.count());
+	c.resetAllBitsToFalse();
+	EXPECT_FALSE(c.any());
+}
+
+TEST(ConcurrentBitVectorTest, SetBit)
+{
+	using namespace Vcl::Core;
+
+	ConcurrentBitVector v(100);
+	EXPECT_FALSE(v[47]);
+	EXPECT_FALSE(v.testAndSet(47));
+	EXPECT_TRUE(v.testAndSet(47));
+	v.set(48);
+	EXPECT_TRUE(v[47]);
+	EXPECT_TRUE(v[48]);
+	EXPECT_FALSE(v[49]);
+
+	v.reset(47);
+	EXPECT_FALSE(v[47]);
+	EXPECT_EQ(1, v.count());
+}
+
+TEST(ConcurrentBitVectorTest, Generation)
+{
+	using namespace Vcl::Core;
+
+	ConcurrentBitVector v(1000);
+	for (int g = 0; g < 70000; g++)
+	{
+		v.set(g % 1000);
+		v.resetAllBitsToFalse();
+		if (v.count() != 0 || v[g % 1000])
+		{
+			ADD_FAILURE() << "Bit is cleared after generation " << g;
+			break;
+		}
+	}
+
+	// Words written in an older generation are overwritten on first access
+	v.set(3);
+	v.resetAllBitsToFalse();
+	v.set(4);
+	EXPECT_FALSE(v[3]);
+	EXPECT_TRUE(v[4]);
+}
+
+TEST(ConcurrentBitVectorTest, ConcurrentTestAndSet)
+{
+	using namespace Vcl::Core;
+
+	const size_t n = 10000;
+	const unsigned int nr_threads = 8;
+	ConcurrentBitVector v(n);
+	for (int round = 0; round < 2; round++)
+	{
+		// Every thread visits every bit, but each bit is claimed once
+		std::atomic<size_t> claimed{ 0 };
+		std::vector<std::thread> threads;
+		for (unsigned int t = 0; t < nr_threads; t++)
+		{
+			threads.emplace_back([&v, &claimed, t, n]() {
+				size_t local = 0;
+				for (size_t i = 0; i < n; i++)
+				{
+					if (!v.testAndSet((i * 7 + t * 1013) % n))
+						local++;
+				}
+				claimed += local;
+			});
+		}
+		for (auto& thread : threads)
+			thread.join();
+
+		EXPECT_EQ(n, claimed.load());
+		EXPECT_EQ(n, v.count());
+		v.resetAllBitsToFalse();
+		EXPECT_EQ(0, v.count());
+	}
+}
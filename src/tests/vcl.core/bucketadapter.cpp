@@ -0,0 +1,166 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/container/bucketadapter.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	template<typename T>
+	std::vector<T> randomValues(size_t n, unsigned int seed)
+	{
+		std::mt19937 rnd{ seed };
+		std::uniform_int_distribution<int> dist{ -100000, 100000 };
+
+		std::vector<T> values(n);
+		for (auto& v : values)
+			v = static_cast<T>(dist(rnd));
+		return values;
+	}
+
+	template<typename T, typename Compare = std::less<T>>
+	std::vector<T> referenceTopK(std::vector<T> values, size_t k, Compare comp = Compare())
+	{
+		k = std::min(k, values.size());
+		std::partial_sort(values.begin(), values.begin() + k, values.end(), comp);
+		values.resize(k);
+		return values;
+	}
+}
+
+TEST(BucketAdapterTest, Push)
+{
+	using namespace Vcl::Core;
+
+	const auto values = randomValues<int>(1000, 5);
+
+	std::vector<int> best;
+	best.reserve(10);
+	bucket_adapter<int> bucket{ best };
+	for (int v : values)
+		bucket.push(v);
+
+	EXPECT_EQ(10u, bucket.size());
+	EXPECT_EQ(referenceTopK(values, 10), bucket.sorted());
+	EXPECT_EQ(bucket.sorted().back(), bucket.top());
+}
+
+TEST(BucketAdapterTest, PushRange)
+{
+	using namespace Vcl::Core;
+	using MaxBucket = bucket_adapter<int, std::greater<int>>;
+
+	const auto floats = randomValues<float>(1003, 7);
+	const auto doubles = randomValues<double>(1003, 11);
+	const auto ints = randomValues<int>(1003, 13);
+
+	for (size_t k : { 1, 7, 64, 2000 })
+	{
+		std::vector<float> best_floats;
+		best_floats.reserve(k);
+		bucket_adapter<float>{ best_floats }.push(stdext::make_span(floats));
+		EXPECT_EQ(referenceTopK(floats, k), bucket_adapter<float>{ best_floats }.sorted()) << "k = " << k;
+
+		std::vector<double> best_doubles;
+		best_doubles.reserve(k);
+		bucket_adapter<double>{ best_doubles }.push(stdext::make_span(doubles));
+		EXPECT_EQ(referenceTopK(doubles, k), bucket_adapter<double>{ best_doubles }.sorted()) << "k = " << k;
+
+		std::vector<int> best_ints;
+		best_ints.reserve(k);
+		MaxBucket{ best_ints }.push(stdext::make_span(ints));
+		EXPECT_EQ(referenceTopK(ints, k, std::greater<int>{}), MaxBucket{ best_ints }.sorted()) << "k = " << k;
+	}
+}
+
+TEST(BucketAdapterTest, PushKeys)
+{
+	using namespace Vcl::Core;
+	using Neighbour = std::pair<float, size_t>;
+
+	// Distinct distances, as the keys decide about ties
+	std::vector<float> distances(500);
+	std::iota(distances.begin(), distances.end(), 0.0f);
+	std::shuffle(distances.begin(), distances.end(), std::mt19937{ 17 });
+
+	std::vector<Neighbour> reference(distances.size());
+	for (size_t i = 0; i < distances.size(); i++)
+		reference[i] = { distances[i], i };
+
+	std::vector<Neighbour> knn;
+	knn.reserve(8);
+	bucket_adapter<Neighbour> bucket{ knn };
+	bucket.push(
+		stdext::make_span(distances),
+		[](const Neighbour& n) { return n.first; },
+		[&distances](size_t i) { return Neighbour{ distances[i], i }; });
+
+	EXPECT_EQ(referenceTopK(reference, 8), bucket.sorted());
+}
+
+TEST(BucketAdapterTest, Merge)
+{
+	using namespace Vcl::Core;
+
+	const auto values = randomValues<float>(300, 19);
+
+	std::vector<float> lhs, rhs;
+	lhs.reserve(20);
+	rhs.reserve(20);
+	bucket_adapter<float> a{ lhs }, b{ rhs };
+	a.push(stdext::make_span(values.data(), 100));
+	b.push(stdext::make_span(values.data() + 100, 200));
+	a.merge(b);
+
+	EXPECT_EQ(referenceTopK(values, 20), a.sorted());
+}
+
+TEST(BucketAdapterTest, PartitionedTopK)
+{
+	using namespace Vcl::Core;
+
+	ThreadPool pool{ 4 };
+	const auto values = randomValues<float>(100000, 23);
+
+	EXPECT_EQ(referenceTopK(values, 50), top_k(pool, stdext::make_span(values), 50));
+	EXPECT_EQ(referenceTopK(values, 7, std::greater<float>{}), top_k(pool, stdext::make_span(values), 7, std::greater<float>{}));
+	EXPECT_EQ(referenceTopK(std::vector<float>(values.begin(), values.begin() + 10), 20), top_k(pool, stdext::make_span(values.data(), 10), 20));
+	EXPECT_TRUE(top_k(pool, stdext::make_span(values), 0).empty());
+}
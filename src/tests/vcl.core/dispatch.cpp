@@ -0,0 +1,95 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdlib>
+
+// Include the relevant parts from the library
+#include <vcl/core/simd/dispatch.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	int implNone() { return 0; }
+	int implSSE() { return 1; }
+	int implAVX() { return 2; }
+	int implAVX512() { return 3; }
+}
+
+TEST(SimdDispatch, Features)
+{
+	using namespace Vcl::Core::Simd;
+
+	const auto& features = cpuFeatures();
+
+	// Extensions imply their predecessors
+	if (features.AVX2)
+	{
+		EXPECT_TRUE(features.AVX);
+	}
+	if (features.AVX512VL)
+	{
+		EXPECT_TRUE(features.AVX512F);
+	}
+
+	// The library can only run on processors supporting its configuration
+	EXPECT_TRUE(isSupported(compiledSimdExt()) || std::getenv("VCL_SIMD_EXT"));
+	EXPECT_TRUE(isSupported(SimdExt::None));
+}
+
+TEST(SimdDispatch, Select)
+{
+	using namespace Vcl::Core::Simd;
+	using Func = int (*)();
+
+	Dispatcher<Func> dispatcher = {
+		{ SimdExt::None, implNone },
+		{ SimdExt::SSE, implSSE },
+		{ SimdExt::AVX, implAVX },
+		{ SimdExt::AVX512, implAVX512 },
+	};
+	ASSERT_TRUE(dispatcher);
+
+	const SimdExt active = activeSimdExt();
+	if (active == SimdExt::NEON)
+		EXPECT_EQ(dispatcher.simdExt(), SimdExt::None);
+	else
+		EXPECT_EQ(dispatcher.simdExt(), active);
+	EXPECT_EQ(dispatcher.get()(), static_cast<int>(dispatcher.simdExt()));
+
+	// Missing implementations are skipped
+	Dispatcher<Func> partial = {
+		{ SimdExt::None, implNone },
+		{ SimdExt::AVX512, nullptr },
+	};
+	EXPECT_EQ(partial.simdExt(), SimdExt::None);
+	EXPECT_EQ(partial.get(), &implNone);
+}
@@ -0,0 +1,238 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+// Include the relevant parts from the library
+#include <vcl/core/container/flathashmap.h>
+#include <vcl/core/memory/allocator.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	//! Allocator failing once a shared number of allocations is used up
+	template<typename T>
+	struct LimitedAllocator
+	{
+		using value_type = T;
+
+		explicit LimitedAllocator(int* budget) noexcept
+		: budget(budget) {}
+		template<typename U>
+		LimitedAllocator(const LimitedAllocator<U>& other) noexcept
+		: budget(other.budget) {}
+
+		T* allocate(size_t n)
+		{
+			if (*budget == 0)
+				throw std::bad_alloc();
+
+			(*budget)--;
+			return std::allocator<T>{}.allocate(n);
+		}
+		void deallocate(T* p, size_t n) noexcept { std::allocator<T>{}.deallocate(p, n); }
+
+		int* budget;
+	};
+
+	template<typename T, typename U>
+	bool operator==(const LimitedAllocator<T>& a, const LimitedAllocator<U>& b) { return a.budget == b.budget; }
+	template<typename T, typename U>
+	bool operator!=(const LimitedAllocator<T>& a, const LimitedAllocator<U>& b) { return a.budget != b.budget; }
+}
+
+TEST(FlatHashMapTest, CompareToUnorderedMap)
+{
+	using namespace Vcl::Core;
+
+	std::mt19937 rnd;
+	std::uniform_int_distribution<int> keys{ 0, 5000 };
+
+	FlatHashMap<int, int> map;
+	std::unordered_map<int, int> reference;
+
+	// Mix insertions and deletions to create deleted slots
+	for (int i = 0; i < 100000; i++)
+	{
+		const int key = keys(rnd);
+		if (i % 3 == 0)
+		{
+			EXPECT_EQ(reference.erase(key), map.erase(key));
+		} else
+		{
+			const auto inserted = map.emplace(key, i);
+			EXPECT_EQ(reference.emplace(key, i).second, inserted.second);
+			EXPECT_EQ(key, inserted.first->first);
+		}
+	}
+
+	EXPECT_EQ(reference.size(), map.size());
+	for (const auto& entry : reference)
+	{
+		const auto found = map.find(entry.first);
+		ASSERT_NE(map.end(), found);
+		EXPECT_EQ(entry.second, found->second);
+	}
+
+	size_t nr_entries = 0;
+	for (const auto& entry : map)
+	{
+		EXPECT_EQ(reference.at(entry.first), entry.second);
+		nr_entries++;
+	}
+	EXPECT_EQ(reference.size(), nr_entries);
+
+	// Remove all entries while iterating
+	for (auto it = map.begin(); it != map.end();)
+		it = map.erase(it);
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(map.end(), map.begin());
+	EXPECT_EQ(map.end(), map.find(0));
+}
+
+TEST(FlatHashMapTest, MoveOnlyValues)
+{
+	using namespace Vcl::Core;
+
+	FlatHashMap<std::string, std::unique_ptr<int>> map;
+	EXPECT_EQ(map.end(), map.find("empty"));
+
+	map.reserve(100);
+	const size_t capacity = map.capacity();
+	for (int i = 0; i < 100; i++)
+		map.emplace(std::to_string(i), std::make_unique<int>(i));
+	EXPECT_EQ(capacity, map.capacity()) << "Reserved slots are sufficient";
+
+	for (int i = 0; i < 1000; i++)
+		map[std::to_string(i)] = std::make_unique<int>(i);
+
+	auto moved = std::move(map);
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(1000u, moved.size());
+	for (int i = 0; i < 1000; i++)
+		EXPECT_EQ(i, *moved.at(std::to_string(i)));
+
+	EXPECT_THROW(moved.at("missing"), std::out_of_range);
+
+	moved.clear();
+	EXPECT_TRUE(moved.empty());
+	EXPECT_EQ(moved.end(), moved.find("1"));
+}
+
+TEST(FlatHashMapTest, HeterogeneousLookup)
+{
+	using namespace Vcl::Core;
+	using Vcl::Util::StringHash;
+
+	FlatHashMap<std::string, int, StringHasher, StringEqual> map;
+	map.emplace("position", 0);
+	map.emplace("normal", 1);
+	map.emplace("colour", 2);
+
+	auto copy = map;
+	map.erase("colour");
+
+	EXPECT_EQ(1, map.find("normal")->second);
+	EXPECT_EQ(0, map.find(stdext::string_view{ "position" })->second);
+	EXPECT_EQ(map.end(), map.find("colour"));
+	EXPECT_EQ(3u, copy.size());
+	EXPECT_EQ(2, copy.find("colour")->second);
+
+	// Look up using precomputed hashes
+	EXPECT_EQ(1, map.find("normal", StringHash("normal").hash())->second);
+	EXPECT_EQ(map.end(), map.find("colour", StringHash("colour").hash()));
+
+	// Iterators are not mistaken for transparent keys
+	map.erase(map.find("normal"));
+	map.erase(map.cbegin());
+	EXPECT_TRUE(map.empty());
+
+	FlatHashSet<std::string, StringHasher, StringEqual> set;
+	set.insert("position");
+	set.erase(set.find("position"));
+	EXPECT_TRUE(set.empty());
+}
+
+TEST(FlatHashSetTest, CustomAllocator)
+{
+	using namespace Vcl::Core;
+
+	FlatHashSet<int, std::hash<int>, std::equal_to<int>, Allocator<int, AlignedAllocPolicy<int, 64>>> set;
+	for (int i = 0; i < 1000; i++)
+		EXPECT_TRUE(set.insert(2 * i).second);
+	EXPECT_FALSE(set.emplace(10).second);
+
+	for (int i = 0; i < 2000; i++)
+		EXPECT_EQ(i % 2 == 0, set.contains(i)) << i;
+
+	int sum = 0;
+	for (int v : set)
+		sum += v;
+	EXPECT_EQ(999 * 1000, sum);
+}
+
+TEST(FlatHashMapTest, FailedGrowth)
+{
+	using namespace Vcl::Core;
+
+	using Map = FlatHashMap<int, std::string, std::hash<int>, std::equal_to<int>, LimitedAllocator<std::pair<const int, std::string>>>;
+
+	// Control bytes and slots of the initial table
+	int budget = 2;
+	Map map{ 0, {}, {}, Map::allocator_type{ &budget } };
+
+	int inserted = 0;
+	try
+	{
+		for (; inserted < 1000; inserted++)
+			map.emplace(inserted, std::to_string(inserted));
+	}
+	catch (const std::bad_alloc&)
+	{
+	}
+	ASSERT_GT(inserted, 0);
+	ASSERT_LT(inserted, 1000);
+
+	// The table keeps its entries if growing fails at the slots
+	budget = 1;
+	EXPECT_THROW(map.emplace(inserted, std::to_string(inserted)), std::bad_alloc);
+	EXPECT_EQ(static_cast<size_t>(inserted), map.size());
+	for (int i = 0; i < inserted; i++)
+		EXPECT_EQ(std::to_string(i), map.find(i)->second) << i;
+
+	budget = 2;
+	map.emplace(inserted, std::to_string(inserted));
+	EXPECT_EQ(static_cast<size_t>(inserted + 1), map.size());
+}
@@ -36,6 +36,56 @@ VCL_BEGIN_EXTERNAL_HEADERS
 #include <gtest/gtest.h>
 VCL_END_EXTERNAL_HEADERS
 
+namespace {
+	template<typename T, int Width>
+	void testMaskedGather()
+	{
+		using int_t = Vcl::VectorScalar<int, Width>;
+
+		T mem[32];
+		for (int i = 0; i < 32; i++)
+			mem[i] = T(i + 1);
+
+		int idx_mem[Width];
+		for (int i = 0; i < Width; i++)
+			idx_mem[i] = (7 * i) % 23;
+
+		int_t idx;
+		Vcl::load(idx, idx_mem);
+		const auto mask = idx < int_t(12);
+
+		const auto gathered = Vcl::gather(mem, idx, mask);
+		for (int i = 0; i < Width; i++)
+			EXPECT_EQ(gathered[i], idx_mem[i] < 12 ? mem[idx_mem[i]] : T(0)) << "Lane " << i << " of " << Width << "-way code failed.";
+	}
+
+	template<int Width, int Stride>
+	void testInterleavedGather()
+	{
+		using int_t = Vcl::VectorScalar<int, Width>;
+
+		Vcl::Core::InterleavedArray<float, 3, 3, Stride> mem(37);
+		for (int i = 0; i < 37; i++)
+		{
+			for (int k = 0; k < 9; k++)
+				mem.template at<float>(i)(k % 3, k / 3) = float(9 * i + k);
+		}
+
+		int idx_mem[Width];
+		for (int i = 0; i < Width; i++)
+			idx_mem[i] = (7 * i + 3) % 37;
+
+		int_t idx;
+		Vcl::load(idx, idx_mem);
+		const auto gathered = Vcl::gather(mem, idx);
+		for (int i = 0; i < Width; i++)
+		{
+			for (int k = 0; k < 9; k++)
+				EXPECT_EQ(gathered(k % 3, k / 3)[i], mem.template at<float>(idx_mem[i])(k % 3, k / 3)) << "Lane " << i << " of " << Width << "-way code failed for stride " << Stride << ".";
+		}
+	}
+}
+
 // Tests the scalar gather function.
 TEST(GatherTest, Scalar)
 {
@@ -191,3 +241,55 @@ TEST(GatherTest, Matrix)
 	EXPECT_TRUE(all(ref16(1) == Vcl::gather<float, 16, 3, 1>(mem, idx16)(1))) << "16-way code failed.";
 	EXPECT_TRUE(all(ref16(2) == Vcl::gather<float, 16, 3, 1>(mem, idx16)(2))) << "16-way code failed.";
 }
+
+TEST(GatherTest, Masked)
+{
+	testMaskedGather<float, 4>();
+	testMaskedGather<float, 8>();
+	testMaskedGather<float, 16>();
+	testMaskedGather<int, 4>();
+	testMaskedGather<int, 8>();
+	testMaskedGather<int, 16>();
+	testMaskedGather<double, 4>();
+	testMaskedGather<double, 8>();
+	testMaskedGather<double, 16>();
+}
+
+TEST(GatherTest, InterleavedArray)
+{
+	testInterleavedGather<4, 0>();
+	testInterleavedGather<8, 0>();
+	testInterleavedGather<16, 0>();
+	testInterleavedGather<4, 4>();
+	testInterleavedGather<8, 8>();
+	testInterleavedGather<16, 16>();
+	testInterleavedGather<4, Vcl::Core::DynamicStride>();
+	testInterleavedGather<8, Vcl::Core::DynamicStride>();
+	testInterleavedGather<16, Vcl::Core::DynamicStride>();
+}
+
+TEST(GatherTest, Integer)
+{
+	using Vcl::int16;
+	using Vcl::int4;
+	using Vcl::int8;
+
+	int mem[32];
+	for (int i = 0; i < 32; i++)
+		mem[i] = 3 * i + 1;
+
+	int16 idx16{ 3, 26, 1, 15, 12, 29, 0, 19, 4, 8, 2, 21, 25, 28, 11, 7 };
+	const int16 gathered16 = Vcl::gather(mem, idx16);
+	for (int i = 0; i < 16; i++)
+		EXPECT_EQ(gathered16[i], mem[idx16[i]]) << "16-way code failed.";
+
+	int8 idx8{ 3, 26, 1, 15, 12, 29, 0, 19 };
+	const int8 gathered8 = Vcl::gather(mem, idx8);
+	for (int i = 0; i < 8; i++)
+		EXPECT_EQ(gathered8[i], mem[idx8[i]]) << "8-way code failed.";
+
+	int4 idx4{ 3, 26, 1, 15 };
+	const int4 gathered4 = Vcl::gather(mem, idx4);
+	for (int i = 0; i < 4; i++)
+		EXPECT_EQ(gathered4[i], mem[idx4[i]]) << "4-way code failed.";
+}
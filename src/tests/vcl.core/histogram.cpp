@@ -0,0 +1,76 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <random>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/algorithm/histogram.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	void BuildHistogramTest(Vcl::Core::ThreadPool& pool, unsigned int buckets, unsigned int size)
+	{
+		using namespace Vcl::Core;
+
+		// Random number generator
+		std::mt19937 rnd;
+		std::uniform_int_distribution<unsigned int> dist{ 0, buckets - 1 };
+
+		Histogram hist{ size, buckets, pool };
+
+		std::vector<unsigned int> numbers(size);
+		for (auto& x : numbers)
+			x = dist(rnd);
+
+		std::vector<unsigned int> histogram(buckets, 0);
+		for (unsigned int x : numbers)
+			histogram[x]++;
+
+		std::vector<unsigned int> result(buckets, 0xffffffff);
+		hist(stdext::make_span(result), numbers, size);
+		EXPECT_EQ(histogram, result) << "Histogram of " << size << " values in " << buckets << " buckets";
+	}
+}
+
+TEST(HistogramTest, Build)
+{
+	Vcl::Core::ThreadPool pool{ 4 };
+
+	BuildHistogramTest(pool, 64, 0);
+	BuildHistogramTest(pool, 64, 32);
+	BuildHistogramTest(pool, 64, 65);
+	BuildHistogramTest(pool, 64, 129);
+	BuildHistogramTest(pool, 1, 1000);
+	BuildHistogramTest(pool, 256, 1000003);
+	BuildHistogramTest(pool, 5000, 300000);
+}
@@ -269,3 +269,20 @@ TEST(InterleavedArrayTest, stridedLayout8) { stridedLayoutTestStub<8>(); }
 TEST(InterleavedArrayTest, stridedLayout31) { stridedLayoutTestStub<31>(); }
 TEST(InterleavedArrayTest, stridedLayout32) { stridedLayoutTestStub<32>(); }
 TEST(InterleavedArrayTest, stridedLayout33) { stridedLayoutTestStub<33>(); }
+
+TEST(InterleavedArrayTest, hugePages)
+{
+	using Policy = Vcl::Core::HugePageAllocPolicy<float>;
+
+	const size_t size = 100000;
+	Vcl::Core::InterleavedArray<float, 3, 3, 8, Policy> data(size);
+	EXPECT_EQ(0u, reinterpret_cast<size_t>(data.data()) % (2 * 1024 * 1024));
+
+	for (size_t i = 0; i < size; i++)
+		data.at<float>(i) = Eigen::Matrix3f::Constant(static_cast<float>(i));
+
+	bool check = true;
+	for (size_t i = 0; i < size; i++)
+		check = check && data.at<float>(i) == Eigen::Matrix3f::Constant(static_cast<float>(i));
+	EXPECT_TRUE(check);
+}
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <random>
+#include <utility>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/interleavedvector.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	using Matrix3f = Eigen::Matrix<float, 3, 1>;
+	using Matrix3fArray = std::vector<Matrix3f, Eigen::aligned_allocator<Matrix3f>>;
+
+	Matrix3fArray createReference(size_t size)
+	{
+		std::mt19937 rnd_dev;
+		std::uniform_real_distribution<float> rnd_dist;
+
+		Matrix3fArray ref_data(size);
+		for (auto& entry : ref_data)
+			entry = Matrix3f{ rnd_dist(rnd_dev), rnd_dist(rnd_dev), rnd_dist(rnd_dev) };
+
+		return ref_data;
+	}
+
+	template<int STRIDE>
+	void pushBackTest(size_t size)
+	{
+		const auto ref_data = createReference(size);
+
+		Vcl::Core::InterleavedVector<float, 3, 1, STRIDE> data;
+		EXPECT_TRUE(data.empty());
+
+		// Growing the container must keep the previously written entries
+		for (size_t i = 0; i < size; i++)
+		{
+			data.push_back(ref_data[i]);
+
+			EXPECT_EQ(data.size(), i + 1);
+			EXPECT_EQ(data.capacity() % 64, 0u);
+			if (STRIDE > 1)
+			{
+				EXPECT_EQ(data.capacity() % STRIDE, 0u);
+			}
+		}
+
+		bool check = true;
+		for (size_t i = 0; i < size; i++)
+			check = check && (data.template at<float>(i) == ref_data[i]);
+		EXPECT_TRUE(check);
+
+		// The storage is relocated without changing its content
+		data.reserve(4 * data.capacity());
+		check = true;
+		for (size_t i = 0; i < size; i++)
+			check = check && (data.template at<float>(i) == ref_data[i]);
+		EXPECT_TRUE(check);
+
+		// Moving transfers the ownership
+		auto moved = std::move(data);
+		EXPECT_EQ(moved.size(), size);
+		check = true;
+		for (size_t i = 0; i < size; i++)
+			check = check && (moved.template at<float>(i) == ref_data[i]);
+		EXPECT_TRUE(check);
+	}
+
+	template<int STRIDE>
+	void blockTest(size_t size)
+	{
+		using float4 = Vcl::VectorScalar<float, 4>;
+
+		const auto ref_data = createReference(size);
+
+		Vcl::Core::InterleavedVector<float, 3, 1, STRIDE> data;
+		for (const auto& entry : ref_data)
+			data.push_back(entry);
+
+		size_t visited = 0;
+		const auto blocks = data.template blocks<float4>();
+		for (auto it = blocks.begin(); it != blocks.end(); ++it)
+		{
+			const Eigen::Matrix<float4, 3, 1> block = *it;
+			EXPECT_EQ(it.index(), visited);
+
+			for (int l = 0; l < 4; l++)
+			{
+				const size_t i = it.index() + l;
+				for (int r = 0; r < 3; r++)
+				{
+					const float expected = i < size ? ref_data[i](r) : 0.0f;
+					EXPECT_EQ(block(r)[l], expected) << "Entry " << i << ", row " << r;
+				}
+			}
+
+			visited += 4;
+		}
+		EXPECT_EQ(visited, (size + 3) / 4 * 4);
+	}
+}
+
+TEST(InterleavedVectorTest, ConsecutivePushBack)
+{
+	pushBackTest<0>(1);
+	pushBackTest<0>(200);
+}
+
+TEST(InterleavedVectorTest, StridedPushBack)
+{
+	pushBackTest<4>(200);
+	pushBackTest<7>(200);
+	pushBackTest<8>(131);
+}
+
+TEST(InterleavedVectorTest, DynamicPushBack)
+{
+	pushBackTest<Vcl::Core::DynamicStride>(1);
+	pushBackTest<Vcl::Core::DynamicStride>(200);
+}
+
+TEST(InterleavedVectorTest, Resize)
+{
+	const auto ref_data = createReference(10);
+
+	Vcl::Core::InterleavedVector<float, 3, 1, 4> data(3);
+	EXPECT_EQ(data.size(), 3u);
+	EXPECT_TRUE(data.at<float>(2).isZero());
+
+	for (size_t i = 0; i < 3; i++)
+		data.at<float>(i) = ref_data[i];
+
+	// Shrinking and growing again resets the discarded entries
+	data.resize(1);
+	data.resize(100);
+	EXPECT_EQ(data.size(), 100u);
+	EXPECT_TRUE(data.at<float>(0) == ref_data[0]);
+	EXPECT_TRUE(data.at<float>(1).isZero());
+	EXPECT_TRUE(data.at<float>(99).isZero());
+
+	data.clear();
+	EXPECT_TRUE(data.empty());
+	EXPECT_GE(data.capacity(), 100u);
+}
+
+TEST(InterleavedVectorTest, Blocks)
+{
+	blockTest<4>(13);
+	blockTest<8>(64);
+	blockTest<Vcl::Core::DynamicStride>(70);
+}
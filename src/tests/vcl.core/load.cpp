@@ -36,6 +36,53 @@ VCL_BEGIN_EXTERNAL_HEADERS
 #include <gtest/gtest.h>
 VCL_END_EXTERNAL_HEADERS
 
+namespace {
+	template<typename T, int Width>
+	void testMaskedLoad()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		T mem[Width], prev[Width], key[Width];
+		for (int i = 0; i < Width; i++)
+		{
+			mem[i] = T(i + 1);
+			prev[i] = T(-i - 1);
+			key[i] = T(i % 3);
+		}
+
+		vector_t k, value;
+		Vcl::load(k, key);
+		Vcl::load(value, prev);
+		const auto mask = k < vector_t(T(1));
+
+		Vcl::load(value, mem, mask);
+		const vector_t selected = Vcl::select(mask, mem, vector_t(T(0)));
+		for (int i = 0; i < Width; i++)
+		{
+			EXPECT_EQ(value[i], i % 3 == 0 ? mem[i] : prev[i]) << "Lane " << i << " of " << Width << "-way code failed.";
+			EXPECT_EQ(selected[i], i % 3 == 0 ? mem[i] : T(0)) << "Lane " << i << " of " << Width << "-way code failed.";
+		}
+	}
+
+	template<typename T, int Width>
+	void testPartialLoad()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		T mem[Width];
+		for (int i = 0; i < Width; i++)
+			mem[i] = T(i + 1);
+
+		for (int count = 0; count <= Width; count++)
+		{
+			vector_t value{ T(-1) };
+			Vcl::load_n(value, mem, count);
+			for (int i = 0; i < Width; i++)
+				EXPECT_EQ(value[i], i < count ? mem[i] : T(0)) << "Lane " << i << " of " << Width << "-way code failed for " << count << " entries.";
+		}
+	}
+}
+
 // Tests the scalar gather function.
 TEST(LoadTest, Scalar)
 {
@@ -409,3 +456,56 @@ TEST(LoadTest, Vector4)
 	EXPECT_TRUE(all(ref16(2) == f16(2))) << "16-way code failed.";
 	EXPECT_TRUE(all(ref16(3) == f16(3))) << "16-way code failed.";
 }
+
+TEST(LoadTest, Masked)
+{
+	testMaskedLoad<float, 4>();
+	testMaskedLoad<float, 8>();
+	testMaskedLoad<float, 16>();
+	testMaskedLoad<int, 4>();
+	testMaskedLoad<int, 8>();
+	testMaskedLoad<int, 16>();
+	testMaskedLoad<double, 4>();
+	testMaskedLoad<double, 8>();
+	testMaskedLoad<double, 16>();
+}
+
+TEST(LoadTest, Partial)
+{
+	testPartialLoad<float, 4>();
+	testPartialLoad<float, 8>();
+	testPartialLoad<float, 16>();
+	testPartialLoad<int, 4>();
+	testPartialLoad<int, 8>();
+	testPartialLoad<int, 16>();
+	testPartialLoad<double, 4>();
+	testPartialLoad<double, 8>();
+	testPartialLoad<double, 16>();
+}
+
+TEST(LoadTest, PartialVector3)
+{
+	using Vcl::float4;
+	using Vcl::float8;
+	using Vcl::float16;
+
+	Eigen::Vector3f mem[16];
+	for (int i = 0; i < 16; i++)
+		mem[i] = Eigen::Vector3f(float(3 * i + 0), float(3 * i + 1), float(3 * i + 2));
+
+	Eigen::Matrix<float4, 3, 1> f4;
+	Vcl::load_n(f4, mem, 3);
+	Eigen::Matrix<float8, 3, 1> f8;
+	Vcl::load_n(f8, mem, 5);
+	Eigen::Matrix<float16, 3, 1> f16;
+	Vcl::load_n(f16, mem, 11);
+	for (int c = 0; c < 3; c++)
+	{
+		for (int i = 0; i < 4; i++)
+			EXPECT_EQ(f4(c)[i], i < 3 ? mem[i](c) : 0.0f) << "4-way code failed.";
+		for (int i = 0; i < 8; i++)
+			EXPECT_EQ(f8(c)[i], i < 5 ? mem[i](c) : 0.0f) << "8-way code failed.";
+		for (int i = 0; i < 16; i++)
+			EXPECT_EQ(f16(c)[i], i < 11 ? mem[i](c) : 0.0f) << "16-way code failed.";
+	}
+}
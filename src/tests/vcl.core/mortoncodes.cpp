@@ -0,0 +1,178 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/util/mortoncodes.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	//! Bit-by-bit interleaving of 'Dims' coordinates with 'bits' bits each
+	template<size_t Dims>
+	uint64_t interleave(const uint32_t (&coords)[Dims], int bits)
+	{
+		uint64_t code = 0;
+		for (int b = 0; b < bits; b++)
+			for (size_t d = 0; d < Dims; d++)
+				code |= uint64_t((coords[d] >> b) & 1) << (b * Dims + d);
+		return code;
+	}
+}
+
+TEST(MortonCodeTest, EncodeDecode)
+{
+	using namespace Vcl::Util;
+
+	EXPECT_EQ(1u, MortonCode::encode(1, 0, 0));
+	EXPECT_EQ(2u, MortonCode::encode(0, 1, 0));
+	EXPECT_EQ(4u, MortonCode::encode(0, 0, 1));
+	EXPECT_EQ(0x7fffffffffffffffu, MortonCode::encode(0x1fffff, 0x1fffff, 0x1fffff));
+	EXPECT_EQ(0xffffffffffffffffu, MortonCode::encode(0xffffffff, 0xffffffff));
+
+	std::mt19937 rnd{ 5 };
+	std::uniform_int_distribution<uint32_t> dist;
+	auto next = [&rnd, &dist]() { return dist(rnd); };
+
+	bool check = true;
+	for (int i = 0; i < 1000; i++)
+	{
+		const uint32_t c3[] = { next() & 0x1fffff, next() & 0x1fffff, next() & 0x1fffff };
+		const uint32_t c2[] = { next(), next() };
+		const uint32_t s3[] = { next() & 0x3ff, next() & 0x3ff, next() & 0x3ff };
+		const uint32_t s2[] = { next() & 0xffff, next() & 0xffff };
+
+		uint32_t x, y, z;
+		const uint64_t m3 = MortonCode::encode(c3[0], c3[1], c3[2]);
+		MortonCode::decode(m3, x, y, z);
+		check = check && m3 == interleave(c3, 21) && x == c3[0] && y == c3[1] && z == c3[2];
+
+		const uint64_t m2 = MortonCode::encode(c2[0], c2[1]);
+		MortonCode::decode(m2, x, y);
+		check = check && m2 == interleave(c2, 32) && x == c2[0] && y == c2[1];
+
+		const uint32_t n3 = MortonCode32::encode(s3[0], s3[1], s3[2]);
+		MortonCode32::decode(n3, x, y, z);
+		check = check && n3 == interleave(s3, 10) && x == s3[0] && y == s3[1] && z == s3[2];
+
+		const uint32_t n2 = MortonCode32::encode(s2[0], s2[1]);
+		MortonCode32::decode(n2, x, y);
+		check = check && n2 == interleave(s2, 16) && x == s2[0] && y == s2[1];
+	}
+	EXPECT_TRUE(check);
+}
+
+TEST(MortonCodeTest, HilbertCurve)
+{
+	using namespace Vcl::Util;
+
+	// Walking along the curve visits every cell once, moving to a neighbouring cell in every step
+	const int bits = 3;
+	const uint32_t n = 1 << bits;
+	std::vector<std::pair<uint64_t, Eigen::Vector3i>> cells;
+	for (uint32_t z = 0; z < n; z++)
+		for (uint32_t y = 0; y < n; y++)
+			for (uint32_t x = 0; x < n; x++)
+				cells.emplace_back(HilbertCode::encode(x, y, z, bits), Eigen::Vector3i(x, y, z));
+	std::sort(cells.begin(), cells.end(), [](const std::pair<uint64_t, Eigen::Vector3i>& a, const std::pair<uint64_t, Eigen::Vector3i>& b) { return a.first < b.first; });
+
+	bool check = true;
+	for (size_t i = 0; i < cells.size(); i++)
+	{
+		check = check && cells[i].first == i;
+		if (i > 0)
+			check = check && (cells[i].second - cells[i - 1].second).cwiseAbs().sum() == 1;
+
+		uint32_t x, y, z;
+		HilbertCode::decode(cells[i].first, x, y, z, bits);
+		check = check && Eigen::Vector3i(x, y, z) == cells[i].second;
+	}
+	EXPECT_TRUE(check) << "3D curve is continuous";
+
+	check = true;
+	uint32_t px = 0, py = 0;
+	for (uint64_t key = 0; key < 256; key++)
+	{
+		uint32_t x, y;
+		HilbertCode::decode(key, x, y, 4);
+		check = check && x < 16 && y < 16 && HilbertCode::encode(x, y, 4) == key;
+		if (key > 0)
+			check = check && std::abs(int(x) - int(px)) + std::abs(int(y) - int(py)) == 1;
+		px = x;
+		py = y;
+	}
+	EXPECT_TRUE(check) << "2D curve is continuous";
+}
+
+TEST(MortonCodeTest, EncodeBatch)
+{
+	using namespace Vcl::Util;
+
+	// Points on the integer grid map onto themselves, points outside are clamped
+	const size_t nr_points = 37;
+	std::mt19937 rnd{ 7 };
+	std::vector<Eigen::Vector3f> points(nr_points);
+	std::vector<Eigen::Vector2f> points_2d(nr_points);
+	for (size_t i = 0; i < nr_points; i++)
+	{
+		points[i] = Eigen::Vector3f(float(rnd() % 1024), float(rnd() % 1024), float(rnd() % 1024));
+		points_2d[i] = points[i].head<2>();
+	}
+	points[5] = { -10.0f, 2000.0f, 512.0f };
+
+	const Eigen::AlignedBox3f bounds{ Eigen::Vector3f::Zero(), Eigen::Vector3f::Constant(1023.0f) };
+	const Eigen::AlignedBox2f bounds_2d{ Eigen::Vector2f::Zero(), Eigen::Vector2f::Constant(65535.0f) };
+
+	std::vector<uint32_t> codes(nr_points), codes_2d(nr_points);
+	std::vector<uint64_t> keys(nr_points);
+	MortonCode32::encode(stdext::make_span(points), stdext::make_span(codes), bounds);
+	MortonCode32::encode(stdext::make_span(points_2d), stdext::make_span(codes_2d), bounds_2d);
+	HilbertCode::encode(stdext::make_span(points), stdext::make_span(keys), Eigen::AlignedBox3f{ Eigen::Vector3f::Zero(), Eigen::Vector3f::Constant(2097151.0f) });
+
+	bool check = true;
+	for (size_t i = 0; i < nr_points; i++)
+	{
+		const Eigen::Vector3f p = points[i].cwiseMax(0.0f).cwiseMin(1023.0f);
+		const auto x = uint32_t(p.x()), y = uint32_t(p.y()), z = uint32_t(p.z());
+		check = check && codes[i] == MortonCode32::encode(x, y, z);
+		check = check && codes_2d[i] == MortonCode32::encode(uint32_t(points_2d[i].x()), uint32_t(points_2d[i].y()));
+		const Eigen::Vector3f q = points[i].cwiseMax(0.0f);
+		check = check && keys[i] == HilbertCode::encode(uint32_t(q.x()), uint32_t(q.y()), uint32_t(q.z()));
+	}
+	EXPECT_TRUE(check);
+}
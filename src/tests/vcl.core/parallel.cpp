@@ -0,0 +1,189 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/concurrency/parallel.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+TEST(ParallelTest, For)
+{
+	Vcl::Core::ThreadPool pool{ 4 };
+	EXPECT_EQ(pool.size(), 4u);
+
+	const size_t begin = 3;
+	const size_t end = 10000;
+	const size_t grain = Vcl::Core::CacheLineGranularity<float>::value;
+	EXPECT_EQ(grain, 16u);
+
+	std::vector<int> visited(end, 0);
+	std::atomic<int> misaligned{ 0 };
+	Vcl::Core::parallel_for(pool, begin, end, grain, [&](size_t first, size_t last) {
+		if (first != begin && first % grain != 0)
+			misaligned++;
+
+		for (size_t i = first; i < last; i++)
+			visited[i]++;
+	});
+
+	EXPECT_EQ(misaligned.load(), 0);
+	EXPECT_EQ(std::accumulate(visited.begin(), visited.begin() + begin, 0), 0);
+	EXPECT_TRUE(std::all_of(visited.begin() + begin, visited.end(), [](int v) { return v == 1; }));
+}
+
+TEST(ParallelTest, Reduce)
+{
+	using Range = std::pair<size_t, size_t>;
+
+	Vcl::Core::ThreadPool pool{ 4 };
+
+	const size_t n = 100000;
+	const auto sum = Vcl::Core::parallel_reduce(
+		pool, 0, n, 64, size_t(0),
+		[](size_t first, size_t last, size_t init) {
+			for (size_t i = first; i < last; i++)
+				init += i;
+			return init;
+		},
+		[](size_t a, size_t b) { return a + b; });
+	EXPECT_EQ(sum, n * (n - 1) / 2);
+
+	// Partial results are combined in order
+	const auto range = Vcl::Core::parallel_reduce(
+		pool, 5, n, 64, Range{ 0, 0 },
+		[](size_t first, size_t last, const Range&) { return Range{ first, last }; },
+		[](const Range& a, const Range& b) {
+			EXPECT_EQ(a.second, b.first);
+			return Range{ a.first, b.second };
+		});
+	EXPECT_EQ(range.first, 5u);
+	EXPECT_EQ(range.second, n);
+
+	// Empty ranges return the identity
+	const auto empty = Vcl::Core::parallel_reduce(
+		pool, 7, 7, 1, 42,
+		[](size_t, size_t, int init) { return init + 1; },
+		[](int a, int b) { return a + b; });
+	EXPECT_EQ(empty, 42);
+}
+
+TEST(ParallelTest, Nested)
+{
+	for (unsigned int threads : { 1u, 3u })
+	{
+		Vcl::Core::ThreadPool pool{ threads };
+
+		const size_t rows = 37;
+		const size_t cols = 1000;
+		std::vector<int> visited(rows * cols, 0);
+		Vcl::Core::parallel_for(pool, 0, rows, 1, [&](size_t first_row, size_t last_row) {
+			for (size_t r = first_row; r < last_row; r++)
+			{
+				Vcl::Core::parallel_for(pool, 0, cols, 8, [&](size_t first, size_t last) {
+					for (size_t c = first; c < last; c++)
+						visited[r * cols + c]++;
+				});
+			}
+		});
+
+		EXPECT_TRUE(std::all_of(visited.begin(), visited.end(), [](int v) { return v == 1; })) << threads << " threads";
+	}
+}
+
+TEST(ParallelTest, WaitForStolenTask)
+{
+	Vcl::Core::ThreadPool pool{ 2 };
+
+	std::atomic<bool> stolen{ false };
+	std::atomic<bool> completed{ false };
+	const std::clock_t cpu_start = std::clock();
+	pool.invoke(
+		[&]() {
+			// Leave the second task to the other worker
+			while (!stolen)
+				std::this_thread::yield();
+		},
+		[&]() {
+			stolen = true;
+			std::this_thread::sleep_for(std::chrono::milliseconds(200));
+			completed = true;
+		});
+	const double cpu_time = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+	EXPECT_TRUE(completed);
+
+	// The joining worker blocks instead of spinning while the thief sleeps
+	EXPECT_LT(cpu_time, 0.1);
+}
+
+TEST(ParallelTest, Exception)
+{
+	Vcl::Core::ThreadPool pool{ 2 };
+
+	std::atomic<int> processed{ 0 };
+	EXPECT_THROW(
+		Vcl::Core::parallel_for(pool, 0, 1000, 1, [&](size_t first, size_t last) {
+			if (first <= 500 && 500 < last)
+				throw std::runtime_error("Failure");
+			processed += static_cast<int>(last - first);
+		}),
+		std::runtime_error);
+	EXPECT_LT(processed.load(), 1000);
+
+	// The pool is still usable afterwards
+	std::atomic<int> count{ 0 };
+	Vcl::Core::parallel_for(pool, 0, 100, 1, [&](size_t first, size_t last) { count += static_cast<int>(last - first); });
+	EXPECT_EQ(count.load(), 100);
+}
+
+TEST(ParallelTest, GlobalPool)
+{
+	const auto sum = Vcl::Core::parallel_reduce(
+		0, 1000, 16, 0.0,
+		[](size_t first, size_t last, double init) {
+			for (size_t i = first; i < last; i++)
+				init += 1.0;
+			return init;
+		},
+		[](double a, double b) { return a + b; });
+	EXPECT_EQ(sum, 1000.0);
+}
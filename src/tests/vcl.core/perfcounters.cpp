@@ -0,0 +1,72 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstring>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/util/donotoptimizeaway.h>
+#include <vcl/util/perfcounters.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+TEST(PerfCountersTest, CountLoop)
+{
+	using Vcl::Util::PerfCounters;
+
+	PerfCounters counters;
+	counters.start();
+
+	std::vector<float> data(1 << 16, 1.0f);
+	float sum = 0;
+	for (int r = 0; r < 16; r++)
+		for (float d : data)
+			sum += d;
+	doNotOptimizeAway(sum);
+
+	counters.stop();
+
+	// The counters may not be accessible on the executing machine
+	for (size_t e = 0; e < PerfCounters::NrEvents; e++)
+	{
+		const auto event = static_cast<PerfCounters::Event>(e);
+		EXPECT_GT(std::strlen(PerfCounters::name(event)), 0u);
+		if (!counters.isAvailable(event))
+		{
+			EXPECT_EQ(0u, counters.value(event));
+		}
+	}
+
+	if (counters.isAvailable(PerfCounters::Event::Instructions))
+	{
+		EXPECT_GE(counters.value(PerfCounters::Event::Instructions), uint64_t(data.size()));
+	}
+}
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/util/precisetimer.h>
+#include <vcl/util/profiler.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+TEST(ProfilerTest, NestedZones)
+{
+	using Vcl::Util::ProfileZone;
+	using Vcl::Util::Profiler;
+
+	Profiler::clear();
+	{
+		ProfileZone outer{ "Outer" };
+		for (int i = 0; i < 3; i++)
+		{
+			ProfileZone inner{ "Inner" };
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+	}
+
+	const auto events = Profiler::events();
+	ASSERT_EQ(4u, events.size());
+	EXPECT_STREQ("Outer", events[0].name);
+	EXPECT_EQ(0u, events[0].depth);
+	for (size_t i = 1; i < events.size(); i++)
+	{
+		EXPECT_STREQ("Inner", events[i].name);
+		EXPECT_EQ(1u, events[i].depth);
+		EXPECT_EQ(events[0].thread, events[i].thread);
+		EXPECT_LE(events[0].begin, events[i].begin);
+		EXPECT_GE(events[0].end, events[i].end);
+		EXPECT_GE(events[i].end - events[i].begin, 100000u);
+	}
+
+	Profiler::clear();
+	EXPECT_TRUE(Profiler::events().empty());
+}
+
+TEST(ProfilerTest, RingBufferKeepsLatestEvents)
+{
+	using Vcl::Util::Profiler;
+
+	Profiler::clear();
+	const size_t nr_events = Profiler::Capacity + 100;
+	for (size_t i = 0; i < nr_events; i++)
+		Profiler::record("Event", i, i + 1, 0);
+
+	const auto events = Profiler::events();
+	ASSERT_EQ(size_t(Profiler::Capacity), events.size());
+	EXPECT_EQ(100u, events.front().begin);
+	EXPECT_EQ(nr_events - 1, events.back().begin);
+
+	Profiler::clear();
+}
+
+TEST(ProfilerTest, ChromeTraceOfMultipleThreads)
+{
+	using Vcl::Util::ProfileZone;
+	using Vcl::Util::Profiler;
+
+	Profiler::clear();
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++)
+	{
+		threads.emplace_back([]() {
+			for (int i = 0; i < 100; i++)
+			{
+				ProfileZone zone{ "Work \"quoted\"" };
+			}
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	const auto events = Profiler::events();
+	ASSERT_EQ(400u, events.size());
+	for (size_t i = 1; i < events.size(); i++)
+		EXPECT_LE(events[i - 1].begin, events[i].begin);
+
+	std::stringstream trace;
+	Profiler::writeChromeTrace(trace);
+	const std::string json = trace.str();
+	EXPECT_EQ(0u, json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+	EXPECT_NE(std::string::npos, json.find("\"name\":\"Work \\\"quoted\\\"\""));
+	EXPECT_NE(std::string::npos, json.find("\"ph\":\"X\""));
+	EXPECT_EQ("]}\n", json.substr(json.size() - 3));
+
+	Profiler::clear();
+}
+
+TEST(ProfilerTest, PreciseTimerMeasuresWallTime)
+{
+	// The timer must not sum up the CPU time of other threads, nor miss time spent waiting
+	Vcl::Util::PreciseTimer timer;
+	timer.start();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	timer.stop();
+
+	EXPECT_GE(timer.interval(), 0.02);
+	EXPECT_LT(timer.interval(), 10.0);
+	EXPECT_GE(timer.interval(4), 0.005);
+}
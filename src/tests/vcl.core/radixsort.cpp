@@ -0,0 +1,119 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/algorithm/radixsort.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	template<typename Key>
+	std::vector<Key> randomKeys(size_t n, Key mask, unsigned int seed)
+	{
+		std::mt19937_64 rnd{ seed };
+		std::vector<Key> keys(n);
+		for (auto& k : keys)
+			k = static_cast<Key>(rnd()) & mask;
+		return keys;
+	}
+
+	//! Sort with the radix sort and compare against a stable sort of the keys
+	template<typename Key>
+	void checkSort(Vcl::Core::RadixSort& sort, std::vector<Key> keys, unsigned int key_bits)
+	{
+		std::vector<uint32_t> values(keys.size());
+		std::iota(values.begin(), values.end(), 0);
+
+		std::vector<uint32_t> expected_values = values;
+		std::stable_sort(expected_values.begin(), expected_values.end(), [&keys](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+		std::vector<Key> expected_keys(keys.size());
+		for (size_t i = 0; i < keys.size(); i++)
+			expected_keys[i] = keys[expected_values[i]];
+
+		std::vector<Key> keys_only = keys;
+		sort(stdext::make_span(keys_only), key_bits);
+		EXPECT_EQ(expected_keys, keys_only) << "Sort keys with " << key_bits << " bits";
+
+		sort(stdext::make_span(keys), stdext::make_span(values), key_bits);
+		EXPECT_EQ(expected_keys, keys) << "Sort keys and values with " << key_bits << " bits";
+		EXPECT_EQ(expected_values, values) << "Sort is stable";
+	}
+}
+
+TEST(RadixSortTest, Keys32)
+{
+	Vcl::Core::ThreadPool pool{ 4 };
+	Vcl::Core::RadixSort sort{ pool };
+
+	for (size_t n : { 0, 1, 2, 1000, 100003 })
+		checkSort<uint32_t>(sort, randomKeys<uint32_t>(n, 0xffffffff, 5), 32);
+
+	// Many duplicates and fewer key bits
+	checkSort<uint32_t>(sort, randomKeys<uint32_t>(70000, 0x3ff, 7), 10);
+	checkSort<uint32_t>(sort, randomKeys<uint32_t>(70000, 0xfffff, 7), 20);
+}
+
+TEST(RadixSortTest, Keys64)
+{
+	Vcl::Core::ThreadPool pool{ 4 };
+	Vcl::Core::RadixSort sort{ pool };
+
+	for (size_t n : { 2, 1000, 100003 })
+		checkSort<uint64_t>(sort, randomKeys<uint64_t>(n, ~uint64_t(0), 11), 64);
+
+	// Morton codes of three-dimensional points use 63 bits
+	checkSort<uint64_t>(sort, randomKeys<uint64_t>(50000, 0x7fffffffffffffff, 13), 63);
+}
+
+TEST(RadixSortTest, UniformDigits)
+{
+	Vcl::Core::ThreadPool pool{ 4 };
+	Vcl::Core::RadixSort sort{ pool };
+
+	// Only the lowest and the highest digits differ, requiring an even number of passes
+	auto keys = randomKeys<uint32_t>(50000, 0xff0000ff, 17);
+	for (auto& k : keys)
+		k |= 0x00abcd00;
+	checkSort<uint32_t>(sort, keys, 32);
+
+	// Only the second digit differs, requiring a single pass
+	keys = randomKeys<uint32_t>(50000, 0x0000ff00, 19);
+	checkSort<uint32_t>(sort, keys, 32);
+
+	// All keys are equal
+	checkSort<uint64_t>(sort, std::vector<uint64_t>(50000, 42), 64);
+}
@@ -0,0 +1,143 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/core/algorithm/scan.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	std::vector<unsigned int> randomNumbers(size_t n)
+	{
+		std::mt19937 rnd;
+		std::uniform_int_distribution<unsigned int> dist{ 0, 100 };
+
+		std::vector<unsigned int> numbers(n);
+		for (auto& x : numbers)
+			x = dist(rnd);
+		return numbers;
+	}
+
+	//! Sequential reference of the segmented scan
+	std::vector<unsigned int> referenceScan(const std::vector<unsigned int>& src, const std::vector<unsigned int>& segments, bool inclusive)
+	{
+		std::vector<unsigned int> dst(src.size());
+		size_t seg = 0;
+		unsigned int sum = 0;
+		for (size_t i = 0; i < src.size(); i++)
+		{
+			for (; seg < segments.size() && segments[seg] == i; seg++)
+				sum = 0;
+
+			dst[i] = inclusive ? sum + src[i] : sum;
+			sum += src[i];
+		}
+		return dst;
+	}
+}
+
+TEST(ScanTest, Exclusive)
+{
+	using namespace Vcl::Core;
+
+	ThreadPool pool{ 4 };
+	for (unsigned int size : { 1u, 4u, 12u, 1023u, 1024u, 100000u, 1000003u })
+	{
+		ScanExclusive scan{ size, pool };
+		ScanInclusive scan_inclusive{ size, pool };
+
+		const auto numbers = randomNumbers(size);
+		std::vector<unsigned int> result(size);
+
+		scan(stdext::make_span(result), numbers, size);
+		EXPECT_EQ(referenceScan(numbers, { 0 }, false), result) << "Exclusive scan of " << size << " entries";
+
+		scan_inclusive(stdext::make_span(result), numbers, size);
+		EXPECT_EQ(referenceScan(numbers, { 0 }, true), result) << "Inclusive scan of " << size << " entries";
+
+		// Scan in-place
+		result = numbers;
+		scan(stdext::make_span(result), result, size);
+		EXPECT_EQ(referenceScan(numbers, { 0 }, false), result) << "In-place scan of " << size << " entries";
+	}
+}
+
+TEST(ScanTest, Batched)
+{
+	using namespace Vcl::Core;
+
+	ThreadPool pool{ 4 };
+	const unsigned int batch_size = 37;
+	const unsigned int array_length = 5003;
+
+	ScanExclusive scan{ batch_size * array_length, pool };
+	const auto numbers = randomNumbers(batch_size * array_length);
+
+	std::vector<unsigned int> segments(batch_size);
+	for (unsigned int b = 0; b < batch_size; b++)
+		segments[b] = b * array_length;
+
+	std::vector<unsigned int> result(numbers.size());
+	scan(stdext::make_span(result), numbers, batch_size, array_length);
+	EXPECT_EQ(referenceScan(numbers, segments, false), result);
+}
+
+TEST(ScanTest, Segmented)
+{
+	using namespace Vcl::Core;
+
+	ThreadPool pool{ 4 };
+	const unsigned int size = 500000;
+
+	ScanExclusive scan{ size, pool };
+	ScanInclusive scan_inclusive{ size, pool };
+	const auto numbers = randomNumbers(size);
+
+	// Segments of varying length, including empty ones and ones
+	// spanning several blocks
+	std::vector<unsigned int> segments = { 0, 0, 3, 17, 17, 40000, 40001, 200000 };
+	std::mt19937 rnd;
+	std::uniform_int_distribution<unsigned int> dist{ 200000, size - 1 };
+	for (int i = 0; i < 100; i++)
+		segments.push_back(dist(rnd));
+	std::sort(segments.begin(), segments.end());
+
+	std::vector<unsigned int> result(size);
+	scan(stdext::make_span(result), numbers, segments, size);
+	EXPECT_EQ(referenceScan(numbers, segments, false), result) << "Exclusive segmented scan";
+
+	scan_inclusive(stdext::make_span(result), numbers, segments, size);
+	EXPECT_EQ(referenceScan(numbers, segments, true), result) << "Inclusive segmented scan";
+}
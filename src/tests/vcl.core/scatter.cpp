@@ -36,6 +36,81 @@ VCL_BEGIN_EXTERNAL_HEADERS
 #include <gtest/gtest.h>
 VCL_END_EXTERNAL_HEADERS
 
+namespace {
+	template<typename T, int Width>
+	void testMaskedScatter()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+		using int_t = Vcl::VectorScalar<int, Width>;
+
+		T mem[Width];
+		int idx_mem[Width];
+		for (int i = 0; i < Width; i++)
+		{
+			mem[i] = T(i + 1);
+			idx_mem[i] = (7 * i) % 23;
+		}
+
+		vector_t value;
+		Vcl::load(value, mem);
+		int_t idx;
+		Vcl::load(idx, idx_mem);
+		const auto mask = idx < int_t(12);
+
+		T out[32];
+		for (int i = 0; i < 32; i++)
+			out[i] = T(-1);
+
+		Vcl::scatter(value, out, idx, mask);
+
+		T ref[32];
+		for (int i = 0; i < 32; i++)
+			ref[i] = T(-1);
+		for (int i = 0; i < Width; i++)
+		{
+			if (idx_mem[i] < 12)
+				ref[idx_mem[i]] = mem[i];
+		}
+
+		for (int i = 0; i < 32; i++)
+			EXPECT_EQ(out[i], ref[i]) << "Entry " << i << " of " << Width << "-way code failed.";
+	}
+
+	template<int Width, int Stride>
+	void testInterleavedScatter()
+	{
+		using float_t = Vcl::VectorScalar<float, Width>;
+		using int_t = Vcl::VectorScalar<int, Width>;
+
+		Eigen::Matrix<float_t, 3, 3> value;
+		for (int k = 0; k < 9; k++)
+		{
+			float data[Width];
+			for (int i = 0; i < Width; i++)
+				data[i] = float(9 * i + k);
+
+			Vcl::load(value(k % 3, k / 3), data);
+		}
+
+		int idx_mem[Width];
+		for (int i = 0; i < Width; i++)
+			idx_mem[i] = (7 * i + 3) % 37;
+
+		int_t idx;
+		Vcl::load(idx, idx_mem);
+
+		Vcl::Core::InterleavedArray<float, 3, 3, Stride> mem(37);
+		mem.setZero();
+		Vcl::scatter(value, mem, idx);
+
+		for (int i = 0; i < Width; i++)
+		{
+			for (int k = 0; k < 9; k++)
+				EXPECT_EQ(mem.template at<float>(idx_mem[i])(k % 3, k / 3), float(9 * i + k)) << "Lane " << i << " of " << Width << "-way code failed for stride " << Stride << ".";
+		}
+	}
+}
+
 // Tests the scalar scatter function.
 TEST(ScatterTest, Scalar)
 {
@@ -222,3 +297,29 @@ TEST(ScatterTest, Matrix)
 		EXPECT_TRUE(implies(out[i] != Eigen::Vector3f::Zero(), out[i] == mem[i])) << "16-way code failed.";
 	}
 }
+
+TEST(ScatterTest, Masked)
+{
+	testMaskedScatter<float, 4>();
+	testMaskedScatter<float, 8>();
+	testMaskedScatter<float, 16>();
+	testMaskedScatter<int, 4>();
+	testMaskedScatter<int, 8>();
+	testMaskedScatter<int, 16>();
+	testMaskedScatter<double, 4>();
+	testMaskedScatter<double, 8>();
+	testMaskedScatter<double, 16>();
+}
+
+TEST(ScatterTest, InterleavedArray)
+{
+	testInterleavedScatter<4, 0>();
+	testInterleavedScatter<8, 0>();
+	testInterleavedScatter<16, 0>();
+	testInterleavedScatter<4, 4>();
+	testInterleavedScatter<8, 8>();
+	testInterleavedScatter<16, 16>();
+	testInterleavedScatter<4, Vcl::Core::DynamicStride>();
+	testInterleavedScatter<8, Vcl::Core::DynamicStride>();
+	testInterleavedScatter<16, Vcl::Core::DynamicStride>();
+}
@@ -31,8 +31,11 @@
 #include <vcl/math/math.h>
 
 // C++ standard library
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <random>
+#include <utility>
 
 VCL_BEGIN_EXTERNAL_HEADERS
 // Google test
@@ -63,6 +66,17 @@ VCL_END_EXTERNAL_HEADERS
 	float16 f16_asc{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 }; \
 	float16 f16_desc{ 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
 
+#define VCL_SIMD_DOUBLES                                                       \
+	using double4 = Vcl::double4;                                              \
+	using double8 = Vcl::double8;                                              \
+	using double16 = Vcl::double16;                                            \
+	double4 d4_asc{ 1, 2, 3, 4 };                                              \
+	double4 d4_desc{ 4, 3, 2, 1 };                                             \
+	double8 d8_asc{ 1, 2, 3, 4, 5, 6, 7, 8 };                                  \
+	double8 d8_desc{ 8, 7, 6, 5, 4, 3, 2, 1 };                                 \
+	double16 d16_asc{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 }; \
+	double16 d16_desc{ 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
 #define VCL_SIMD_INTS                                                       \
 	using int4 = Vcl::int4;                                                 \
 	using int8 = Vcl::int8;                                                 \
@@ -642,6 +656,127 @@ TEST(SimdFloat, HMinMax)
 	EXPECT_EQ(vec16.max(), 16);
 }
 
+namespace {
+	//! Error of a single precision result in units in the last place
+	double ulpError(float value, double reference)
+	{
+		if (std::isnan(reference))
+			return std::isnan(value) ? 0.0 : std::numeric_limits<double>::infinity();
+
+		int exp;
+		std::frexp(reference, &exp);
+		const double ulp = std::ldexp(1.0, std::max(exp - 24, -149));
+		return std::abs(value - reference) / ulp;
+	}
+
+	template<int Width, size_t... Is>
+	Vcl::VectorScalar<float, Width> makeVector(const float* data, std::index_sequence<Is...>)
+	{
+		return Vcl::VectorScalar<float, Width>(data[Is]...);
+	}
+
+	//! Evaluate a function on random samples and return the max. error in ulp
+	template<int Width, typename Func, typename RefFunc>
+	double maxUlpError(float lo, float hi, Func func, RefFunc ref)
+	{
+		std::mt19937 rng{ 5489 };
+		std::uniform_real_distribution<float> dist{ lo, hi };
+
+		double max_err = 0;
+		for (int i = 0; i < 4096; i++)
+		{
+			float x[Width];
+			std::generate(x, x + Width, [&]() { return dist(rng); });
+
+			const auto res = func(makeVector<Width>(x, std::make_index_sequence<Width>{}));
+			for (int j = 0; j < Width; j++)
+				max_err = std::max(max_err, ulpError(res[j], ref(x[j])));
+		}
+		return max_err;
+	}
+
+	template<int Width, typename Func, typename RefFunc>
+	double maxUlpError(float lo, float hi, Func func, RefFunc ref, int)
+	{
+		std::mt19937 rng{ 5489 };
+		std::uniform_real_distribution<float> dist{ lo, hi };
+
+		double max_err = 0;
+		for (int i = 0; i < 4096; i++)
+		{
+			float x[Width], y[Width];
+			std::generate(x, x + Width, [&]() { return dist(rng); });
+			std::generate(y, y + Width, [&]() { return dist(rng); });
+
+			const auto res = func(
+				makeVector<Width>(x, std::make_index_sequence<Width>{}),
+				makeVector<Width>(y, std::make_index_sequence<Width>{}));
+			for (int j = 0; j < Width; j++)
+				max_err = std::max(max_err, ulpError(res[j], ref(x[j], y[j])));
+		}
+		return max_err;
+	}
+
+	template<int Width>
+	void testExtendedMath()
+	{
+		using Vec = Vcl::VectorScalar<float, Width>;
+
+		// clang-format off
+		EXPECT_LE(maxUlpError<Width>(-100.0f, 100.0f, [](const Vec& x) { return tan(x); },  [](double x) { return std::tan(x); }),  3.5) << "'tan' failed.";
+		EXPECT_LE(maxUlpError<Width>(-10.0f, 10.0f,   [](const Vec& x) { return atan(x); }, [](double x) { return std::atan(x); }), 2.0) << "'atan' failed.";
+		EXPECT_LE(maxUlpError<Width>(-1.0f, 1.0f,     [](const Vec& x) { return asin(x); }, [](double x) { return std::asin(x); }), 2.5) << "'asin' failed.";
+		EXPECT_LE(maxUlpError<Width>(-100.0f, 100.0f, [](const Vec& x) { return exp2(x); }, [](double x) { return std::exp2(x); }), 1.5) << "'exp2' failed.";
+		EXPECT_LE(maxUlpError<Width>(0.0f, 100.0f,    [](const Vec& x) { return log2(x); }, [](double x) { return std::log2(x); }), 1.5) << "'log2' failed.";
+
+		EXPECT_LE(maxUlpError<Width>(-10.0f, 10.0f, [](const Vec& y, const Vec& x) { return atan2(y, x); }, [](double y, double x) { return std::atan2(y, x); }, 0), 3.5) << "'atan2' failed.";
+		EXPECT_LE(maxUlpError<Width>(0.25f, 2.0f,   [](const Vec& x, const Vec& y) { return pow(x, y); },   [](double x, double y) { return std::pow(x, y); }, 0), 6.0) << "'pow' failed.";
+		// clang-format on
+
+		// Special values
+		const float inf = std::numeric_limits<float>::infinity();
+		EXPECT_TRUE(all(log2(Vec(0.0f)) == Vec(-inf))) << "'log2' failed.";
+		EXPECT_TRUE(all(isinf(exp2(Vec(128.0f))))) << "'exp2' failed.";
+		EXPECT_TRUE(all(exp2(Vec(-inf)) == Vec(0.0f))) << "'exp2' failed.";
+		EXPECT_TRUE(all(pow(Vec(3.0f), Vec(0.0f)) == Vec(1.0f))) << "'pow' failed.";
+		EXPECT_TRUE(all(atan2(Vec(0.0f), Vec(1.0f)) == Vec(0.0f))) << "'atan2' failed.";
+		EXPECT_TRUE(all(atan2(Vec(1.0f), Vec(0.0f)) == Vec(1.5707963267948966f))) << "'atan2' failed.";
+	}
+}
+
+TEST(SimdFloat, Fma)
+{
+	using Vcl::float16;
+	using Vcl::float4;
+	using Vcl::float8;
+
+	const float a = 1.0f + std::ldexp(1.0f, -23);
+	const float b = 1.0f - std::ldexp(1.0f, -23);
+	const float c = -1.0f;
+
+#ifdef VCL_VECTORIZE_FMA
+	// The product is not rounded before the addition
+	const float ref = -std::ldexp(1.0f, -46);
+#else
+	const float ref = a * b + c;
+#endif
+
+	EXPECT_EQ(Vcl::fma(a, b, c), ref);
+	EXPECT_TRUE(all(fma(float4(a), float4(b), float4(c)) == float4(ref))) << "'fma' failed.";
+	EXPECT_TRUE(all(fma(float8(a), float8(b), float8(c)) == float8(ref))) << "'fma' failed.";
+	EXPECT_TRUE(all(fma(float16(a), float16(b), float16(c)) == float16(ref))) << "'fma' failed.";
+
+	float16 x{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+	EXPECT_TRUE(all(x.fma(x, float16(1.0f)) == x * x + float16(1.0f))) << "'fma' failed.";
+}
+
+TEST(SimdFloat, ExtendedMath)
+{
+	testExtendedMath<4>();
+	testExtendedMath<8>();
+	testExtendedMath<16>();
+}
+
 TEST(SimdInt, Construct)
 {
 	VCL_SIMD_INTS
@@ -801,3 +936,121 @@ TEST(SimdInt, Select)
 	selectTest<int, 8>(false, 1, 0, 0);
 	selectTest<int, 16>(false, 1, 0, 0);
 }
+
+template<int W>
+void dblArithmeticTest(const Vcl::VectorScalar<double, W>& asc, const Vcl::VectorScalar<double, W>& desc)
+{
+	using doubleN = Vcl::VectorScalar<double, W>;
+
+	const doubleN sum = asc + desc;
+	const doubleN diff = asc - desc;
+	const doubleN prod = asc * desc;
+	const doubleN quot = asc / desc;
+	const doubleN neg = -asc;
+	for (int i = 0; i < W; i++)
+	{
+		EXPECT_EQ(sum[i], asc[i] + desc[i]) << "Lane " << i;
+		EXPECT_EQ(diff[i], asc[i] - desc[i]) << "Lane " << i;
+		EXPECT_EQ(prod[i], asc[i] * desc[i]) << "Lane " << i;
+		EXPECT_EQ(quot[i], asc[i] / desc[i]) << "Lane " << i;
+		EXPECT_EQ(neg[i], -asc[i]) << "Lane " << i;
+	}
+}
+
+TEST(SimdDouble, Arithmetic)
+{
+	VCL_SIMD_DOUBLES
+
+	dblArithmeticTest<4>(d4_asc, d4_desc);
+	dblArithmeticTest<8>(d8_asc, d8_desc);
+	dblArithmeticTest<16>(d16_asc, d16_desc);
+}
+
+template<int W>
+void dblCompareTest(const Vcl::VectorScalar<double, W>& asc, const Vcl::VectorScalar<double, W>& desc)
+{
+	const auto lt = asc < desc;
+	const auto le = asc <= desc;
+	const auto gt = asc > desc;
+	const auto ge = asc >= desc;
+	const auto eq = asc == desc;
+	const auto ne = asc != desc;
+	for (int i = 0; i < W; i++)
+	{
+		EXPECT_EQ(lt[i], asc[i] < desc[i]) << "Lane " << i;
+		EXPECT_EQ(le[i], asc[i] <= desc[i]) << "Lane " << i;
+		EXPECT_EQ(gt[i], asc[i] > desc[i]) << "Lane " << i;
+		EXPECT_EQ(ge[i], asc[i] >= desc[i]) << "Lane " << i;
+		EXPECT_EQ(eq[i], asc[i] == desc[i]) << "Lane " << i;
+		EXPECT_EQ(ne[i], asc[i] != desc[i]) << "Lane " << i;
+	}
+
+	const auto selected = Vcl::select(asc < desc, asc, desc);
+	const auto minimum = Vcl::min(asc, desc);
+	const auto maximum = Vcl::max(asc, desc);
+	for (int i = 0; i < W; i++)
+	{
+		EXPECT_EQ(selected[i], std::min(asc[i], desc[i])) << "Lane " << i;
+		EXPECT_EQ(minimum[i], std::min(asc[i], desc[i])) << "Lane " << i;
+		EXPECT_EQ(maximum[i], std::max(asc[i], desc[i])) << "Lane " << i;
+	}
+}
+
+TEST(SimdDouble, Compare)
+{
+	VCL_SIMD_DOUBLES
+
+	dblCompareTest<4>(d4_asc, d4_desc);
+	dblCompareTest<8>(d8_asc, d8_desc);
+	dblCompareTest<16>(d16_asc, d16_desc);
+}
+
+template<int W>
+void dblMathTest()
+{
+	using Vcl::all;
+	using Vcl::any;
+
+	using doubleN = Vcl::VectorScalar<double, W>;
+
+	std::mt19937 rnd{ 5489 };
+	std::uniform_real_distribution<double> dist{ -10, 10 };
+
+	EXPECT_TRUE(all(Vcl::sgn(doubleN(0)) == doubleN(0)));
+	EXPECT_TRUE(all(Vcl::isinf(doubleN(1) / doubleN(0))));
+	EXPECT_FALSE(any(Vcl::isinf(doubleN(1))));
+	for (int i = 0; i < 50; i++)
+	{
+		const double d = dist(rnd);
+		const doubleN x{ d };
+
+		EXPECT_TRUE(all(Vcl::abs(x) == doubleN(std::abs(d))));
+		EXPECT_TRUE(all(Vcl::sgn(x) == doubleN(d < 0 ? -1 : 1)));
+		EXPECT_TRUE(all(Vcl::sqrt(Vcl::abs(x)) == doubleN(std::sqrt(std::abs(d)))));
+		EXPECT_TRUE(all(Vcl::abs(Vcl::rcp(x) - doubleN(1 / d)) <= doubleN(1e-15 * std::abs(1 / d))));
+		EXPECT_TRUE(all(Vcl::abs(Vcl::rsqrt(Vcl::abs(x)) - doubleN(1 / std::sqrt(std::abs(d)))) <= doubleN(1e-15 / std::sqrt(std::abs(d)))));
+	}
+}
+
+TEST(SimdDouble, Math)
+{
+	dblMathTest<4>();
+	dblMathTest<8>();
+	dblMathTest<16>();
+}
+
+TEST(SimdDouble, Reduce)
+{
+	VCL_SIMD_DOUBLES
+
+	EXPECT_EQ(d4_asc.min(), 1);
+	EXPECT_EQ(d4_asc.max(), 4);
+	EXPECT_EQ(d8_desc.min(), 1);
+	EXPECT_EQ(d8_desc.max(), 8);
+	EXPECT_EQ(d16_asc.min(), 1);
+	EXPECT_EQ(d16_asc.max(), 16);
+
+	EXPECT_EQ(d4_asc.dot(d4_desc), 20);
+	EXPECT_EQ(d8_asc.dot(d8_desc), 120);
+	EXPECT_EQ(d16_asc.dot(d16_desc), 816);
+}
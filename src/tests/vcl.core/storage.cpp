@@ -0,0 +1,296 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+// Include the relevant parts from the library
+#include <vcl/core/simd/memory.h>
+#include <vcl/core/simd/vectorscalar.h>
+#include <vcl/core/half.h>
+#include <vcl/core/interleavedarray.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	template<typename T, typename Storage, int Width>
+	void testWideningLoad()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		Storage mem[Width + 1];
+		for (int i = 0; i < Width + 1; i++)
+			mem[i] = static_cast<Storage>(std::numeric_limits<Storage>::max() - 3 * i);
+
+		// Load from an address which is not aligned
+		vector_t value;
+		Vcl::load(value, mem + 1);
+		for (int i = 0; i < Width; i++)
+			EXPECT_EQ(value[i], static_cast<T>(mem[i + 1])) << "Lane " << i;
+
+		Storage narrowed[Width];
+		Vcl::store(narrowed, value);
+		for (int i = 0; i < Width; i++)
+			EXPECT_EQ(narrowed[i], mem[i + 1]) << "Lane " << i;
+	}
+
+	template<typename T, typename Storage, int Width>
+	void testNarrowingStore()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		const T lo = static_cast<T>(std::numeric_limits<Storage>::lowest());
+		const T hi = static_cast<T>(std::numeric_limits<Storage>::max());
+		const T candidates[] = { lo - T(1000), lo - T(1), lo, T(0), T(7), hi, hi + T(1), hi + T(100000) };
+
+		T values[Width];
+		for (int i = 0; i < Width; i++)
+			values[i] = candidates[i % 8];
+
+		vector_t value;
+		Vcl::load(value, values);
+
+		Storage narrowed[Width];
+		Vcl::store(narrowed, value);
+		for (int i = 0; i < Width; i++)
+		{
+			const T expected = std::min(std::max(values[i], lo), hi);
+			EXPECT_EQ(narrowed[i], static_cast<Storage>(expected)) << "Lane " << i;
+		}
+	}
+
+	template<int Width>
+	void testRoundingStore()
+	{
+		using vector_t = Vcl::VectorScalar<float, Width>;
+
+		const float candidates[] = { -2.5f, -1.5f, -0.5f, 0.4f, 0.5f, 1.5f, 2.5f, 2.6f };
+		const int16_t expected[] = { -2, -2, 0, 0, 0, 2, 2, 3 };
+
+		float values[Width];
+		for (int i = 0; i < Width; i++)
+			values[i] = candidates[i % 8];
+
+		vector_t value;
+		Vcl::load(value, values);
+
+		int16_t narrowed[Width];
+		Vcl::store(narrowed, value);
+		for (int i = 0; i < Width; i++)
+			EXPECT_EQ(narrowed[i], expected[i % 8]) << "Lane " << i;
+	}
+
+	template<int Width>
+	void testHalf()
+	{
+		using vector_t = Vcl::VectorScalar<float, Width>;
+
+		// Exactly representable values including the largest normal and the smallest subnormal number
+		const float candidates[] = { 0.0f, -1.0f, 0.333251953125f, 65504.0f, -65504.0f, 5.9604644775390625e-8f, 6.103515625e-5f, 1023.5f };
+
+		Vcl::half mem[Width];
+		for (int i = 0; i < Width; i++)
+			mem[i] = Vcl::half(candidates[i % 8]);
+
+		vector_t value;
+		Vcl::load(value, mem);
+		for (int i = 0; i < Width; i++)
+			EXPECT_EQ(value[i], candidates[i % 8]) << "Lane " << i;
+
+		Vcl::half narrowed[Width];
+		Vcl::store(narrowed, value * vector_t(2.0f));
+		for (int i = 0; i < Width; i++)
+		{
+			const float expected = 2.0f * candidates[i % 8];
+			if (std::abs(expected) > 65504.0f)
+				EXPECT_TRUE(std::isinf(static_cast<float>(narrowed[i]))) << "Lane " << i;
+			else
+				EXPECT_EQ(static_cast<float>(narrowed[i]), expected) << "Lane " << i;
+		}
+	}
+
+	template<typename T, typename Storage, int Width>
+	void testPartialStorage()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		Storage mem[Width], dst[Width];
+		for (int i = 0; i < Width; i++)
+			mem[i] = static_cast<Storage>(i + 1);
+
+		for (int count = 0; count <= Width; count++)
+		{
+			for (int i = 0; i < Width; i++)
+				dst[i] = static_cast<Storage>(0);
+
+			vector_t value;
+			Vcl::load_n(value, mem, count);
+			Vcl::store_n(dst, value, count);
+			for (int i = 0; i < Width; i++)
+			{
+				EXPECT_EQ(value[i], i < count ? static_cast<T>(i + 1) : T(0)) << "Lane " << i << ", count " << count;
+				EXPECT_EQ(static_cast<T>(dst[i]), i < count ? static_cast<T>(i + 1) : T(0)) << "Lane " << i << ", count " << count;
+			}
+		}
+	}
+
+	template<typename Storage, int Width, int Stride>
+	void testInterleavedStorage()
+	{
+		using vector3_t = Eigen::Matrix<Vcl::VectorScalar<float, Width>, 3, 1>;
+
+		const size_t size = 4 * Width;
+		Vcl::Core::InterleavedArray<Storage, 3, 1, Stride> data(size);
+		Vcl::Core::InterleavedArray<Storage, 3, 1, Stride> copy(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			data.template at<Storage>(i) = Eigen::Matrix<Storage, 3, 1>{
+				static_cast<Storage>(i), static_cast<Storage>(2 * i), static_cast<Storage>(3 * i)
+			};
+		}
+
+		for (size_t i = 0; i < size; i += Width)
+		{
+			vector3_t v;
+			Vcl::load(v, data, i);
+			for (int j = 0; j < Width; j++)
+			{
+				EXPECT_EQ(v(0)[j], static_cast<float>(i + j));
+				EXPECT_EQ(v(1)[j], static_cast<float>(2 * (i + j)));
+				EXPECT_EQ(v(2)[j], static_cast<float>(3 * (i + j)));
+			}
+
+			Vcl::store(copy, i, vector3_t{ v(0) + v(0), v(1), v(2) });
+		}
+
+		for (size_t i = 0; i < size; i++)
+		{
+			const Eigen::Matrix<Storage, 3, 1> entry = copy.template at<Storage>(i);
+			EXPECT_EQ(static_cast<float>(entry(0)), static_cast<float>(2 * i));
+			EXPECT_EQ(static_cast<float>(entry(1)), static_cast<float>(2 * i));
+			EXPECT_EQ(static_cast<float>(entry(2)), static_cast<float>(3 * i));
+		}
+	}
+}
+
+TEST(StorageTest, Half)
+{
+	using Vcl::half;
+
+	EXPECT_EQ(half(1.0f).bits(), 0x3c00);
+	EXPECT_EQ(half(-2.0f).bits(), 0xc000);
+	EXPECT_EQ(half(65504.0f).bits(), 0x7bff);
+	EXPECT_EQ(half(65520.0f).bits(), 0x7c00) << "Overflow rounds to infinity";
+	EXPECT_EQ(half(5.9604644775390625e-8f).bits(), 0x0001) << "Smallest subnormal";
+	EXPECT_EQ(half(1.0f + 1.0f / 2048.0f).bits(), 0x3c00) << "Ties round to even";
+	EXPECT_EQ(half(1.0f + 3.0f / 2048.0f).bits(), 0x3c02) << "Ties round to even";
+	EXPECT_EQ(half(std::numeric_limits<float>::infinity()).bits(), 0x7c00);
+	EXPECT_TRUE(std::isnan(static_cast<float>(half(std::numeric_limits<float>::quiet_NaN()))));
+
+	EXPECT_EQ(static_cast<float>(half::fromBits(0x3555)), 0.333251953125f);
+	EXPECT_EQ(static_cast<float>(half::fromBits(0x0400)), 6.103515625e-5f) << "Smallest normal";
+	EXPECT_EQ(static_cast<float>(half::fromBits(0x8001)), -5.9604644775390625e-8f);
+	EXPECT_EQ(static_cast<float>(half::fromBits(0xfc00)), -std::numeric_limits<float>::infinity());
+}
+
+TEST(StorageTest, WideningLoad)
+{
+	testWideningLoad<int, int8_t, 4>();
+	testWideningLoad<int, int8_t, 8>();
+	testWideningLoad<int, int8_t, 16>();
+	testWideningLoad<int, uint8_t, 4>();
+	testWideningLoad<int, uint8_t, 8>();
+	testWideningLoad<int, uint8_t, 16>();
+	testWideningLoad<int, int16_t, 4>();
+	testWideningLoad<int, int16_t, 8>();
+	testWideningLoad<int, int16_t, 16>();
+	testWideningLoad<int, uint16_t, 4>();
+	testWideningLoad<int, uint16_t, 8>();
+	testWideningLoad<int, uint16_t, 16>();
+
+	testWideningLoad<float, int8_t, 4>();
+	testWideningLoad<float, uint8_t, 8>();
+	testWideningLoad<float, int16_t, 16>();
+	testWideningLoad<float, uint16_t, 8>();
+}
+
+TEST(StorageTest, NarrowingStore)
+{
+	testNarrowingStore<int, int8_t, 4>();
+	testNarrowingStore<int, int8_t, 8>();
+	testNarrowingStore<int, int8_t, 16>();
+	testNarrowingStore<int, uint8_t, 4>();
+	testNarrowingStore<int, uint8_t, 8>();
+	testNarrowingStore<int, uint8_t, 16>();
+	testNarrowingStore<int, int16_t, 4>();
+	testNarrowingStore<int, int16_t, 8>();
+	testNarrowingStore<int, int16_t, 16>();
+	testNarrowingStore<int, uint16_t, 4>();
+	testNarrowingStore<int, uint16_t, 8>();
+	testNarrowingStore<int, uint16_t, 16>();
+
+	testNarrowingStore<float, int8_t, 4>();
+	testNarrowingStore<float, uint8_t, 8>();
+	testNarrowingStore<float, int16_t, 16>();
+	testNarrowingStore<float, uint16_t, 16>();
+
+	testRoundingStore<4>();
+	testRoundingStore<8>();
+	testRoundingStore<16>();
+}
+
+TEST(StorageTest, HalfVector)
+{
+	testHalf<4>();
+	testHalf<8>();
+	testHalf<16>();
+}
+
+TEST(StorageTest, Partial)
+{
+	testPartialStorage<int, int8_t, 4>();
+	testPartialStorage<int, uint16_t, 8>();
+	testPartialStorage<float, Vcl::half, 8>();
+	testPartialStorage<float, int16_t, 16>();
+}
+
+TEST(StorageTest, InterleavedArray)
+{
+	testInterleavedStorage<Vcl::half, 8, Vcl::Core::DynamicStride>();
+	testInterleavedStorage<Vcl::half, 16, 16>();
+	testInterleavedStorage<int16_t, 4, 8>();
+	testInterleavedStorage<uint8_t, 8, Vcl::Core::DynamicStride>();
+	testInterleavedStorage<float, 8, 8>();
+}
@@ -36,6 +36,54 @@ VCL_BEGIN_EXTERNAL_HEADERS
 #include <gtest/gtest.h>
 VCL_END_EXTERNAL_HEADERS
 
+namespace {
+	template<typename T, int Width>
+	void testMaskedStore()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		T mem[Width], dst[Width], key[Width];
+		for (int i = 0; i < Width; i++)
+		{
+			mem[i] = T(i + 1);
+			dst[i] = T(-i - 1);
+			key[i] = T(i % 3);
+		}
+
+		vector_t k, value;
+		Vcl::load(k, key);
+		Vcl::load(value, mem);
+		const auto mask = k < vector_t(T(1));
+
+		Vcl::store(dst, value, mask);
+		for (int i = 0; i < Width; i++)
+			EXPECT_EQ(dst[i], i % 3 == 0 ? mem[i] : T(-i - 1)) << "Lane " << i << " of " << Width << "-way code failed.";
+	}
+
+	template<typename T, int Width>
+	void testPartialStore()
+	{
+		using vector_t = Vcl::VectorScalar<T, Width>;
+
+		T mem[Width];
+		for (int i = 0; i < Width; i++)
+			mem[i] = T(i + 1);
+
+		vector_t value;
+		Vcl::load(value, mem);
+		for (int count = 0; count <= Width; count++)
+		{
+			T dst[Width + 1];
+			for (int i = 0; i <= Width; i++)
+				dst[i] = T(-1);
+
+			Vcl::store_n(dst, value, count);
+			for (int i = 0; i <= Width; i++)
+				EXPECT_EQ(dst[i], i < count ? mem[i] : T(-1)) << "Entry " << i << " of " << Width << "-way code failed for " << count << " entries.";
+		}
+	}
+}
+
 // Tests the scalar gather function.
 TEST(StoreTest, Scalar)
 {
@@ -386,3 +434,49 @@ TEST(StoreTest, Vector4)
 	Vcl::store(store + 7, f16);
 	EXPECT_EQ(memcmp(mem + 7, store + 7, 16 * sizeof(Eigen::Vector4f)), 0) << "16-way code failed.";
 }
+
+TEST(StoreTest, Masked)
+{
+	testMaskedStore<float, 4>();
+	testMaskedStore<float, 8>();
+	testMaskedStore<float, 16>();
+	testMaskedStore<int, 4>();
+	testMaskedStore<int, 8>();
+	testMaskedStore<int, 16>();
+	testMaskedStore<double, 4>();
+	testMaskedStore<double, 8>();
+	testMaskedStore<double, 16>();
+}
+
+TEST(StoreTest, Partial)
+{
+	testPartialStore<float, 4>();
+	testPartialStore<float, 8>();
+	testPartialStore<float, 16>();
+	testPartialStore<int, 4>();
+	testPartialStore<int, 8>();
+	testPartialStore<int, 16>();
+	testPartialStore<double, 4>();
+	testPartialStore<double, 8>();
+	testPartialStore<double, 16>();
+}
+
+TEST(StoreTest, PartialVector3)
+{
+	using Vcl::float8;
+
+	Eigen::Vector3f mem[8];
+	for (int i = 0; i < 8; i++)
+		mem[i] = Eigen::Vector3f(float(3 * i + 0), float(3 * i + 1), float(3 * i + 2));
+
+	Eigen::Matrix<float8, 3, 1> f8;
+	Vcl::load(f8, mem);
+
+	Eigen::Vector3f dst[8];
+	for (auto& d : dst)
+		d.setConstant(-1.0f);
+
+	Vcl::store_n(dst, f8, 5);
+	for (int i = 0; i < 8; i++)
+		EXPECT_EQ(dst[i], i < 5 ? mem[i] : Eigen::Vector3f::Constant(-1.0f)) << "8-way code failed.";
+}
@@ -0,0 +1,207 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+
+// C++ standard library
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/util/stringparser.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	const char* ObjContent =
+		"# comment\n"
+		"v 1.5 -2.25 3e2\n"
+		"\n"
+		"vn  0.57735026\t-0.57735026 0.57735026 \n"
+		"f 1/2/3 -1 42\n"
+		"v 1 2 3";
+
+	void parseObjContent(Vcl::Util::StringParser& parser)
+	{
+		std::string token;
+		float v[3];
+		int i;
+
+		ASSERT_TRUE(parser.loadLine());
+		EXPECT_TRUE(parser.readString(&token));
+		EXPECT_EQ("#", token);
+		parser.skipLine();
+
+		ASSERT_TRUE(parser.loadLine());
+		EXPECT_TRUE(parser.readString(&token));
+		EXPECT_EQ("v", token);
+		EXPECT_EQ(3u, parser.readFloats(stdext::make_span(v, 3)));
+		EXPECT_EQ(1.5f, v[0]);
+		EXPECT_EQ(-2.25f, v[1]);
+		EXPECT_EQ(300.0f, v[2]);
+		parser.skipLine();
+
+		ASSERT_TRUE(parser.loadLine());
+		EXPECT_FALSE(parser.readString(&token));
+		parser.skipLine();
+
+		ASSERT_TRUE(parser.loadLine());
+		EXPECT_TRUE(parser.readString(&token));
+		EXPECT_EQ("vn", token);
+		EXPECT_EQ(3u, parser.readFloats(stdext::make_span(v, 3)));
+		EXPECT_EQ(0.57735026f, v[0]);
+		EXPECT_EQ(-0.57735026f, v[1]);
+		EXPECT_EQ(0.57735026f, v[2]);
+		EXPECT_EQ(0u, parser.readFloats(stdext::make_span(v, 3)));
+		parser.skipLine();
+
+		ASSERT_TRUE(parser.loadLine());
+		EXPECT_TRUE(parser.readString(&token));
+		EXPECT_TRUE(parser.readString(&token));
+		EXPECT_EQ("1/2/3", token);
+		EXPECT_TRUE(parser.readInt(&i));
+		EXPECT_EQ(-1, i);
+		EXPECT_TRUE(parser.readInt(&i));
+		EXPECT_EQ(42, i);
+		EXPECT_FALSE(parser.readInt(&i));
+		parser.skipLine();
+
+		// Last line without a line break
+		ASSERT_TRUE(parser.loadLine());
+		EXPECT_TRUE(parser.readString(&token));
+		EXPECT_EQ(3u, parser.readFloats(stdext::make_span(v, 3)));
+		EXPECT_EQ(3.0f, v[2]);
+		parser.skipLine();
+
+		EXPECT_FALSE(parser.loadLine());
+		EXPECT_TRUE(parser.eos());
+	}
+}
+
+TEST(StringParserTest, ParseBuffer)
+{
+	Vcl::Util::StringParser parser;
+	parser.setInputBuffer(ObjContent, std::strlen(ObjContent));
+	parseObjContent(parser);
+}
+
+TEST(StringParserTest, ParseStream)
+{
+	std::istringstream stream{ ObjContent };
+
+	Vcl::Util::StringParser parser;
+	parser.setInputStream(&stream);
+	parseObjContent(parser);
+}
+
+TEST(StringParserTest, ParseFile)
+{
+	const std::string path = "stringparser_test.obj";
+	{
+		std::ofstream file{ path, std::ios::binary };
+		file << ObjContent;
+	}
+
+	Vcl::Util::StringParser parser;
+	EXPECT_FALSE(parser.setInputFile("does_not_exist.obj"));
+	ASSERT_TRUE(parser.setInputFile(path));
+	parseObjContent(parser);
+
+	std::remove(path.c_str());
+}
+
+TEST(StringParserTest, FloatsAreCorrectlyRounded)
+{
+	std::mt19937 rnd;
+	std::uniform_int_distribution<uint32_t> bits;
+	std::uniform_int_distribution<int> precision{ 1, 12 };
+
+	// Print random floats with varying precision and compare with strtof
+	std::string content;
+	std::vector<float> expected;
+	char buffer[64];
+	for (int i = 0; i < 100000; i++)
+	{
+		uint32_t b = bits(rnd) & 0xbfffffff;
+		float f;
+		std::memcpy(&f, &b, sizeof(f));
+		if (i % 2 == 0)
+			std::snprintf(buffer, sizeof(buffer), "%.*g ", precision(rnd), static_cast<double>(f));
+		else
+			std::snprintf(buffer, sizeof(buffer), "%.*f ", precision(rnd), static_cast<double>(f) * 1e-30);
+
+		content += buffer;
+		expected.push_back(std::strtof(buffer, nullptr));
+	}
+
+	Vcl::Util::StringParser parser;
+	parser.setInputBuffer(content.data(), content.size());
+	ASSERT_TRUE(parser.loadLine());
+
+	std::vector<float> values(expected.size());
+	EXPECT_EQ(values.size(), parser.readFloats(stdext::make_span(values)));
+	for (size_t i = 0; i < values.size(); i++)
+		EXPECT_EQ(expected[i], values[i]) << i;
+}
+
+TEST(StringParserTest, SplitAtLineBreaks)
+{
+	std::string content;
+	for (int i = 0; i < 1000; i++)
+		content += std::string(i % 37, 'x') + "\n";
+	content += "last line";
+
+	for (size_t max_chunks : { 1, 3, 7, 64 })
+	{
+		const auto chunks = Vcl::Util::splitAtLineBreaks(stdext::make_span(content.data(), content.size()), max_chunks, 1024);
+		EXPECT_LE(chunks.size(), max_chunks);
+
+		// Chunks are consecutive and end after a line break
+		const char* ptr = content.data();
+		for (size_t c = 0; c < chunks.size(); c++)
+		{
+			EXPECT_EQ(ptr, chunks[c].data());
+			ptr += chunks[c].size();
+			if (c + 1 < chunks.size())
+			{
+				EXPECT_EQ('\n', chunks[c].back());
+			}
+		}
+		EXPECT_EQ(content.data() + content.size(), ptr);
+	}
+
+	const auto empty = Vcl::Util::splitAtLineBreaks(stdext::span<const char>{}, 4);
+	EXPECT_EQ(1u, empty.size());
+	EXPECT_EQ(0u, empty[0].size());
+}
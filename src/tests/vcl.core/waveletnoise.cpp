@@ -27,9 +27,14 @@
 #include <vcl/config/global.h>
 
 // C++ standard library
+#include <algorithm>
+#include <cstdio>
 #include <numeric>
+#include <string>
+#include <vector>
 
 // Include the relevant parts from the library
+#include <vcl/core/simd/memory.h>
 #include <vcl/math/math.h>
 #include <vcl/util/waveletnoise.h>
 #include <vcl/util/waveletnoise_helpers.h>
@@ -480,3 +485,127 @@ TEST_F(WaveletNoiseTest, DxDyDz)
 		}
 	}
 }
+
+TEST_F(WaveletNoiseTest, EvaluateBatch)
+{
+	// Odd number of points to cover the padded tail
+	std::vector<Vec3> points(37);
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		const float t = static_cast<float>(i);
+		points[i] = { 0.37f * t - 5.0f, 1.11f * t, -0.73f * t + 2.0f };
+	}
+
+	std::vector<float> values(points.size());
+	evaluate(points, stdext::make_span(values));
+
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		EXPECT_NEAR(evaluate(points[i]), values[i], 1e-5f) << "Point " << i;
+	}
+}
+
+TEST_F(WaveletNoiseTest, EvaluateBatchBands)
+{
+	std::vector<Vec3> points(37);
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		const float t = static_cast<float>(i);
+		points[i] = { 0.37f * t - 5.0f, 1.11f * t, -0.73f * t + 2.0f };
+	}
+
+	const std::array<float, 3> w = { 1.0f, 0.5f, 0.25f };
+	const Vec3 normal = { 0.0f, 0.0f, 1.0f };
+
+	std::vector<float> values(points.size());
+	evaluate(points, -4.0f, nullptr, 0, 3, w, stdext::make_span(values));
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		EXPECT_NEAR(evaluate(points[i], -4.0f, nullptr, 0, 3, w), values[i], 1e-5f) << "Point " << i;
+	}
+
+	evaluate(points, -4.0f, &normal, 0, 3, w, stdext::make_span(values));
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		EXPECT_NEAR(evaluate(points[i], -4.0f, &normal, 0, 3, w), values[i], 1e-5f) << "Point " << i;
+	}
+}
+
+template<int Width>
+void testVectorEvaluate(const Vcl::Util::WaveletNoise<32>& noise)
+{
+	using real_t = Vcl::VectorScalar<float, Width>;
+
+	std::array<std::array<float, Width>, 3> coords;
+	for (int l = 0; l < Width; l++)
+	{
+		const float t = static_cast<float>(l);
+		coords[0][l] = 0.41f * t - 3.0f;
+		coords[1][l] = 0.93f * t;
+		coords[2][l] = -1.27f * t + 1.0f;
+	}
+
+	Eigen::Matrix<real_t, 3, 1> p;
+	Vcl::load(p(0), coords[0].data());
+	Vcl::load(p(1), coords[1].data());
+	Vcl::load(p(2), coords[2].data());
+
+	const std::array<float, 2> w = { 1.0f, 0.5f };
+
+	std::array<float, Width> values, band_values;
+	Vcl::store(values.data(), noise.evaluate(p));
+	Vcl::store(band_values.data(), noise.evaluate(p, -3.0f, 0, 2, w));
+	for (int l = 0; l < Width; l++)
+	{
+		const std::array<float, 3> q = { coords[0][l], coords[1][l], coords[2][l] };
+		EXPECT_NEAR(noise.evaluate(q), values[l], 1e-5f) << "Lane " << l;
+		EXPECT_NEAR(noise.evaluate(q, -3.0f, nullptr, 0, 2, w), band_values[l], 1e-5f) << "Lane " << l;
+	}
+}
+
+TEST_F(WaveletNoiseTest, EvaluateVector)
+{
+	testVectorEvaluate<4>(*this);
+	testVectorEvaluate<8>(*this);
+	testVectorEvaluate<16>(*this);
+}
+
+TEST(WaveletNoiseCache, MapCachedTile)
+{
+	using Vcl::Util::WaveletNoise;
+
+	const std::string path = "./waveletnoise_32_42.bin";
+	std::remove(path.c_str());
+
+	// Without a cache the tile only depends on the seed
+	const WaveletNoise<32> reference(42);
+	EXPECT_FALSE(reference.isMapped());
+
+	// First construction generates the tile and writes the cache
+	const WaveletNoise<32> cold(42, ".");
+	EXPECT_FALSE(cold.isMapped());
+
+	// Second construction maps the cached tile
+	const WaveletNoise<32> warm(42, ".");
+	ASSERT_TRUE(warm.isMapped());
+
+	// Copies share the mapping
+	const WaveletNoise<32> copy = warm;
+	EXPECT_EQ(copy.getNoiseTileData(), warm.getNoiseTileData());
+
+	constexpr int n3 = 32 * 32 * 32;
+	EXPECT_TRUE(std::equal(reference.getNoiseTileData(), reference.getNoiseTileData() + n3, cold.getNoiseTileData()));
+	EXPECT_TRUE(std::equal(reference.getNoiseTileData(), reference.getNoiseTileData() + n3, warm.getNoiseTileData()));
+	EXPECT_EQ(reference.minValue(), warm.minValue());
+	EXPECT_EQ(reference.maxValue(), warm.maxValue());
+
+	const std::array<float, 3> p = { 0.3f, 1.7f, -2.2f };
+	EXPECT_EQ(reference.evaluate(p), warm.evaluate(p));
+
+	// A different seed does not pick up the cached tile
+	const WaveletNoise<32> other(43, ".");
+	EXPECT_FALSE(other.isMapped());
+
+	std::remove(path.c_str());
+	std::remove("./waveletnoise_32_43.bin");
+}
@@ -33,6 +33,7 @@
 
 // Include the relevant parts from the library
 #include <vcl/core/memory/allocator.h>
+#include <vcl/core/simd/dispatch.h>
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/interleavedarray.h>
 #include <vcl/geometry/distance_ray3ray3.h>
@@ -148,6 +149,34 @@ TEST(PointTriangleDistance, Simple16)
 {
 	pointTriangleDistanceGeneric<Vcl::float16>();
 }
+TEST(PointTriangleDistance, Batch)
+{
+	using namespace Vcl::Geometry;
+	using Vcl::Mathematics::equal;
+
+	const auto ext = distancePointTriangleSimdExt();
+	EXPECT_TRUE(Vcl::Core::Simd::isSupported(ext)) << Vcl::Core::Simd::name(ext);
+
+	// Size is not a multiple of any vector width
+	const size_t problem_size = 61;
+
+	std::vector<Triangle<float, 3>> tris;
+	std::vector<Eigen::Vector3f> points;
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		tris.emplace_back(Eigen::Vector3f::Random(), Eigen::Vector3f::Random(), Eigen::Vector3f::Random());
+		points.emplace_back(2 * Eigen::Vector3f::Random());
+	}
+
+	std::vector<float> dist(problem_size);
+	distance(stdext::make_span(tris), stdext::make_span(points), stdext::make_span(dist));
+
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		const float ref_dist = distance(tris[i], points[i]);
+		EXPECT_TRUE(equal(ref_dist, dist[i], 1e-4f)) << "Distance differ: " << i << ", " << ref_dist << ", " << dist[i];
+	}
+}
 
 template<typename real_t>
 void triangleTriangleDistanceGeneric()
@@ -246,6 +275,38 @@ TEST(TriangleTriangleDistance, Simple16)
 {
 	triangleTriangleDistanceGeneric<Vcl::float16>();
 }
+TEST(TriangleTriangleDistance, Batch)
+{
+	using namespace Vcl::Geometry;
+	using Vcl::Mathematics::equal;
+
+	const auto ext = distanceTriangleTriangleSimdExt();
+	EXPECT_TRUE(Vcl::Core::Simd::isSupported(ext)) << Vcl::Core::Simd::name(ext);
+
+	// Size is not a multiple of any vector width
+	const size_t problem_size = 61;
+
+	std::vector<Triangle<float, 3>> tris_a;
+	std::vector<Triangle<float, 3>> tris_b;
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		tris_a.emplace_back(Eigen::Vector3f::Random(), Eigen::Vector3f::Random(), Eigen::Vector3f::Random());
+		tris_b.emplace_back(Eigen::Vector3f::Random(), Eigen::Vector3f::Random(), Eigen::Vector3f::Random());
+	}
+
+	std::vector<float> dist(problem_size);
+	distance(stdext::make_span(tris_a), stdext::make_span(tris_b), stdext::make_span(dist));
+
+	gte::DCPQuery<float, gte::Triangle3<float>, gte::Triangle3<float>> gteQuery;
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		gte::Triangle3<float> A{ cast(tris_a[i][0]), cast(tris_a[i][1]), cast(tris_a[i][2]) };
+		gte::Triangle3<float> B{ cast(tris_b[i][0]), cast(tris_b[i][1]), cast(tris_b[i][2]) };
+
+		const float ref_dist = gteQuery(A, B).sqrDistance;
+		EXPECT_TRUE(equal(ref_dist, dist[i], 1e-4f)) << "Distance differ: " << i << ", " << ref_dist << ", " << dist[i];
+	}
+}
 
 template<typename real_t>
 void distanceRayRayGeneric()
@@ -327,3 +388,34 @@ TEST(DistanceRayRay, Simple16)
 {
 	distanceRayRayGeneric<Vcl::float16>();
 }
+TEST(DistanceRayRay, Batch)
+{
+	using namespace Vcl::Geometry;
+	using Vcl::Mathematics::equal;
+
+	const auto ext = distanceRayRaySimdExt();
+	EXPECT_TRUE(Vcl::Core::Simd::isSupported(ext)) << Vcl::Core::Simd::name(ext);
+
+	// Size is not a multiple of any vector width
+	const size_t problem_size = 61;
+
+	std::vector<Ray<float, 3>> rays_a;
+	std::vector<Ray<float, 3>> rays_b;
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		rays_a.emplace_back(Eigen::Vector3f::Random(), Eigen::Vector3f::Random().normalized());
+		rays_b.emplace_back(Eigen::Vector3f::Random(), Eigen::Vector3f::Random().normalized());
+	}
+
+	// Parallel rays
+	rays_b[7] = { Eigen::Vector3f{ 0, 0, 1 }, rays_a[7].direction() };
+
+	std::vector<float> dist(problem_size);
+	distance(stdext::make_span(rays_a), stdext::make_span(rays_b), stdext::make_span(dist));
+
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		const float ref_dist = distance(rays_a[i], rays_b[i], nullptr);
+		EXPECT_TRUE(equal(ref_dist, dist[i], 1e-4f)) << "Distance differ: " << i << ", " << ref_dist << ", " << dist[i];
+	}
+}
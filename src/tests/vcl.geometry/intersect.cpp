@@ -29,10 +29,12 @@
 
 // C++ Standard Library
 #include <array>
+#include <memory>
 #include <random>
 #include <vector>
 
 // Include the relevant parts from the library
+#include <vcl/core/simd/dispatch.h>
 #include <vcl/core/simd/vectorscalar.h>
 #include <vcl/core/interleavedarray.h>
 #include <vcl/geometry/intersect.h>
@@ -268,3 +270,39 @@ TEST(AxisAlignedBoxRayIntersection, SimpleFloat16)
 
 	EXPECT_TRUE(all(intersects(b0, r, Selector{}))) << "Intersection was missed.";
 }
+
+TEST(AxisAlignedBoxRayIntersection, Batch)
+{
+	using namespace Vcl::Geometry;
+
+	using Selector = RayBoxIntersectionAlgorithmSelector<RayBoxIntersectionAlgorithm::Ize>;
+
+	const auto ext = intersectsSimdExt();
+	EXPECT_TRUE(Vcl::Core::Simd::isSupported(ext)) << Vcl::Core::Simd::name(ext);
+
+	// Size is not a multiple of any vector width
+	const size_t problem_size = 61;
+
+	std::vector<Eigen::AlignedBox<float, 3>> boxes;
+	std::vector<Ray<float, 3>> rays;
+	for (size_t i = 0; i < problem_size; i++)
+	{
+		const Eigen::Vector3f p = Eigen::Vector3f::Random();
+		boxes.emplace_back(p, p + Eigen::Vector3f::Random().cwiseAbs());
+		rays.emplace_back(2 * Eigen::Vector3f::Random(), Eigen::Vector3f::Random().normalized());
+	}
+
+	// Axis aligned rays
+	rays[3] = { { 0.5f, 0.5f, -1 }, { 0, 0, 1 } };
+	boxes[3] = { Eigen::Vector3f{ 0, 0, 0 }, Eigen::Vector3f{ 1, 1, 1 } };
+	rays[4] = { { 1.5f, 0.5f, -1 }, { 0, 0, 1 } };
+	boxes[4] = { Eigen::Vector3f{ 0, 0, 0 }, Eigen::Vector3f{ 1, 1, 1 } };
+
+	std::unique_ptr<bool[]> results{ new bool[problem_size] };
+	intersects(stdext::make_span(boxes), stdext::make_span(rays), stdext::make_span(results.get(), problem_size));
+
+	for (size_t i = 0; i < problem_size; i++)
+		EXPECT_EQ(intersects(boxes[i], rays[i], Selector{}), results[i]) << i;
+	EXPECT_TRUE(results[3]);
+	EXPECT_FALSE(results[4]);
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the Visual Computing Library (VCL) release under the
+ * MIT license.
+ *
+ * Copyright (c) 2023 Basil Fierz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// VCL configuration
+#include <vcl/config/global.h>
+#include <vcl/config/eigen.h>
+
+// C++ Standard Library
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Include the relevant parts from the library
+#include <vcl/geometry/io/serialiser_obj.h>
+#include <vcl/geometry/io/serialiser_tetgen.h>
+
+VCL_BEGIN_EXTERNAL_HEADERS
+// Google test
+#include <gtest/gtest.h>
+VCL_END_EXTERNAL_HEADERS
+
+namespace {
+	//! Records all the elements in the order they are added
+	struct RecordingDeserialiser : public Vcl::Geometry::IO::AbstractDeserialiser
+	{
+		void begin() override {}
+		void end() override {}
+
+		void sizeHintNodes(unsigned int hint) override { nodeHint = hint; }
+		void sizeHintEdges(unsigned int) override {}
+		void sizeHintFaces(unsigned int) override {}
+		void sizeHintVolumes(unsigned int hint) override { volumeHint = hint; }
+
+		void addNode(const std::vector<float>& coordinates) override { nodes.push_back(coordinates); }
+		void addEdge(const std::vector<unsigned int>&) override {}
+		void addFace(const std::vector<unsigned int>& indices) override { faces.push_back(indices); }
+		void addVolume(const std::vector<unsigned int>& indices) override { volumes.push_back(indices); }
+
+		void addNormal(const Vcl::Vector3f& normal) override { normals.push_back(normal); }
+
+		unsigned int nodeHint{ 0 };
+		unsigned int volumeHint{ 0 };
+		std::vector<std::vector<float>> nodes;
+		std::vector<std::vector<unsigned int>> faces;
+		std::vector<std::vector<unsigned int>> volumes;
+		std::vector<Vcl::Vector3f> normals;
+	};
+
+	// Number of elements large enough to split the files into several chunks
+	const unsigned int NrElements = 100000;
+}
+
+TEST(SerialiserTest, LoadObj)
+{
+	const std::string path = "serialiser_test.obj";
+	{
+		std::ofstream file{ path };
+		file << "# Triangle strip\n";
+		for (unsigned int i = 0; i < NrElements; i++)
+		{
+			file << "v " << i << " 0.5 -" << i << "\n";
+			if (i % 2 == 1)
+				file << "vn 0 1 0\n";
+
+			// Alternate between absolute and relative indices
+			if (i >= 2 && i % 2 == 0)
+				file << "f " << i - 1 << "/1/1 " << i << "//1 " << i + 1 << "\n";
+			else if (i >= 2)
+				file << "f -3 -2 -1\n";
+		}
+	}
+
+	RecordingDeserialiser mesh;
+	Vcl::Geometry::IO::ObjSerialiser{}.load(&mesh, path);
+	std::remove(path.c_str());
+
+	EXPECT_EQ(NrElements, mesh.nodeHint);
+	ASSERT_EQ(NrElements, mesh.nodes.size());
+	ASSERT_EQ(NrElements / 2, mesh.normals.size());
+	ASSERT_EQ(NrElements - 2, mesh.faces.size());
+	for (unsigned int i = 0; i < NrElements; i++)
+	{
+		ASSERT_EQ(3u, mesh.nodes[i].size());
+		EXPECT_EQ(float(i), mesh.nodes[i][0]);
+		EXPECT_EQ(0.5f, mesh.nodes[i][1]);
+		EXPECT_EQ(-float(i), mesh.nodes[i][2]);
+	}
+	for (unsigned int f = 0; f < mesh.faces.size(); f++)
+	{
+		const std::vector<unsigned int> expected = { f, f + 1, f + 2 };
+		EXPECT_EQ(expected, mesh.faces[f]) << f;
+	}
+}
+
+TEST(SerialiserTest, LoadTetGen)
+{
+	const std::string node_path = "serialiser_test.node";
+	const std::string ele_path = "serialiser_test.ele";
+	{
+		std::ofstream node_file{ node_path };
+		node_file << "# Node file\n";
+		node_file << NrElements << " 3 0 0\n";
+		for (unsigned int i = 0; i < NrElements; i++)
+		{
+			node_file << i + 1 << " " << i << " 1.25 -" << i << "\n";
+			if (i % 1000 == 0)
+				node_file << "\n# Comment\n";
+		}
+
+		std::ofstream ele_file{ ele_path };
+		ele_file << NrElements - 3 << " 4 0\n";
+		for (unsigned int i = 0; i < NrElements - 3; i++)
+			ele_file << i + 1 << "  " << i + 1 << " " << i + 2 << " " << i + 3 << " " << i + 4 << "\n";
+	}
+
+	RecordingDeserialiser mesh;
+	Vcl::Geometry::IO::TetGenSerialiser{}.load(&mesh, node_path);
+	std::remove(node_path.c_str());
+	std::remove(ele_path.c_str());
+
+	EXPECT_EQ(NrElements, mesh.nodeHint);
+	EXPECT_EQ(NrElements - 3, mesh.volumeHint);
+	ASSERT_EQ(NrElements, mesh.nodes.size());
+	ASSERT_EQ(NrElements - 3, mesh.volumes.size());
+	for (unsigned int i = 0; i < NrElements; i++)
+	{
+		ASSERT_EQ(3u, mesh.nodes[i].size());
+		EXPECT_EQ(float(i), mesh.nodes[i][0]);
+		EXPECT_EQ(1.25f, mesh.nodes[i][1]);
+		EXPECT_EQ(-float(i), mesh.nodes[i][2]);
+	}
+	for (unsigned int v = 0; v < mesh.volumes.size(); v++)
+	{
+		const std::vector<unsigned int> expected = { v, v + 1, v + 2, v + 3 };
+		EXPECT_EQ(expected, mesh.volumes[v]) << v;
+	}
+}
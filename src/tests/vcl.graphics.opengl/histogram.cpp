@@ -30,6 +30,7 @@
 #include <random>
 
 // Include the relevant parts from the library
+#include <vcl/core/algorithm/histogram.h>
 #include <vcl/graphics/opengl/algorithm/histogram.h>
 
 // Google test
@@ -46,13 +47,14 @@ void BuildHistogramTest(unsigned int buckets, unsigned int size)
 	Histogram hist{ size, buckets };
 
 	// Define the input buffer
-	std::vector<int> numbers(size);
-	for (int i = 0; i < size; i++)
+	std::vector<unsigned int> numbers(size);
+	for (unsigned int i = 0; i < size; i++)
 		numbers[i] = dist(rnd);
 
-	std::vector<int> histogram(buckets, 0);
-	for (int i = 0; i < size; i++)
-		histogram[numbers[i]]++;
+	// Compute the reference on the CPU
+	std::vector<unsigned int> histogram(buckets, 0);
+	Vcl::Core::Histogram reference{ size, buckets };
+	reference(stdext::make_span(histogram), numbers, size);
 
 	Runtime::BufferDescription desc = {
 		static_cast<unsigned int>(sizeof(unsigned int) * numbers.size()),
@@ -74,9 +76,9 @@ void BuildHistogramTest(unsigned int buckets, unsigned int size)
 
 	hist(output, input, size);
 
-	int* ptr = (int*)output->map(0, output->sizeInBytes());
+	unsigned int* ptr = (unsigned int*)output->map(0, output->sizeInBytes());
 
-	for (int i = 0; i < buckets; i++)
+	for (unsigned int i = 0; i < buckets; i++)
 	{
 		EXPECT_EQ(histogram[i], ptr[i]) << "Prefix sum is wrong: " << i;
 	}
@@ -29,6 +29,7 @@
 // C++ Standard Library
 
 // Include the relevant parts from the library
+#include <vcl/core/algorithm/scan.h>
 #include <vcl/graphics/opengl/algorithm/scan.h>
 
 // Google test
@@ -41,10 +42,15 @@ void ExecuteScanTest(unsigned int size)
 	ScanExclusive scan{ size };
 
 	// Define the input buffer
-	std::vector<int> numbers(size);
-	for (int i = 0; i < size; i++)
+	std::vector<unsigned int> numbers(size);
+	for (unsigned int i = 0; i < size; i++)
 		numbers[i] = i;
 
+	// Compute the reference on the CPU
+	std::vector<unsigned int> expected(size);
+	Vcl::Core::ScanExclusive reference{ size };
+	reference(stdext::make_span(expected), numbers, size);
+
 	Runtime::BufferDescription desc = {
 		static_cast<unsigned int>(sizeof(unsigned int) * numbers.size()),
 		Runtime::BufferUsage::MapRead | Runtime::BufferUsage::Storage
@@ -60,13 +66,11 @@ void ExecuteScanTest(unsigned int size)
 
 	scan(output, input, size);
 
-	int* ptr = (int*)output->map(0, sizeof(unsigned int) * numbers.size());
+	unsigned int* ptr = (unsigned int*)output->map(0, sizeof(unsigned int) * numbers.size());
 
-	int s = 0;
-	for (int i = 0; i < size; i++)
+	for (unsigned int i = 0; i < size; i++)
 	{
-		EXPECT_EQ(s, ptr[i]) << "Prefix sum is wrong: " << i;
-		s += i;
+		EXPECT_EQ(expected[i], ptr[i]) << "Prefix sum is wrong: " << i;
 	}
 
 	output->unmap();
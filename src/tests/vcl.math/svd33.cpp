@@ -29,9 +29,12 @@
 
 // C++ standard library
 #include <random>
+#include <vector>
 
 // Include the relevant parts from the library
 #include <vcl/core/interleavedarray.h>
+#include <vcl/core/simd/dispatch.h>
+#include <vcl/core/simd/memory.h>
 #include <vcl/math/math.h>
 #include <vcl/math/jacobisvd33_mcadams.h>
 #include <vcl/math/jacobisvd33_qr.h>
@@ -412,6 +415,42 @@ void runMcAdamsQuatTest(float tol)
 }
 #endif // defined(VCL_VECTORIZE_SSE) || defined(VCL_VECTORIZE_AVX)
 
+#ifdef VCL_MATH_MCADAMS_BATCH_SSE
+void runMcAdamsBatchTest(float tol)
+{
+	using matrix3_t = Eigen::Matrix<float, 3, 3>;
+
+	// Use a problem size which is not a multiple of the SIMD width
+	size_t nr_problems = 125;
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> resU(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> resV(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(nr_problems);
+
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> refU(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> refV(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 1, -1> refS(nr_problems);
+
+	auto F = createProblems<float>(nr_problems);
+	computeReferenceSolution(nr_problems, F, refU, refV, refS);
+
+	std::vector<matrix3_t> S(nr_problems), U(nr_problems), V(nr_problems);
+	for (size_t i = 0; i < nr_problems; i++)
+		S[i] = F.at<float>(i);
+
+	Vcl::Mathematics::McAdamsJacobiSVD(stdext::make_span(S), stdext::make_span(U), stdext::make_span(V), 5);
+
+	for (size_t i = 0; i < nr_problems; i++)
+	{
+		resU.at<float>(i) = U[i];
+		resV.at<float>(i) = V[i];
+		resS.at<float>(i) = S[i].diagonal();
+	}
+
+	// Check against reference solution
+	checkSolution(nr_problems, tol, refU, refV, refS, resU, resV, resS);
+}
+#endif // defined(VCL_MATH_MCADAMS_BATCH_SSE)
+
 template<typename WideScalar>
 void runTwoSidedTest(float tol)
 {
@@ -452,6 +491,52 @@ void runTwoSidedTest(float tol)
 	checkSolution(nr_problems, tol, refU, refV, refS, resU, resV, resS);
 }
 
+void runTwoSidedBatchTest(float tol)
+{
+	using matrix3_t = Eigen::Matrix<float, 3, 3>;
+
+	// Use a problem size which is not a multiple of the SIMD width
+	size_t nr_problems = 125;
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> resU(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> resV(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 1, -1> resS(nr_problems);
+
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> refU(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 3, -1> refV(nr_problems);
+	Vcl::Core::InterleavedArray<float, 3, 1, -1> refS(nr_problems);
+
+	auto F = createProblems<float>(nr_problems);
+	computeReferenceSolution(nr_problems, F, refU, refV, refS);
+
+	std::vector<matrix3_t> S(nr_problems), U(nr_problems), V(nr_problems);
+	for (size_t i = 0; i < nr_problems; i++)
+		S[i] = F.at<float>(i);
+
+	EXPECT_GT(Vcl::Mathematics::TwoSidedJacobiSVD(stdext::make_span(S), stdext::make_span(U), stdext::make_span(V)), 0);
+
+	for (size_t i = 0; i < nr_problems; i++)
+	{
+		resU.at<float>(i) = U[i];
+		resV.at<float>(i) = V[i];
+		resS.at<float>(i) = S[i].diagonal();
+	}
+
+	// Check against reference solution
+	checkSolution(nr_problems, tol, refU, refV, refS, resU, resV, resS);
+
+	// Restarting from the solution keeps it
+	for (size_t i = 0; i < nr_problems; i++)
+		S[i] = F.at<float>(i);
+	Vcl::Mathematics::TwoSidedJacobiSVD(stdext::make_span(S), stdext::make_span(U), stdext::make_span(V), true);
+	for (size_t i = 0; i < nr_problems; i++)
+	{
+		resU.at<float>(i) = U[i];
+		resV.at<float>(i) = V[i];
+		resS.at<float>(i) = S[i].diagonal();
+	}
+	checkSolution(nr_problems, tol, refU, refV, refS, resU, resV, resS);
+}
+
 template<typename WideScalar>
 void runQRTest(float tol)
 {
@@ -492,6 +577,61 @@ void runQRTest(float tol)
 	checkSolution(nr_problems, tol, refU, refV, refS, resU, resV, resS);
 }
 
+template<typename WideScalar>
+void runTwoSidedDoubleTest(double tol, double orth_tol)
+{
+	using real_t = WideScalar;
+	using matrix3_t = Eigen::Matrix<real_t, 3, 3>;
+
+	constexpr int width = sizeof(real_t) / sizeof(double);
+
+	size_t nr_problems = 128;
+	auto F = createProblems<float>(nr_problems);
+
+	for (size_t i = 0; i < nr_problems / width; i++)
+	{
+		// Transpose the problems into the wide matrix
+		matrix3_t S;
+		for (int c = 0; c < 3; c++)
+		{
+			for (int r = 0; r < 3; r++)
+			{
+				double lanes[width];
+				for (int l = 0; l < width; l++)
+					lanes[l] = F.at<float>(i * width + l)(r, c);
+
+				Vcl::load(S(r, c), lanes);
+			}
+		}
+		matrix3_t U = matrix3_t::Identity();
+		matrix3_t V = matrix3_t::Identity();
+
+		Vcl::Mathematics::TwoSidedJacobiSVD(S, U, V);
+
+		// Check each lane for a valid decomposition of the input
+		for (int l = 0; l < width; l++)
+		{
+			Vcl::Matrix3d A = F.at<float>(i * width + l).cast<double>();
+			Vcl::Matrix3d resU, resV;
+			Vcl::Vector3d resS;
+			for (int c = 0; c < 3; c++)
+			{
+				for (int r = 0; r < 3; r++)
+				{
+					resU(r, c) = U(r, c)[l];
+					resV(r, c) = V(r, c)[l];
+				}
+				resS(c) = S(c, c)[l];
+			}
+
+			const Vcl::Matrix3d rec = resU * resS.asDiagonal() * resV.transpose();
+			EXPECT_TRUE(rec.isApprox(A, tol)) << "Problem " << i * width + l;
+			EXPECT_TRUE((resU.transpose() * resU).isIdentity(orth_tol)) << "Problem " << i * width + l;
+			EXPECT_TRUE((resV.transpose() * resV).isIdentity(orth_tol)) << "Problem " << i * width + l;
+		}
+	}
+}
+
 #ifdef VCL_VECTORIZE_SSE
 TEST(SVD33, McAdamsSVDFloat)
 {
@@ -523,6 +663,20 @@ TEST(SVD33, McAdamsQuatSVDFloat8)
 }
 #endif // defined VCL_VECTORIZE_AVX
 
+#ifdef VCL_MATH_MCADAMS_BATCH_SSE
+TEST(SVD33, McAdamsSVDBatch)
+{
+	using Vcl::Core::Simd::SimdExt;
+
+	// Restricting the dispatch with 'VCL_SIMD_EXT=None' selects the scalar fallback
+	const auto ext = Vcl::Mathematics::McAdamsJacobiSVDSimdExt();
+	EXPECT_TRUE(ext == SimdExt::None || ext == SimdExt::SSE || ext == SimdExt::AVX || ext == SimdExt::AVX512);
+	EXPECT_TRUE(Vcl::Core::Simd::isSupported(ext));
+
+	runMcAdamsBatchTest(1e-5f);
+}
+#endif // defined(VCL_MATH_MCADAMS_BATCH_SSE)
+
 TEST(SVD33, TwoSidedSVDFloat)
 {
 	runTwoSidedTest<float>(1e-4f);
@@ -535,6 +689,28 @@ TEST(SVD33, TwoSidedSVDFloat8)
 {
 	runTwoSidedTest<Vcl::float8>(1e-5f);
 }
+TEST(SVD33, TwoSidedSVDBatch)
+{
+	using Vcl::Core::Simd::SimdExt;
+
+	const auto ext = Vcl::Mathematics::TwoSidedJacobiSVDSimdExt();
+	EXPECT_TRUE(ext == SimdExt::None || ext == SimdExt::SSE || ext == SimdExt::AVX || ext == SimdExt::AVX512);
+	EXPECT_TRUE(Vcl::Core::Simd::isSupported(ext));
+
+	runTwoSidedBatchTest(1e-4f);
+}
+TEST(SVD33, TwoSidedSVDDouble4)
+{
+	runTwoSidedDoubleTest<Vcl::double4>(1e-5, 1e-12);
+}
+TEST(SVD33, TwoSidedSVDDouble8)
+{
+	runTwoSidedDoubleTest<Vcl::double8>(1e-5, 1e-12);
+}
+TEST(SVD33, TwoSidedSVDDouble16)
+{
+	runTwoSidedDoubleTest<Vcl::double16>(1e-5, 1e-12);
+}
 
 TEST(SVD33, QRSVDFloat)
 {